@@ -0,0 +1,119 @@
+/*
+ * Render benchmark of the pages
+ *
+ *   display_bench [rounds]
+ *
+ * Draws the pages of pages.cpp in order, rounds times, and sends a frame
+ * after each page, so every page starts from the image of the one before
+ * like when paging through the menu on the device. Every page is then drawn
+ * a second time over itself, like the HMI does when it re-enters a page.
+ * Per page the averages of the drawing time, the refresh() time and the
+ * counters of the driver are printed, with the hit rate of the shadow
+ * frame: the share of the dirty lines that were equal to the panel and not
+ * sent. The times are host CPU times, only useful to compare two builds on
+ * the same machine; the wire time is what the frame takes at the SPI clock
+ * of the display.
+ */
+
+#include "pages.h"
+
+/* Counts the bytes of the driver instead of decoding them, to keep the refresh time clean */
+class WireCounter : public HostSpiBus {
+    public:
+        void select(int8_t cs, uint32_t frequency) override {
+            (void) cs;
+            this->frequency = frequency;
+        }
+
+        void deselect() override {}
+
+        void transfer(const uint8_t* data, size_t size) override {
+            (void) data;
+            bytes += size;
+        }
+
+        uint32_t frequency = 0;     // [Hz]
+        uint64_t bytes = 0;         // [B]
+};
+
+typedef struct {
+    uint64_t renderTime;            // [us]
+    uint64_t refreshTime;           // [us]
+    uint64_t pixels;
+    uint64_t lines;
+    uint64_t skipped;
+    uint64_t spiBytes;              // [B]
+    uint64_t frames;
+    uint64_t wireBytes;             // [B]    As seen on the bus
+} page_result_t;
+
+static WireCounter wire;
+static Window window;
+static page_result_t changes[HOST_PAGE_COUNT];     // From the page before
+static page_result_t redraws[HOST_PAGE_COUNT];     // Over the same page
+
+static void renderPage(uint32_t index, page_result_t* results){
+    const host_page_t& page = hostPages[index];
+    page_result_t& result = results[index];
+
+    window.resetDisplayStats();
+    uint64_t bytes = wire.bytes;
+
+    uint32_t start = micros();
+    page.render(window);
+    uint32_t drawn = micros();
+    window.flush(true);
+    uint32_t end = micros();
+
+    const sharpmem_stats_t& stats = window.getDisplay().getStats();
+    result.renderTime += drawn - start;
+    result.refreshTime += end - drawn;
+    result.pixels += stats.pixels;
+    result.lines += stats.lines;
+    result.skipped += stats.skipped;
+    result.spiBytes += stats.spi_bytes;
+    result.frames += stats.frames;
+    result.wireBytes += wire.bytes - bytes;
+}
+
+static void printResults(const char* title, const page_result_t* results, uint32_t rounds){
+    printf("%s, %u rounds, averages per page\n", title, rounds);
+    printf("%-10s %10s %11s %8s %6s %8s %6s %9s %7s %9s\n",
+           "page", "draw[us]", "refresh[us]", "pixels", "lines", "skipped", "hit[%]", "spi[B]", "frames", "wire[us]");
+    for(uint32_t i = 0; i < HOST_PAGE_COUNT; i++){
+        const page_result_t& result = results[i];
+        uint64_t wireTime = wire.frequency ? result.wireBytes * 8 * 1000000 / wire.frequency / rounds : 0;
+        uint64_t dirty = result.lines + result.skipped;
+        printf("%-10s %10.1f %11.1f %8llu %6llu %8.1f %6.1f %9llu %7.2f %9llu\n",
+               hostPages[i].name,
+               (double) result.renderTime / rounds,
+               (double) result.refreshTime / rounds,
+               (unsigned long long) (result.pixels / rounds),
+               (unsigned long long) (result.lines / rounds),
+               result.frames ? (double) result.skipped / result.frames : 0.0,    // Per frame
+               dirty ? 100.0 * result.skipped / dirty : 0.0,
+               (unsigned long long) (result.spiBytes / rounds),
+               (double) result.frames / rounds,
+               (unsigned long long) wireTime);
+    }
+}
+
+int main(int argc, char** argv){
+    uint32_t rounds = (argc > 1) ? strtoul(argv[1], NULL, 10) : 200;
+    if(rounds == 0) rounds = 1;
+
+    setHostSpiBus(&wire);
+    hostBegin(window);
+    window.flush(true);
+
+    for(uint32_t round = 0; round < rounds; round++){
+        for(uint32_t i = 0; i < HOST_PAGE_COUNT; i++){
+            renderPage(i, changes);
+            renderPage(i, redraws);
+        }
+    }
+
+    printResults("Page changes", changes, rounds);
+    printResults("Redraws", redraws, rounds);
+    return 0;
+}
@@ -0,0 +1,115 @@
+/*
+ * Golden image test of the pages
+ *
+ *   display_test <golden dir> [--update]
+ *
+ * Every page of pages.cpp is drawn and sent to the SharpPanel model. The
+ * transactions must follow the panel protocol, the panel must show the
+ * frame buffer and its image must match <golden dir>/<page>.pbm. On a
+ * mismatch the image is written as <page>.actual.pbm into the working
+ * directory. --update writes the goldens instead of comparing.
+ */
+
+#include "pages.h"
+#include "sharp_panel.h"
+
+static SharpPanel panel;
+static Window window;
+
+static bool readFile(const std::string& path, std::vector<uint8_t>* data){
+    FILE* file = fopen(path.c_str(), "rb");
+    if(!file) return false;
+    uint8_t buffer[4096];
+    size_t length;
+    while((length = fread(buffer, 1, sizeof(buffer), file)) > 0){
+        data->insert(data->end(), buffer, buffer + length);
+    }
+    fclose(file);
+    return true;
+}
+
+/* Pixels that differ between two PBM images of the same size */
+static uint32_t countDifferences(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b){
+    uint32_t differences = 0;
+    for(size_t i = 0; i < a.size(); i++){
+        differences += __builtin_popcount(a[i] ^ b[i]);
+    }
+    return differences;
+}
+
+static bool checkPage(const host_page_t& page, const std::string& directory, bool update){
+    uint32_t frames = panel.getFrames();
+    page.render(window);
+    window.flush(true);
+
+    bool passed = true;
+    if(panel.getFrames() != frames + 1){
+        printf("%-10s %u frames sent instead of 1\n", page.name, panel.getFrames() - frames);
+        passed = false;
+    }
+    if(panel.getErrors()){
+        printf("%-10s protocol error: %s\n", page.name, panel.getFirstError().c_str());
+        passed = false;
+    }
+    uint32_t stale = panel.compare(window.getDisplay());
+    if(stale){
+        printf("%-10s %u pixels of the panel differ from the frame buffer\n", page.name, stale);
+        passed = false;
+    }
+
+    std::string golden = directory + "/" + page.name + ".pbm";
+    if(update){
+        if(!panel.writePbm(golden.c_str())){
+            printf("%-10s cannot write %s\n", page.name, golden.c_str());
+            return false;
+        }
+        printf("%-10s updated\n", page.name);
+        return passed;
+    }
+
+    std::vector<uint8_t> expected;
+    std::vector<uint8_t> actual = panel.getPbm();
+    if(!readFile(golden, &expected)){
+        printf("%-10s missing golden %s\n", page.name, golden.c_str());
+        passed = false;
+    } else if(expected.size() != actual.size()){
+        printf("%-10s golden is %u bytes instead of %u\n", page.name, (unsigned) expected.size(), (unsigned) actual.size());
+        passed = false;
+    } else {
+        uint32_t differences = countDifferences(expected, actual);
+        if(differences){
+            printf("%-10s %u pixels differ from the golden\n", page.name, differences);
+            passed = false;
+        }
+    }
+
+    if(!passed){
+        std::string path = std::string(page.name) + ".actual.pbm";
+        panel.writePbm(path.c_str());
+        printf("%-10s FAIL, image written to %s\n", page.name, path.c_str());
+    } else {
+        printf("%-10s ok\n", page.name);
+    }
+    return passed;
+}
+
+int main(int argc, char** argv){
+    if(argc < 2){
+        fprintf(stderr, "Usage: %s <golden dir> [--update]\n", argv[0]);
+        return 2;
+    }
+    std::string directory = argv[1];
+    bool update = (argc > 2) && strcmp(argv[2], "--update") == 0;
+
+    setHostSpiBus(&panel);
+    hostBegin(window);
+    window.flush(true);
+
+    uint32_t failures = 0;
+    for(uint32_t i = 0; i < HOST_PAGE_COUNT; i++){
+        if(!checkPage(hostPages[i], directory, update)) failures++;
+    }
+
+    printf("%u of %u pages failed\n", failures, HOST_PAGE_COUNT);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,154 @@
+/*
+ * Benchmark of the packed icons
+ *
+ *   icon_bench [rounds]
+ *
+ * Every icon is drawn from its PackBits stream in icons.cpp with
+ * drawPackedBitmap and from the uncompressed bitmap in bmp.h with
+ * drawBitmap, byte aligned and at an odd x. Both must give the same image,
+ * otherwise the benchmark fails. Per icon the flash size of both and the
+ * time per draw are printed.
+ */
+
+#include <chrono>
+#include "display.h"
+#include "bmp.h"
+
+#define ICON_WIDTH  400     // [px]
+#define ICON_HEIGHT 240     // [px]
+
+typedef struct {
+    const char* name;
+    const uint8_t* bitmap;          // As in bmp.h, in the order of icon_e
+} icon_source_t;
+
+static const icon_source_t sources[] = {
+    {"rocket_recovery", rocket_recovery},
+    {"house_recovery", house_recovery},
+    {"shift_keyboard", shift_keyboard},
+    {"backspace_keyboard", backspace_keyboard},
+    {"enter_keyboard", enter_keyboard},
+    {"live_lon", live_lon},
+    {"live_lat", live_lat},
+    {"live_speed", live_speed},
+    {"live_altitude", live_altitude},
+    {"live_battery", live_battery},
+    {"live_two", live_two},
+    {"live_one", live_one},
+    {"live_checkmark", live_checkmark},
+    {"live_cross", live_cross},
+    {"bar_memory", bar_memory},
+    {"bar_download", bar_download},
+    {"bar_location", bar_location},
+    {"bar_flash", bar_flash},
+    {"menu_live", menu_live},
+    {"menu_recover", menu_recover},
+    {"menu_testing", menu_testing},
+    {"menu_data", menu_data},
+    {"menu_sensors", menu_sensors},
+    {"menu_settings", menu_settings},
+    {"cats_logo", cats_logo},
+};
+
+static_assert(sizeof(sources) / sizeof(sources[0]) == ICON_COUNT, "bmp.h and icons.h are out of sync, run icon_packer.py");
+
+static SharpDisplay packed(0, 0, 0, ICON_WIDTH, ICON_HEIGHT);
+static SharpDisplay plain(0, 0, 0, ICON_WIDTH, ICON_HEIGHT);
+
+/* [B] Length of the PackBits stream of an icon */
+static uint32_t packedSize(const packed_icon_t& icon){
+    const uint8_t* data = &iconData[icon.offset];
+    uint32_t total = (uint32_t) (icon.width + 7) / 8 * icon.height;
+    uint32_t index = 0, length = 0;
+    while(index < total){
+        int8_t n = (int8_t) data[length++];
+        if(n == -128) continue;
+        if(n >= 0){
+            index += n + 1;
+            length += n + 1;
+        } else {
+            index += 1 - n;
+            length++;
+        }
+    }
+    return length;
+}
+
+/* [ns] Time per draw */
+static double timeDraw(SharpDisplay& display, void (*draw)(SharpDisplay&, uint32_t, int16_t), uint32_t icon, int16_t x, uint32_t rounds){
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for(uint32_t i = 0; i < rounds; i++){
+        draw(display, icon, x);
+    }
+    uint64_t time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    return (double) time / rounds;
+}
+
+static void drawPacked(SharpDisplay& display, uint32_t icon, int16_t x){
+    display.drawIcon(x, 20, (icon_e) icon, 0);
+}
+
+static void drawPlain(SharpDisplay& display, uint32_t icon, int16_t x){
+    const packed_icon_t& entry = iconTable[icon];
+    display.drawBitmap(x, 20, sources[icon].bitmap, entry.width, entry.height, 0);
+}
+
+static bool sameImage(){
+    uint8_t rowA[ICON_WIDTH / 8], rowB[ICON_WIDTH / 8];
+    for(int16_t y = 0; y < ICON_HEIGHT; y++){
+        packed.getPbmRow(y, rowA);
+        plain.getPbmRow(y, rowB);
+        if(memcmp(rowA, rowB, sizeof(rowA)) != 0) return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv){
+    uint32_t rounds = (argc > 1) ? strtoul(argv[1], NULL, 10) : 20000;
+    if(rounds == 0) rounds = 1;
+
+    packed.begin();
+    plain.begin();
+
+    const int16_t positions[] = {16, 21};       // Byte aligned and shifted
+    uint32_t failures = 0;
+    uint32_t rawTotal = 0, packedTotal = 0;
+    double plainTotal[2] = {}, packedTimeTotal[2] = {};
+
+    printf("%u rounds, time per draw\n", rounds);
+    printf("%-19s %7s %6s %7s %13s %13s %13s %13s\n", "icon", "size", "raw[B]", "pack[B]",
+           "bitmap[ns]", "packed[ns]", "bitmap+5[ns]", "packed+5[ns]");
+    for(uint32_t i = 0; i < ICON_COUNT; i++){
+        const packed_icon_t& entry = iconTable[i];
+        uint32_t raw = (uint32_t) (entry.width + 7) / 8 * entry.height;
+        uint32_t size = packedSize(entry);
+        rawTotal += raw;
+        packedTotal += size;
+
+        double times[2][2];
+        for(uint32_t p = 0; p < 2; p++){
+            packed.clearDisplayBuffer();
+            plain.clearDisplayBuffer();
+            drawPacked(packed, i, positions[p]);
+            drawPlain(plain, i, positions[p]);
+            if(!sameImage()){
+                printf("%-19s FAIL, drawPackedBitmap and drawBitmap differ at x %d\n", sources[i].name, positions[p]);
+                failures++;
+            }
+            times[p][0] = timeDraw(plain, drawPlain, i, positions[p], rounds);
+            times[p][1] = timeDraw(packed, drawPacked, i, positions[p], rounds);
+            plainTotal[p] += times[p][0];
+            packedTimeTotal[p] += times[p][1];
+        }
+
+        char dimensions[12];
+        snprintf(dimensions, sizeof(dimensions), "%ux%u", entry.width, entry.height);
+        printf("%-19s %7s %6u %7u %13.0f %13.0f %13.0f %13.0f\n", sources[i].name, dimensions, raw, size,
+               times[0][0], times[0][1], times[1][0], times[1][1]);
+    }
+    printf("%-19s %7s %6u %7u %13.0f %13.0f %13.0f %13.0f\n", "all", "", rawTotal, packedTotal,
+           plainTotal[0], packedTimeTotal[0], plainTotal[1], packedTimeTotal[1]);
+    printf("Flash %u B packed from %u B (%.0f %%), plus %u B index\n", packedTotal, rawTotal,
+           100.0 * packedTotal / rawTotal, (unsigned) sizeof(iconTable));
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,119 @@
+/*
+ * Test of the settings keyboard
+ *
+ *   keyboard_test
+ *
+ * A phrase is typed into a setting like with the buttons: the highlight is
+ * moved key by key to every character, shift is pressed where the case
+ * changes, backspace removes the old text and enter stores the result. The
+ * stored setting must be the phrase, cut at the length of the setting.
+ * Every step is drawn with Window::updateKeyboard as the render task does,
+ * and the final image must equal a full initKeyboard of the final state.
+ */
+
+#include <ctype.h>
+#include "sharp_panel.h"
+#include "pages.h"
+
+static SharpPanel panel;
+static Window window;
+static Keyboard keyboard;
+static char setting[KEYBOARD_TEXT_LENGTH + 1] = "CATS";
+static uint32_t failures = 0;
+
+static void fail(const char* name, const char* text){
+    printf("%-14s FAIL, %s\n", name, text);
+    failures++;
+}
+
+/* Draws the result of a button like Hmi::settings, stores on enter */
+static void handle(keyboard_event_e event){
+    if(event == KEYBOARD_DONE){
+        keyboard.store(setting);
+    } else if(event != KEYBOARD_NONE){
+        window.updateKeyboard(keyboard.getText(), keyboard.getKey(), keyboard.isUpperCase());
+        window.flush(true);
+    }
+}
+
+static int32_t keyRow(int32_t key){
+    if(key == KEYBOARD_BACKSPACE) return -1;
+    if(key < 10) return 0;
+    if(key < 20) return 1;
+    if(key < 29) return 2;
+    return 3;
+}
+
+/* Moves the highlight with the arrow buttons only */
+static bool moveTo(int32_t target){
+    for(uint32_t steps = 0; steps < 20; steps++){
+        int32_t key = keyboard.getKey();
+        if(key == target) return true;
+        int32_t row = keyRow(key), targetRow = keyRow(target);
+        if(targetRow < row) handle(keyboard.moveUp());
+        else if(targetRow > row) handle(keyboard.moveDown());
+        else if(target < key) handle(keyboard.moveLeft());
+        else handle(keyboard.moveRight());
+    }
+    return false;
+}
+
+static void press(int32_t key){
+    if(!moveTo(key)){
+        fail("navigation", "key not reached");
+        return;
+    }
+    handle(keyboard.press());
+}
+
+static void type(char c){
+    if(isalpha(c) && (isupper(c) != 0) != keyboard.isUpperCase()){
+        press(KEYBOARD_SHIFT);
+    }
+    for(int32_t key = 0; key < KEYBOARD_KEYS; key++){
+        if(key != KEYBOARD_SHIFT && key != KEYBOARD_ENTER && keyboardChars[key] == toupper(c)){
+            press(key);
+            return;
+        }
+    }
+    fail("type", "character not on the keyboard");
+}
+
+int main(){
+    setHostSpiBus(&panel);
+    hostBegin(window);
+
+    keyboard.begin(setting, KEYBOARD_TEXT_LENGTH);
+    window.initKeyboard(keyboard.getText(), keyboard.getKey(), keyboard.isUpperCase());
+    window.flush(true);
+
+    // "CATS" to "CA", then more than fits
+    press(KEYBOARD_BACKSPACE);
+    press(KEYBOARD_BACKSPACE);
+    const char* phrase = "tx42QWE";
+    for(const char* c = phrase; *c; c++){
+        type(*c);
+    }
+
+    if(strcmp(setting, "CATS") != 0) fail("before enter", "setting changed while typing");
+    press(KEYBOARD_ENTER);
+    if(strcmp(setting, "CAtx42QW") != 0){
+        char text[64];
+        snprintf(text, sizeof(text), "stored \"%s\" instead of \"CAtx42QW\"", setting);
+        fail("stored", text);
+    } else {
+        printf("%-14s ok, \"%s\"\n", "stored", setting);
+    }
+
+    // The updates must leave the same image as drawing the final state at once
+    std::vector<uint8_t> updated = panel.getPbm();
+    window.initKeyboard(keyboard.getText(), keyboard.getKey(), keyboard.isUpperCase());
+    window.flush(true);
+    std::vector<uint8_t> full = panel.getPbm();
+    if(panel.getErrors()) fail("panel", panel.getFirstError().c_str());
+    if(updated != full) fail("image", "updates differ from a full redraw");
+    else printf("%-14s ok\n", "image");
+
+    printf("%u checks failed\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,60 @@
+/*
+ * Benchmark of the compile time rotation
+ *
+ *   menu_bench [rounds]
+ *
+ * Built twice, as menu_bench with SHARPMEM_ROTATION=0 like platformio.ini
+ * and as menu_bench_runtime with -1, the runtime setRotation() of
+ * Adafruit_GFX. Run both on the same machine and compare: the full render
+ * of Window::initMenu, and drawPixel over the whole panel, the path the
+ * rotation policy removes the switch from.
+ */
+
+#include <chrono>
+#include "pages.h"
+
+#define MENU_WIDTH  400     // [px]
+#define MENU_HEIGHT 240     // [px]
+
+static Window window;
+static Adafruit_SharpMem pixels(SHARP_SCK, SHARP_MOSI, SHARP_SS, MENU_WIDTH, MENU_HEIGHT);
+
+static uint64_t elapsed(std::chrono::steady_clock::time_point start){
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv){
+    uint32_t rounds = (argc > 1) ? strtoul(argv[1], NULL, 10) : 2000;
+    if(rounds == 0) rounds = 1;
+
+    hostBegin(window);          // No SPI bus, the frames are dropped
+    window.flush(true);
+
+    // Alternate the highlighted entry so every round redraws the whole page
+    uint64_t menuTime = 0;
+    for(uint32_t i = 0; i < rounds; i++){
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        window.initMenu(i % 6);
+        menuTime += elapsed(start);
+        window.flush(true);
+    }
+
+    pixels.begin();
+    pixels.setRotation(0);
+    uint64_t pixelTime = 0;
+    for(uint32_t i = 0; i < rounds; i++){
+        uint16_t color = i & 1;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for(int16_t y = 0; y < MENU_HEIGHT; y++){
+            for(int16_t x = 0; x < MENU_WIDTH; x++){
+                pixels.drawPixel(x, y, color);
+            }
+        }
+        pixelTime += elapsed(start);
+    }
+
+    printf("SHARPMEM_ROTATION=%d, %u rounds\n", SHARPMEM_ROTATION, rounds);
+    printf("initMenu  %10.1f us\n", menuTime / 1000.0 / rounds);
+    printf("drawPixel %10.2f ns/px\n", (double) pixelTime / rounds / (MENU_WIDTH * MENU_HEIGHT));
+    return 0;
+}
@@ -0,0 +1,68 @@
+#include "pages.h"
+
+static Navigation navigation;       // No sensors and no target fix
+
+static void renderMenu(Window& window){
+    window.initMenu(0);
+}
+
+static void renderLive(Window& window){
+    packedRXMessage message = {};
+    message.state = 4;              // COAST
+    message.timestamp = 1234;
+    message.lat = 473765;
+    message.lon = 85432;
+    message.altitude = 1520;
+    message.velocity = 87;
+    message.voltage = 81;
+    message.pyro_continuity = 3;
+
+    TelemetryInfoData link = {};
+    link.lq = 98;
+    link.rssi = -72;
+    link.snr = 9;
+
+    TelemetryData data;
+    TelemetryInfo info;
+    data.commit((uint8_t*) &message, sizeof(message));
+    info.commit((uint8_t*) &link, sizeof(link));
+
+    window.initLive();
+    window.updateLive(&data, &info, 0);     // The age field is 0 right after a packet
+}
+
+static void renderRecovery(Window& window){
+    window.initRecovery();
+    recovery_snapshot_t snapshot;
+    navigation.getRecoverySnapshot(0, &snapshot);
+    window.updateRecovery(snapshot);
+}
+
+static void renderTesting(Window& window){
+    window.initTesting();
+}
+
+static void renderSettings(Window& window){
+    window.initSettings(0);
+    window.updateSettings(0);
+}
+
+static void renderKeyboard(Window& window){
+    window.initKeyboard("CATS", 0, true);
+    window.updateKeyboard("CATS", 0, true);
+}
+
+const host_page_t hostPages[HOST_PAGE_COUNT] = {
+    {"menu", renderMenu},
+    {"live", renderLive},
+    {"recovery", renderRecovery},
+    {"testing", renderTesting},
+    {"settings", renderSettings},
+    {"keyboard", renderKeyboard},
+};
+
+void hostBegin(Window& window){
+    window.begin();
+    window.initBar();
+    window.updateBar(3.9f, true);
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+/*
+ * The pages of the groundstation as the HMI draws them, for the golden tests
+ * and the benchmarks of the host build. The pages are rendered in the order
+ * of the table into one Window with the status bar on top, like on the
+ * device; each page starts from the image of the one before.
+ */
+
+#include "window.h"
+
+typedef struct {
+    const char* name;
+    void (*render)(Window& window);
+} host_page_t;
+
+#define HOST_PAGE_COUNT 6
+
+extern const host_page_t hostPages[HOST_PAGE_COUNT];
+
+/* Starts the display and draws the status bar the pages are drawn below */
+void hostBegin(Window& window);
@@ -0,0 +1,289 @@
+/*
+ * Randomized test of the drawing primitives
+ *
+ *   primitive_test [iterations] [seed]
+ *
+ * drawFastHLine, drawFastVLine, fillRect, drawBitmap, drawMask and
+ * scrollLeft of the driver are called with random positions, sizes and
+ * data, partly outside of the panel, and compared with the same operation
+ * done pixel by pixel with drawPixel on a second driver. After every call
+ * the frame buffers must be equal and the refresh must send every line that
+ * changed but none outside of the rows of the operation. The time of both
+ * implementations is printed per primitive. Build with HOST_SANITIZE to
+ * catch reads and writes past the buffers.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include "sharp_panel.h"
+#include "window.h"
+
+#define PRIMITIVE_WIDTH     400     // [px]
+#define PRIMITIVE_HEIGHT    240     // [px]
+#define PRIMITIVE_STRIDE    (PRIMITIVE_WIDTH / 8)   // [B]
+
+typedef enum {
+    PRIMITIVE_HLINE,
+    PRIMITIVE_VLINE,
+    PRIMITIVE_RECT,
+    PRIMITIVE_BITMAP,
+    PRIMITIVE_MASK,
+    PRIMITIVE_SCROLL,
+    PRIMITIVE_COUNT
+} primitive_e;
+
+static const char* const primitiveName[PRIMITIVE_COUNT] = {
+    "drawFastHLine", "drawFastVLine", "fillRect", "drawBitmap", "drawMask", "scrollLeft"
+};
+
+typedef struct {
+    primitive_e type;
+    int16_t x, y, w, h;
+    int16_t n;                      // [px]   Scroll distance
+    uint16_t stride;                // [B]    Mask row length
+    uint16_t color;
+    std::vector<uint8_t> data;      // Bitmap or mask
+} primitive_t;
+
+typedef struct {
+    uint32_t calls;
+    uint64_t fastTime;              // [ns]
+    uint64_t referenceTime;         // [ns]
+} primitive_result_t;
+
+static SharpPanel panel(PRIMITIVE_WIDTH, PRIMITIVE_HEIGHT);
+static Adafruit_SharpMem fast(SHARP_SCK, SHARP_MOSI, SHARP_SS, PRIMITIVE_WIDTH, PRIMITIVE_HEIGHT);
+static Adafruit_SharpMem reference(SHARP_SCK, SHARP_MOSI, SHARP_SS, PRIMITIVE_WIDTH, PRIMITIVE_HEIGHT);
+static primitive_result_t results[PRIMITIVE_COUNT];
+static uint64_t state;
+
+/* xorshift64, the same seed gives the same operations on every machine */
+static uint32_t next(){
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state >> 32;
+}
+
+static int32_t range(int32_t min, int32_t max){
+    return min + (int32_t) (next() % (uint32_t) (max - min + 1));
+}
+
+static primitive_t randomPrimitive(){
+    primitive_t p = {};
+    p.type = (primitive_e) range(0, PRIMITIVE_COUNT - 1);
+    p.color = next() & 1;
+    p.x = range(-40, PRIMITIVE_WIDTH + 8);
+    p.y = range(-40, PRIMITIVE_HEIGHT + 8);
+    p.w = (next() & 3) ? range(0, 80) : range(0, PRIMITIVE_WIDTH + 50);
+    p.h = (next() & 3) ? range(0, 40) : range(0, PRIMITIVE_HEIGHT + 50);
+
+    switch(p.type){
+        case PRIMITIVE_BITMAP: {
+            // Wider than SHARPMEM_BLIT_MAX_BYTES now and then for the Adafruit_GFX fallback
+            p.w = range(1, 8 * SHARPMEM_BLIT_MAX_BYTES + 24);
+            p.h = range(1, 48);
+            if(next() & 1){
+                p.x = range(0, PRIMITIVE_WIDTH - p.w);
+                p.y = range(0, PRIMITIVE_HEIGHT - p.h);
+            }
+            p.data.resize((size_t) (p.w + 7) / 8 * p.h);
+            for(uint8_t& b : p.data) b = next();
+            break;
+        }
+        case PRIMITIVE_MASK: {
+            // Wider than SHARPMEM_CLIP_MAX_BYTES now and then for the drawPixel fallback
+            p.w = (next() & 7) ? range(1, 64) : range(1, 8 * SHARPMEM_CLIP_MAX_BYTES + 40);
+            p.h = range(1, 48);
+            p.stride = (p.w + 7) / 8 + range(0, 2);
+            p.data.assign((size_t) p.stride * p.h, 0);
+            for(int16_t r = 0; r < p.h; r++){
+                for(int16_t c = 0; c < p.w; c++){
+                    if(next() & 1) p.data[r * p.stride + c / 8] |= 1 << (c & 7);   // Unused bits stay zero
+                }
+            }
+            break;
+        }
+        case PRIMITIVE_SCROLL: {
+            // Only rectangles on the panel are scrolled, n >= w fills
+            p.x = range(0, PRIMITIVE_WIDTH - 1);
+            p.y = range(0, PRIMITIVE_HEIGHT - 1);
+            p.w = range(1, PRIMITIVE_WIDTH - p.x);
+            p.h = range(1, PRIMITIVE_HEIGHT - p.y);
+            p.n = range(1, p.w + 4);
+            break;
+        }
+        default:
+            break;
+    }
+    return p;
+}
+
+static void drawFast(const primitive_t& p){
+    switch(p.type){
+        case PRIMITIVE_HLINE:  fast.drawFastHLine(p.x, p.y, p.w, p.color); break;
+        case PRIMITIVE_VLINE:  fast.drawFastVLine(p.x, p.y, p.h, p.color); break;
+        case PRIMITIVE_RECT:   fast.fillRect(p.x, p.y, p.w, p.h, p.color); break;
+        case PRIMITIVE_BITMAP: fast.drawBitmap(p.x, p.y, p.data.data(), p.w, p.h, p.color); break;
+        case PRIMITIVE_MASK:   fast.drawMask(p.x, p.y, p.data.data(), p.w, p.h, p.stride, p.color); break;
+        case PRIMITIVE_SCROLL: fast.scrollLeft(p.x, p.y, p.w, p.h, p.n, p.color); break;
+        default: break;
+    }
+}
+
+static void fillReference(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color){
+    for(int16_t r = 0; r < h; r++){
+        for(int16_t c = 0; c < w; c++){
+            reference.drawPixel(x + c, y + r, color);
+        }
+    }
+}
+
+static void drawReference(const primitive_t& p){
+    switch(p.type){
+        case PRIMITIVE_HLINE:
+            fillReference(p.x, p.y, p.w, 1, p.color);
+            break;
+        case PRIMITIVE_VLINE:
+            fillReference(p.x, p.y, 1, p.h, p.color);
+            break;
+        case PRIMITIVE_RECT:
+            fillReference(p.x, p.y, p.w, p.h, p.color);
+            break;
+        case PRIMITIVE_BITMAP: {
+            uint16_t bytes = (p.w + 7) / 8;
+            for(int16_t r = 0; r < p.h; r++){
+                for(int16_t c = 0; c < p.w; c++){
+                    if(p.data[r * bytes + c / 8] & (0x80 >> (c & 7))) reference.drawPixel(p.x + c, p.y + r, p.color);
+                }
+            }
+            break;
+        }
+        case PRIMITIVE_MASK:
+            for(int16_t r = 0; r < p.h; r++){
+                for(int16_t c = 0; c < p.w; c++){
+                    if(p.data[r * p.stride + c / 8] & (1 << (c & 7))) reference.drawPixel(p.x + c, p.y + r, p.color);
+                }
+            }
+            break;
+        case PRIMITIVE_SCROLL: {
+            int16_t kept = (p.n < p.w) ? p.w - p.n : 0;
+            for(int16_t r = p.y; r < p.y + p.h; r++){
+                for(int16_t c = p.x; c < p.x + kept; c++){
+                    reference.drawPixel(c, r, reference.getPixel(c + p.n, r));     // The source is right of c, not written yet
+                }
+            }
+            fillReference(p.x + kept, p.y, p.w - kept, p.h, p.color);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+/* Rows the primitive may mark dirty, [first, last] clipped to the panel */
+static void primitiveRows(const primitive_t& p, int16_t* first, int16_t* last){
+    int16_t height = (p.type == PRIMITIVE_HLINE) ? 1 : p.h;
+    *first = std::max<int16_t>(p.y, 0);
+    *last = std::min<int16_t>(p.y + height, PRIMITIVE_HEIGHT) - 1;
+    if(p.type == PRIMITIVE_HLINE && p.w <= 0) *last = *first - 1;
+    if(p.type == PRIMITIVE_VLINE && (p.x < 0 || p.x >= PRIMITIVE_WIDTH)) *last = *first - 1;
+}
+
+static void snapshot(const Adafruit_SharpMem& display, std::vector<uint8_t>& image){
+    image.resize(PRIMITIVE_HEIGHT * PRIMITIVE_STRIDE);
+    for(int16_t y = 0; y < PRIMITIVE_HEIGHT; y++){
+        display.getPbmRow(y, &image[y * PRIMITIVE_STRIDE]);
+    }
+}
+
+static bool rowEqual(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, int16_t y){
+    return memcmp(&a[y * PRIMITIVE_STRIDE], &b[y * PRIMITIVE_STRIDE], PRIMITIVE_STRIDE) == 0;
+}
+
+static void describe(const primitive_t& p){
+    printf("  %s x %d y %d w %d h %d n %d stride %u color %u\n", primitiveName[p.type], p.x, p.y, p.w, p.h, p.n, p.stride, p.color);
+}
+
+static uint64_t elapsed(std::chrono::steady_clock::time_point start){
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv){
+    uint32_t iterations = (argc > 1) ? strtoul(argv[1], NULL, 10) : 20000;
+    uint64_t seed = (argc > 2) ? strtoull(argv[2], NULL, 10) : 1;
+    state = seed ? seed : 1;
+
+    setHostSpiBus(&panel);
+    fast.begin();
+    reference.begin();
+    fast.clearDisplay();
+    reference.clearDisplayBuffer();
+
+    std::vector<uint8_t> before, after, expected;
+    snapshot(fast, before);
+
+    uint32_t failures = 0;
+    for(uint32_t i = 0; i < iterations && failures < 10; i++){
+        primitive_t p = randomPrimitive();
+        primitive_result_t& result = results[p.type];
+        result.calls++;
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        drawFast(p);
+        result.fastTime += elapsed(start);
+
+        start = std::chrono::steady_clock::now();
+        drawReference(p);
+        result.referenceTime += elapsed(start);
+
+        snapshot(fast, after);
+        snapshot(reference, expected);
+        if(after != expected){
+            uint32_t differences = 0;
+            for(size_t j = 0; j < after.size(); j++) differences += __builtin_popcount(after[j] ^ expected[j]);
+            printf("Iteration %u: %u pixels differ from drawPixel\n", i, differences);
+            describe(p);
+            failures++;
+        }
+
+        // The refresh sends exactly the dirty lines, the shadow frame is off
+        fast.refresh();
+        const std::vector<uint16_t>& sent = panel.getLastFrame().lines;
+        int16_t first, last;
+        primitiveRows(p, &first, &last);
+        for(int16_t y = 0; y < PRIMITIVE_HEIGHT; y++){
+            bool dirty = std::find(sent.begin(), sent.end(), y + 1) != sent.end();
+            if(!dirty && !rowEqual(before, after, y)){
+                printf("Iteration %u: line %d changed but is not dirty\n", i, y);
+                describe(p);
+                failures++;
+                break;
+            }
+            if(dirty && (y < first || y > last)){
+                printf("Iteration %u: line %d dirty outside of rows %d to %d\n", i, y, first, last);
+                describe(p);
+                failures++;
+                break;
+            }
+        }
+        before.swap(after);
+    }
+
+    if(panel.getErrors()){
+        printf("Protocol error: %s\n", panel.getFirstError().c_str());
+        failures++;
+    }
+
+    printf("%u iterations, seed %llu\n", iterations, (unsigned long long) seed);
+    printf("%-14s %7s %12s %14s %8s\n", "primitive", "calls", "fast[ns]", "drawPixel[ns]", "speedup");
+    for(uint32_t i = 0; i < PRIMITIVE_COUNT; i++){
+        const primitive_result_t& result = results[i];
+        if(result.calls == 0) continue;
+        printf("%-14s %7u %12.0f %14.0f %7.1fx\n", primitiveName[i], result.calls,
+               (double) result.fastTime / result.calls, (double) result.referenceTime / result.calls,
+               result.fastTime ? (double) result.referenceTime / result.fastTime : 0.0);
+    }
+    printf("%u checks failed\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,165 @@
+#include "sharp_panel.h"
+
+SharpPanel::SharpPanel(uint16_t width, uint16_t height) :
+    width(width), height(height), stride(width / 8), memory((size_t) height * (width / 8), 0xff) {}
+
+void SharpPanel::select(int8_t cs, uint32_t frequency){
+    (void) cs;
+    if(selected){
+        error("Transaction started while selected");
+    }
+    selected = true;
+    this->frequency = frequency;
+    received.clear();
+    frame = {};
+}
+
+void SharpPanel::transfer(const uint8_t* data, size_t size){
+    if(!selected){
+        error("%u bytes sent without chip select", (unsigned) size);
+        return;
+    }
+    received.insert(received.end(), data, data + size);
+    frame.transfers++;
+    frame.transferSizes.push_back(size);
+}
+
+void SharpPanel::deselect(){
+    if(!selected){
+        error("Transaction ended while not selected");
+        return;
+    }
+    selected = false;
+    decode();
+    frames++;
+}
+
+void SharpPanel::decode(){
+    frame.bytes = received.size();
+    if(received.empty()){
+        error("Empty transaction");
+        return;
+    }
+    frame.mode = received[0];
+
+    // The driver toggles VCOM with every command, so the panel never sees a DC bias
+    bool bit = frame.mode & SHARP_PANEL_MODE_VCOM;
+    if(vcomKnown && bit == vcom){
+        error("VCOM not toggled in frame %u", frames);
+    }
+    vcomKnown = true;
+    vcom = bit;
+
+    if(frame.mode & SHARP_PANEL_MODE_CLEAR){
+        if(received.size() != 2 || received[1] != 0){
+            error("Clear command of %u bytes", (unsigned) received.size());
+        }
+        std::fill(memory.begin(), memory.end(), 0xff);
+        return;
+    }
+
+    if(!(frame.mode & SHARP_PANEL_MODE_WRITE)){
+        if(received.size() != 2 || received[1] != 0){
+            error("Display mode command of %u bytes", (unsigned) received.size());
+        }
+        return;
+    }
+
+    size_t position = 1;
+    uint16_t previous = 0;
+    while(received.size() - position >= (size_t) stride + 2){
+        uint16_t address = received[position];
+        if(address < 1 || address > height){
+            error("Line address %u out of range", address);
+            return;
+        }
+        if(received[position + 1 + stride] != 0){
+            error("Missing trailer after line %u", address);
+        }
+        memcpy(&memory[(address - 1) * stride], &received[position + 1], stride);
+        if(frame.lines.empty() || address != previous + 1){
+            frame.runs++;
+        }
+        frame.lines.push_back(address);
+        previous = address;
+        position += stride + 2;
+    }
+
+    if(frame.lines.empty()){
+        error("Write command without lines");
+    }
+    if(received.size() - position != 1 || received[position] != 0){
+        error("Write command ends with %u bytes instead of the trailer", (unsigned)(received.size() - position));
+    }
+}
+
+uint8_t SharpPanel::getPixel(uint16_t x, uint16_t y) const {
+    return (memory[y * stride + x / 8] >> (x & 7)) & 1;
+}
+
+uint32_t SharpPanel::compare(const Adafruit_SharpMem& display) const {
+    uint32_t differences = 0;
+    std::vector<uint8_t> row(stride);
+    for(uint16_t y = 0; y < height; y++){
+        display.getPbmRow(y, row.data());
+        for(uint16_t x = 0; x < width; x++){
+            uint8_t black = (row[x / 8] >> (7 - (x & 7))) & 1;
+            if(black == getPixel(x, y)) differences++;
+        }
+    }
+    return differences;
+}
+
+std::vector<uint8_t> SharpPanel::getPbm() const {
+    char header[32];
+    int length = snprintf(header, sizeof(header), "P4\n%u %u\n", width, height);
+    std::vector<uint8_t> pbm(header, header + length);
+
+    for(uint16_t y = 0; y < height; y++){
+        for(uint16_t i = 0; i < stride; i++){
+            uint8_t bits = memory[y * stride + i];
+            uint8_t reversed = 0;
+            for(uint8_t b = 0; b < 8; b++){
+                reversed |= ((bits >> b) & 1) << (7 - b);
+            }
+            pbm.push_back(~reversed);   // PBM is MSB first with 1 for black
+        }
+    }
+    return pbm;
+}
+
+std::vector<uint16_t> SharpPanel::differingLines(const Adafruit_SharpMem& display) const {
+    std::vector<uint16_t> lines;
+    std::vector<uint8_t> row(stride);
+    for(uint16_t y = 0; y < height; y++){
+        display.getPbmRow(y, row.data());
+        for(uint16_t x = 0; x < width; x++){
+            uint8_t black = (row[x / 8] >> (7 - (x & 7))) & 1;
+            if(black == getPixel(x, y)){
+                lines.push_back(y + 1);
+                break;
+            }
+        }
+    }
+    return lines;
+}
+
+bool SharpPanel::writePbm(const char* path) const {
+    FILE* file = fopen(path, "wb");
+    if(!file) return false;
+
+    std::vector<uint8_t> pbm = getPbm();
+    size_t written = fwrite(pbm.data(), 1, pbm.size(), file);
+    return (fclose(file) == 0) && written == pbm.size();
+}
+
+void SharpPanel::error(const char* format, ...){
+    char text[96];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    if(errors++ == 0){
+        firstError = text;
+    }
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+/*
+ * Model of a Sharp memory LCD on the host SPI bus. Every transaction of the
+ * driver is decoded like the panel does it: a mode byte, then for a write
+ * the lines as address byte, WIDTH / 8 data bytes and a trailer byte, and
+ * one more trailer byte after the last line. The decoded lines go into the
+ * panel memory, so what the panel would show can be compared with the frame
+ * buffer and written as a PBM image. Protocol violations are counted, the
+ * first one is kept as text.
+ */
+
+#include <Adafruit_SharpMem.h>
+#include <string>
+#include <vector>
+
+#define SHARP_PANEL_MODE_WRITE  0x01
+#define SHARP_PANEL_MODE_VCOM   0x02
+#define SHARP_PANEL_MODE_CLEAR  0x04
+
+/* One transaction, i.e. one refresh() or clearDisplay() of the driver */
+typedef struct {
+    uint8_t mode;                       // First byte
+    uint32_t bytes;                     // [B]
+    uint32_t transfers;                 // [#]    transfer() calls of the driver
+    uint32_t runs;                      // [#]    Blocks of consecutive line addresses
+    std::vector<uint16_t> lines;        // [#]    Addresses in the order sent, starting at 1
+    std::vector<uint32_t> transferSizes;    // [B]
+} sharp_panel_frame_t;
+
+class SharpPanel : public HostSpiBus {
+    public:
+        SharpPanel(uint16_t width = 400, uint16_t height = 240);
+
+        void select(int8_t cs, uint32_t frequency) override;
+        void deselect() override;
+        void transfer(const uint8_t* data, size_t size) override;
+
+        /* 1 for a white pixel like the frame buffer */
+        uint8_t getPixel(uint16_t x, uint16_t y) const;
+
+        /* Number of pixels that differ from the frame buffer of the driver */
+        uint32_t compare(const Adafruit_SharpMem& display) const;
+
+        /* Addresses of the lines that differ from the frame buffer, starting at 1 */
+        std::vector<uint16_t> differingLines(const Adafruit_SharpMem& display) const;
+
+        /* Binary PBM (P4) of the panel image */
+        std::vector<uint8_t> getPbm() const;
+        bool writePbm(const char* path) const;
+
+        const sharp_panel_frame_t& getLastFrame() const {
+            return frame;
+        }
+
+        /* [us] Transfer time of the last frame at the SPI clock of the driver */
+        uint32_t getWireTime() const {
+            return frequency ? (uint64_t) frame.bytes * 8 * 1000000 / frequency : 0;
+        }
+
+        uint32_t getFrames() const {
+            return frames;
+        }
+
+        uint32_t getErrors() const {
+            return errors;
+        }
+
+        const std::string& getFirstError() const {
+            return firstError;
+        }
+
+    private:
+        void decode();
+        void error(const char* format, ...);
+
+        const uint16_t width, height;
+        const uint16_t stride;          // [B]    Data bytes per line
+        std::vector<uint8_t> memory;    // Panel lines in wire order, LSB first
+        std::vector<uint8_t> received;  // Bytes of the current transaction
+
+        bool selected = false;
+        bool vcomKnown = false;
+        bool vcom = false;
+        uint32_t frequency = 0;         // [Hz]
+        sharp_panel_frame_t frame = {};
+        uint32_t frames = 0;
+        uint32_t errors = 0;
+        std::string firstError;
+};
@@ -0,0 +1,140 @@
+/*
+ * CATS Flight Software
+ * Copyright (C) 2022 Control and Telemetry Systems
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "stream_reader.h"
+
+#include <cstring>
+
+namespace cats {
+
+size_t StreamReader::feed(const uint8_t* data, size_t length) {
+    size_t decoded = 0;
+    for (size_t i = 0; i < length; i++) {
+        uint8_t ch = data[i];
+        if (ch == TELEMETRY_STREAM_DELIMITER) {
+            if (overflow) {
+                stats.framingErrors++;
+            } else if (frameLength > 0 && processFrame()) {
+                decoded++;
+            }
+            frameLength = 0;
+            overflow = false;
+        } else if (frameLength < sizeof(frame)) {
+            frame[frameLength++] = ch;
+        } else {
+            overflow = true;
+        }
+    }
+    return decoded;
+}
+
+void StreamReader::reset() {
+    frameLength = 0;
+    overflow = false;
+    sequenceValid = false;
+    timestampValid = false;
+}
+
+bool StreamReader::processFrame() {
+    uint8_t raw[TELEMETRY_STREAM_MAX_RAW];
+    size_t length = decode(frame, frameLength, raw, sizeof(raw));
+
+    if (length < sizeof(telemetry_stream_header_t) + TELEMETRY_STREAM_CRC_SIZE) {
+        stats.framingErrors++;
+        return false;
+    }
+
+    StreamRecord record = {};
+    memcpy(&record.header, raw, sizeof(record.header));
+    size_t expected = sizeof(record.header) + record.header.length + TELEMETRY_STREAM_CRC_SIZE;
+    if (record.header.version != TELEMETRY_STREAM_VERSION || record.header.length > TELEMETRY_STREAM_MAX_PAYLOAD ||
+        length != expected) {
+        stats.framingErrors++;
+        return false;
+    }
+
+    size_t crcOffset = length - TELEMETRY_STREAM_CRC_SIZE;
+    uint32_t crc = (uint32_t)raw[crcOffset] | ((uint32_t)raw[crcOffset + 1] << 8) |
+                   ((uint32_t)raw[crcOffset + 2] << 16) | ((uint32_t)raw[crcOffset + 3] << 24);
+    if (crc != crc32(raw, crcOffset)) {
+        stats.crcErrors++;
+        return false;
+    }
+
+    memcpy(record.payload, raw + sizeof(record.header), record.header.length);
+
+    if (sequenceValid) {
+        stats.lostRecords += (uint16_t)(record.header.sequence - lastSequence - 1);
+    }
+    sequenceValid = true;
+    lastSequence = record.header.sequence;
+
+    if (timestampValid && record.header.timestamp < lastTimestamp) {
+        timestampHigh += (uint64_t)1 << 32;
+    }
+    timestampValid = true;
+    lastTimestamp = record.header.timestamp;
+    record.timestamp = timestampHigh | record.header.timestamp;
+
+    stats.records++;
+    if (handler) {
+        handler(record);
+    }
+    return true;
+}
+
+/* Inverse of the consistent overhead byte stuffing in TelemetryStream::encode, returns 0 on error */
+size_t StreamReader::decode(const uint8_t* src, size_t length, uint8_t* dst, size_t capacity) {
+    size_t readIndex = 0;
+    size_t writeIndex = 0;
+
+    while (readIndex < length) {
+        uint8_t code = src[readIndex];
+        if (code == 0 || readIndex + code > length) {
+            return 0;
+        }
+        readIndex++;
+        for (uint8_t i = 1; i < code; i++) {
+            if (writeIndex >= capacity) {
+                return 0;
+            }
+            dst[writeIndex++] = src[readIndex++];
+        }
+        if (code != 0xFF && readIndex != length) {
+            if (writeIndex >= capacity) {
+                return 0;
+            }
+            dst[writeIndex++] = 0;
+        }
+    }
+    return writeIndex;
+}
+
+/* Same CRC32 as crc32() in src/telemetry/crc.cpp (reflected, polynomial 0xEDB88320) */
+uint32_t StreamReader::crc32(const uint8_t* buf, size_t size) {
+    uint32_t crc = ~0U;
+    while (size--) {
+        crc ^= *buf++;
+        for (int i = 0; i < 8; i++) {
+            crc = (crc >> 1) ^ (0xEDB88320U & (0U - (crc & 1U)));
+        }
+    }
+    return crc ^ ~0U;
+}
+
+}  // namespace cats
@@ -0,0 +1,94 @@
+/*
+ * CATS Flight Software
+ * Copyright (C) 2022 Control and Telemetry Systems
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/*
+ * Host side reader for the binary live-telemetry stream of the groundstation.
+ *
+ * Open the CDC port of the groundstation with CONSOLE_BINARY_BAUDRATE
+ * (1000000 bit/s) to switch the console into binary mode, then feed every byte
+ * read from the port into StreamReader::feed(). Reopening the port with any
+ * other baudrate switches back to text logging.
+ *
+ *   cats::StreamReader reader([](const cats::StreamRecord& record){
+ *       if(record.header.opcode == CMD_INFO) { ... }
+ *   });
+ *   reader.feed(buffer, length);
+ *
+ * Only depends on the C++ standard library.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "../src/telemetry/stream_format.h"
+#include "../src/telemetry/telemetry_reg.h"
+
+namespace cats {
+
+struct StreamRecord {
+    telemetry_stream_header_t header;
+    uint8_t payload[TELEMETRY_STREAM_MAX_PAYLOAD];
+    uint64_t timestamp;     // [us] Receive time, unwrapped to 64 bit
+};
+
+struct StreamStatistics {
+    uint64_t records = 0;         // Valid records delivered to the handler
+    uint64_t crcErrors = 0;       // Frames with a wrong CRC
+    uint64_t framingErrors = 0;   // Frames with invalid COBS encoding, length or version
+    uint64_t lostRecords = 0;     // Records dropped on the groundstation (sequence gaps)
+};
+
+class StreamReader {
+    public:
+        using Handler = std::function<void(const StreamRecord&)>;
+
+        explicit StreamReader(Handler handler) : handler(std::move(handler)) {}
+
+        /* Feed raw bytes from the serial port, returns the number of records decoded */
+        size_t feed(const uint8_t* data, size_t length);
+
+        /* Discard a partially received frame, e.g. after reopening the port */
+        void reset();
+
+        const StreamStatistics& statistics() const {
+            return stats;
+        }
+
+    private:
+        bool processFrame();
+        static size_t decode(const uint8_t* src, size_t length, uint8_t* dst, size_t capacity);
+        static uint32_t crc32(const uint8_t* buf, size_t size);
+
+        Handler handler;
+        StreamStatistics stats;
+
+        uint8_t frame[TELEMETRY_STREAM_MAX_ENCODED];
+        size_t frameLength = 0;
+        bool overflow = false;
+
+        bool sequenceValid = false;
+        uint16_t lastSequence = 0;
+        bool timestampValid = false;
+        uint32_t lastTimestamp = 0;
+        uint64_t timestampHigh = 0;
+};
+
+}  // namespace cats
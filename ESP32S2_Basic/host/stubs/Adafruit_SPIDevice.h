@@ -0,0 +1,61 @@
+#pragma once
+
+/*
+ * Adafruit_SPIDevice of Adafruit_BusIO on the host. Instead of toggling pins
+ * every transaction is handed to the HostSpiBus installed with
+ * setHostSpiBus(), e.g. the SharpPanel model of the display. Without a bus
+ * the bytes are dropped.
+ */
+
+#include <Arduino.h>
+#include <SPI.h>
+
+typedef enum _BitOrder {
+    SPI_BITORDER_MSBFIRST = SPI_MSBFIRST,
+    SPI_BITORDER_LSBFIRST = SPI_LSBFIRST,
+} BusIOBitOrder;
+
+class HostSpiBus {
+    public:
+        virtual ~HostSpiBus() {}
+
+        /* Start and end of a transaction of the device with chip select cs */
+        virtual void select(int8_t cs, uint32_t frequency) = 0;
+        virtual void deselect() = 0;
+
+        /* One transfer call of the driver, a transaction may have several */
+        virtual void transfer(const uint8_t* data, size_t size) = 0;
+};
+
+void setHostSpiBus(HostSpiBus* bus);
+
+class Adafruit_SPIDevice {
+    public:
+        Adafruit_SPIDevice(int8_t cspin, uint32_t freq = 1000000, BusIOBitOrder dataOrder = SPI_BITORDER_MSBFIRST,
+                           uint8_t dataMode = SPI_MODE0, SPIClass* theSPI = &SPI) :
+            cs(cspin), frequency(freq) {
+            (void) dataOrder; (void) dataMode; (void) theSPI;
+        }
+
+        Adafruit_SPIDevice(int8_t cspin, int8_t sck, int8_t miso, int8_t mosi, uint32_t freq = 1000000,
+                           BusIOBitOrder dataOrder = SPI_BITORDER_MSBFIRST, uint8_t dataMode = SPI_MODE0) :
+            cs(cspin), frequency(freq) {
+            (void) sck; (void) miso; (void) mosi; (void) dataOrder; (void) dataMode;
+        }
+
+        bool begin(void) {
+            return true;
+        }
+
+        /* Write only, buffers are not overwritten with received data */
+        uint8_t transfer(uint8_t send);
+        void transfer(uint8_t* buffer, size_t len);
+        bool write(const uint8_t* buffer, size_t len, const uint8_t* prefix_buffer = nullptr, size_t prefix_len = 0);
+
+        void beginTransaction(void);
+        void endTransaction(void);
+
+    private:
+        int8_t cs;
+        uint32_t frequency;
+};
@@ -0,0 +1,118 @@
+#pragma once
+
+/*
+ * Host stand-in for the Arduino-ESP32 core, just enough of it to compile the
+ * display stack (Adafruit_GFX, Adafruit_SharpMem, src/hmi) on Linux. The
+ * clock is the monotonic clock of the host, the FreeRTOS primitives are
+ * single threaded no-ops and the pins only exist for the SPI stub.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+#include <algorithm>
+#include <cmath>
+
+#include "pgmspace.h"
+#include "WString.h"
+#include "Print.h"
+#include "Stream.h"
+
+using std::abs;
+using std::max;
+using std::min;
+
+typedef bool boolean;
+typedef uint8_t byte;
+typedef uint16_t word;
+
+#define HIGH            0x1
+#define LOW             0x0
+#define INPUT           0x01
+#define OUTPUT          0x03
+#define INPUT_PULLUP    0x05
+
+#define PI              3.1415926535897932384626433832795
+#define HALF_PI         1.5707963267948966192313216916398
+#define TWO_PI          6.283185307179586476925286766559
+#define DEG_TO_RAD      0.017453292519943295769236907684886
+#define RAD_TO_DEG      57.295779513082320876798154814105
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define radians(deg)    ((deg) * DEG_TO_RAD)
+#define degrees(rad)    ((rad) * RAD_TO_DEG)
+#define sq(x)           ((x) * (x))
+
+#define IRAM_ATTR
+
+uint32_t millis(void);
+uint32_t micros(void);
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+
+// In newlib, but only in glibc from 2.38 on
+#if defined(__GLIBC__) && !__GLIBC_PREREQ(2, 38)
+static inline size_t strlcpy(char* dst, const char* src, size_t size) {
+    size_t length = strlen(src);
+    if (size) {
+        size_t count = (length < size - 1) ? length : size - 1;
+        memcpy(dst, src, count);
+        dst[count] = 0;
+    }
+    return length;
+}
+#endif
+
+// Heap capabilities, PSRAM is ordinary heap on the host
+#define MALLOC_CAP_8BIT     (1 << 2)
+#define MALLOC_CAP_DMA      (1 << 3)
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+
+static inline void* heap_caps_malloc(size_t size, uint32_t caps) {
+    (void) caps;
+    return malloc(size);
+}
+
+static inline void* ps_malloc(size_t size) {
+    return malloc(size);
+}
+
+// FreeRTOS, everything runs in one thread
+typedef uint32_t TickType_t;
+typedef int32_t BaseType_t;
+typedef uint32_t UBaseType_t;
+typedef void* TaskHandle_t;
+typedef void* QueueHandle_t;
+typedef void* SemaphoreHandle_t;
+
+typedef struct {
+    uint32_t owner;
+    uint32_t count;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED    {0, 0}
+#define portENTER_CRITICAL(mux)         ((void)(mux))
+#define portEXIT_CRITICAL(mux)          ((void)(mux))
+#define portMAX_DELAY                   ((TickType_t) 0xffffffffUL)
+#define portTICK_PERIOD_MS              1
+#define pdMS_TO_TICKS(ms)               ((TickType_t)(ms))
+#define pdTRUE                          1
+#define pdFALSE                         0
+#define pdPASS                          pdTRUE
+#define pdFAIL                          pdFALSE
+
+static inline TickType_t xTaskGetTickCount(void) {
+    return millis();
+}
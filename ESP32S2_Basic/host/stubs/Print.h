@@ -0,0 +1,66 @@
+#pragma once
+
+/* Print of the Arduino-ESP32 core, number formatting as in Print.cpp */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "WString.h"
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+class Print {
+    public:
+        virtual ~Print() {}
+
+        virtual size_t write(uint8_t c) = 0;
+        virtual size_t write(const uint8_t* buffer, size_t size);
+
+        size_t write(const char* text) {
+            return text ? write((const uint8_t*) text, strlen(text)) : 0;
+        }
+
+        size_t write(const char* buffer, size_t size) {
+            return write((const uint8_t*) buffer, size);
+        }
+
+        virtual int availableForWrite() {
+            return 0;
+        }
+
+        virtual void flush() {}
+
+        size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+        size_t print(const String& text);
+        size_t print(const char text[]);
+        size_t print(char c);
+        size_t print(unsigned char value, int base = DEC);
+        size_t print(int value, int base = DEC);
+        size_t print(unsigned int value, int base = DEC);
+        size_t print(long value, int base = DEC);
+        size_t print(unsigned long value, int base = DEC);
+        size_t print(long long value, int base = DEC);
+        size_t print(unsigned long long value, int base = DEC);
+        size_t print(double value, int digits = 2);
+
+        size_t println(const String& text);
+        size_t println(const char text[]);
+        size_t println(char c);
+        size_t println(unsigned char value, int base = DEC);
+        size_t println(int value, int base = DEC);
+        size_t println(unsigned int value, int base = DEC);
+        size_t println(long value, int base = DEC);
+        size_t println(unsigned long value, int base = DEC);
+        size_t println(long long value, int base = DEC);
+        size_t println(unsigned long long value, int base = DEC);
+        size_t println(double value, int digits = 2);
+        size_t println(void);
+
+    private:
+        size_t printNumber(unsigned long long value, uint8_t base);
+        size_t printFloat(double value, uint8_t digits);
+};
@@ -0,0 +1,43 @@
+#pragma once
+
+/* SPI of the Arduino-ESP32 core without a bus behind it, see Adafruit_SPIDevice.h */
+
+#include <Arduino.h>
+
+#define SPI_LSBFIRST    0
+#define SPI_MSBFIRST    1
+#define LSBFIRST        SPI_LSBFIRST
+#define MSBFIRST        SPI_MSBFIRST
+#define SPI_MODE0       0
+#define SPI_MODE1       1
+#define SPI_MODE2       2
+#define SPI_MODE3       3
+
+class SPISettings {
+    public:
+        SPISettings(uint32_t clock = 1000000, uint8_t bitOrder = SPI_MSBFIRST, uint8_t dataMode = SPI_MODE0) :
+            clock(clock), bitOrder(bitOrder), dataMode(dataMode) {}
+
+        uint32_t clock;
+        uint8_t bitOrder;
+        uint8_t dataMode;
+};
+
+class SPIClass {
+    public:
+        void begin() {}
+        void end() {}
+        void beginTransaction(SPISettings settings) {
+            (void) settings;
+        }
+        void endTransaction() {}
+        uint8_t transfer(uint8_t data) {
+            (void) data;
+            return 0;
+        }
+        void transfer(void* data, uint32_t size) {
+            memset(data, 0, size);
+        }
+};
+
+extern SPIClass SPI;
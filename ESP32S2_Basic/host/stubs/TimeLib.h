@@ -0,0 +1,22 @@
+#pragma once
+
+/* Time library (TimeLib) in UTC, the clock is never set on the host */
+
+#include <Arduino.h>
+#include <time.h>
+
+typedef enum {
+    timeNotSet,
+    timeNeedsSync,
+    timeSet,
+} timeStatus_t;
+
+time_t now();
+timeStatus_t timeStatus();
+
+int hour(time_t t = now());
+int minute(time_t t = now());
+int second(time_t t = now());
+int day(time_t t = now());
+int month(time_t t = now());
+int year(time_t t = now());
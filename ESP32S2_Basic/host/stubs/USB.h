@@ -0,0 +1,33 @@
+#pragma once
+
+/* USB CDC and UART types referenced by src/console.h, the host console writes to stderr */
+
+#include <Arduino.h>
+
+#define SERIAL_8N1      0x800001c
+
+typedef const char* esp_event_base_t;
+
+class HostSerial : public Stream {
+    public:
+        using Print::write;
+        size_t write(uint8_t c) override;
+        size_t write(const uint8_t* buffer, size_t size) override;
+        int available() override {
+            return 0;
+        }
+        int read() override {
+            return -1;
+        }
+        int peek() override {
+            return -1;
+        }
+        operator bool() const {
+            return true;
+        }
+};
+
+class USBCDC : public HostSerial {};
+class HardwareSerial : public HostSerial {};
+
+extern USBCDC USBSerial;
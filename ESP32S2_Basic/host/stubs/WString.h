@@ -0,0 +1,73 @@
+#pragma once
+
+/* Arduino String on top of std::string, the subset used by the HMI */
+
+#include <stdint.h>
+#include <string>
+
+class __FlashStringHelper;
+#define F(text) (reinterpret_cast<const __FlashStringHelper*>(text))
+
+class String {
+    public:
+        String(const char* text = "") : text(text ? text : "") {}
+        String(const std::string& text) : text(text) {}
+        String(char c) : text(1, c) {}
+        String(int value, unsigned char base = 10);
+        String(unsigned int value, unsigned char base = 10);
+        String(long value, unsigned char base = 10);
+        String(unsigned long value, unsigned char base = 10);
+        String(unsigned char value, unsigned char base = 10) : String((unsigned int) value, base) {}
+        String(float value, unsigned int decimals = 2) : String((double) value, decimals) {}
+        String(double value, unsigned int decimals = 2);
+
+        const char* c_str() const {
+            return text.c_str();
+        }
+
+        unsigned int length() const {
+            return text.length();
+        }
+
+        char charAt(unsigned int index) const {
+            return index < text.length() ? text[index] : 0;
+        }
+
+        char operator[](unsigned int index) const {
+            return charAt(index);
+        }
+
+        String& operator+=(const String& other) {
+            text += other.text;
+            return *this;
+        }
+
+        String& operator+=(const char* other) {
+            text += other;
+            return *this;
+        }
+
+        String& operator+=(char c) {
+            text += c;
+            return *this;
+        }
+
+        bool operator==(const String& other) const {
+            return text == other.text;
+        }
+
+        bool operator==(const char* other) const {
+            return text == other;
+        }
+
+        friend String operator+(const String& a, const String& b) {
+            return String(a.text + b.text);
+        }
+
+        friend String operator+(const String& a, const char* b) {
+            return String(a.text + b);
+        }
+
+    private:
+        std::string text;
+};
@@ -0,0 +1,57 @@
+#pragma once
+
+/* I2C of the Arduino-ESP32 core with no device answering */
+
+#include <Arduino.h>
+
+class TwoWire : public Stream {
+    public:
+        bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0) {
+            (void) sda; (void) scl; (void) frequency;
+            return true;
+        }
+        bool end() {
+            return true;
+        }
+
+        void beginTransmission(uint16_t address) {
+            (void) address;
+        }
+        uint8_t endTransmission(bool sendStop = true) {
+            (void) sendStop;
+            return 2;                   // NACK on address
+        }
+        size_t requestFrom(uint16_t address, size_t size, bool sendStop = true) {
+            (void) address; (void) size; (void) sendStop;
+            return 0;
+        }
+
+        using Print::write;
+        size_t write(uint8_t data) override {
+            (void) data;
+            return 1;
+        }
+        size_t write(int data) {
+            return write((uint8_t) data);
+        }
+        size_t write(unsigned int data) {
+            return write((uint8_t) data);
+        }
+        size_t write(long data) {
+            return write((uint8_t) data);
+        }
+        size_t write(unsigned long data) {
+            return write((uint8_t) data);
+        }
+        int available() override {
+            return 0;
+        }
+        int read() override {
+            return -1;
+        }
+        int peek() override {
+            return -1;
+        }
+};
+
+extern TwoWire Wire;
@@ -0,0 +1,289 @@
+#include <Arduino.h>
+#include <Adafruit_SPIDevice.h>
+#include <TimeLib.h>
+#include <chrono>
+#include <thread>
+
+/* Arduino core */
+
+static const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+uint32_t millis(void) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+uint32_t micros(void) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+void delay(uint32_t ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(uint32_t us) {
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    (void) pin; (void) mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    (void) pin; (void) value;
+}
+
+int digitalRead(uint8_t pin) {
+    (void) pin;
+    return LOW;
+}
+
+long random(long max) {
+    return max > 0 ? rand() % max : 0;
+}
+
+long random(long min, long max) {
+    return max > min ? min + random(max - min) : min;
+}
+
+void randomSeed(unsigned long seed) {
+    srand(seed);
+}
+
+/* String */
+
+String::String(int value, unsigned char base) : String((long) value, base) {}
+
+String::String(unsigned int value, unsigned char base) : String((unsigned long) value, base) {}
+
+String::String(long value, unsigned char base) {
+    if(value < 0 && base == 10) {
+        text = "-" + String((unsigned long) -value, base).text;
+    } else {
+        text = String((unsigned long) value, base).text;
+    }
+}
+
+String::String(unsigned long value, unsigned char base) {
+    char buffer[8 * sizeof(value) + 1];
+    char* p = &buffer[sizeof(buffer) - 1];
+    *p = 0;
+    do {
+        uint8_t digit = value % base;
+        *--p = digit < 10 ? '0' + digit : 'A' + digit - 10;
+        value /= base;
+    } while(value);
+    text = p;
+}
+
+String::String(double value, unsigned int decimals) {
+    char buffer[40];
+    snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+    text = buffer;
+}
+
+/* Print */
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+    size_t n = 0;
+    while(size--) {
+        n += write(*buffer++);
+    }
+    return n;
+}
+
+size_t Print::printf(const char* format, ...) {
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if(length < 0) return 0;
+    return write((const uint8_t*) buffer, min((size_t) length, sizeof(buffer) - 1));
+}
+
+size_t Print::printNumber(unsigned long long value, uint8_t base) {
+    char buffer[8 * sizeof(value) + 1];
+    char* p = &buffer[sizeof(buffer) - 1];
+    *p = 0;
+    if(base < 2) base = 10;
+    do {
+        uint8_t digit = value % base;
+        *--p = digit < 10 ? '0' + digit : 'A' + digit - 10;
+        value /= base;
+    } while(value);
+    return write(p);
+}
+
+size_t Print::printFloat(double value, uint8_t digits) {
+    char buffer[40];
+    snprintf(buffer, sizeof(buffer), "%.*f", digits, value);
+    return write(buffer);
+}
+
+size_t Print::print(const String& text) {
+    return write(text.c_str(), text.length());
+}
+
+size_t Print::print(const char text[]) {
+    return write(text);
+}
+
+size_t Print::print(char c) {
+    return write((uint8_t) c);
+}
+
+size_t Print::print(unsigned char value, int base) {
+    return printNumber(value, base);
+}
+
+size_t Print::print(int value, int base) {
+    return print((long long) value, base);
+}
+
+size_t Print::print(unsigned int value, int base) {
+    return printNumber(value, base);
+}
+
+size_t Print::print(long value, int base) {
+    return print((long long) value, base);
+}
+
+size_t Print::print(unsigned long value, int base) {
+    return printNumber(value, base);
+}
+
+size_t Print::print(long long value, int base) {
+    if(base == 10 && value < 0) {
+        return print('-') + printNumber(-value, 10);
+    }
+    return printNumber(value, base);
+}
+
+size_t Print::print(unsigned long long value, int base) {
+    return printNumber(value, base);
+}
+
+size_t Print::print(double value, int digits) {
+    return printFloat(value, digits);
+}
+
+size_t Print::println(void) {
+    return print("\r\n");
+}
+
+size_t Print::println(const String& text) {
+    return print(text) + println();
+}
+
+size_t Print::println(const char text[]) {
+    return print(text) + println();
+}
+
+size_t Print::println(char c) {
+    return print(c) + println();
+}
+
+size_t Print::println(unsigned char value, int base) {
+    return print(value, base) + println();
+}
+
+size_t Print::println(int value, int base) {
+    return print(value, base) + println();
+}
+
+size_t Print::println(unsigned int value, int base) {
+    return print(value, base) + println();
+}
+
+size_t Print::println(long value, int base) {
+    return print(value, base) + println();
+}
+
+size_t Print::println(unsigned long value, int base) {
+    return print(value, base) + println();
+}
+
+size_t Print::println(long long value, int base) {
+    return print(value, base) + println();
+}
+
+size_t Print::println(unsigned long long value, int base) {
+    return print(value, base) + println();
+}
+
+size_t Print::println(double value, int digits) {
+    return print(value, digits) + println();
+}
+
+/* Adafruit_SPIDevice */
+
+static HostSpiBus* spiBus = NULL;
+
+void setHostSpiBus(HostSpiBus* bus) {
+    spiBus = bus;
+}
+
+void Adafruit_SPIDevice::beginTransaction(void) {
+    if(spiBus) spiBus->select(cs, frequency);
+}
+
+void Adafruit_SPIDevice::endTransaction(void) {
+    if(spiBus) spiBus->deselect();
+}
+
+uint8_t Adafruit_SPIDevice::transfer(uint8_t send) {
+    if(spiBus) spiBus->transfer(&send, 1);
+    return 0;
+}
+
+void Adafruit_SPIDevice::transfer(uint8_t* buffer, size_t len) {
+    if(spiBus) spiBus->transfer(buffer, len);
+}
+
+bool Adafruit_SPIDevice::write(const uint8_t* buffer, size_t len, const uint8_t* prefix_buffer, size_t prefix_len) {
+    beginTransaction();
+    if(spiBus && prefix_len) spiBus->transfer(prefix_buffer, prefix_len);
+    if(spiBus) spiBus->transfer(buffer, len);
+    endTransaction();
+    return true;
+}
+
+/* TimeLib */
+
+time_t now() {
+    return 0;
+}
+
+timeStatus_t timeStatus() {
+    return timeNotSet;
+}
+
+static struct tm split(time_t t) {
+    struct tm result;
+    gmtime_r(&t, &result);
+    return result;
+}
+
+int hour(time_t t) {
+    return split(t).tm_hour;
+}
+
+int minute(time_t t) {
+    return split(t).tm_min;
+}
+
+int second(time_t t) {
+    return split(t).tm_sec;
+}
+
+int day(time_t t) {
+    return split(t).tm_mday;
+}
+
+int month(time_t t) {
+    return split(t).tm_mon + 1;
+}
+
+int year(time_t t) {
+    return split(t).tm_year + 1900;
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+/* Power management locks of ESP-IDF, there is nothing to lock on the host */
+
+typedef enum {
+    ESP_PM_CPU_FREQ_MAX,
+    ESP_PM_APB_FREQ_MAX,
+    ESP_PM_NO_LIGHT_SLEEP,
+} esp_pm_lock_type_t;
+
+typedef void* esp_pm_lock_handle_t;
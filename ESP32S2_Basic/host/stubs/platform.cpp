@@ -0,0 +1,173 @@
+#include <Arduino.h>
+#include <SPI.h>
+#include <Wire.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "console.h"
+#include "config.h"
+#include "utils.h"
+
+/* Peripherals and globals of the firmware that the display stack links against */
+
+SPIClass SPI;
+TwoWire Wire;
+USBCDC USBSerial;
+Config systemConfig;
+FatFileSystem fatfs;
+
+/* Console, written straight through to stderr without the ring buffer and colors */
+
+size_t HostSerial::write(uint8_t c) {
+    return fwrite(&c, 1, 1, stderr);
+}
+
+size_t HostSerial::write(const uint8_t* buffer, size_t size) {
+    return fwrite(buffer, 1, size, stderr);
+}
+
+size_t Console::write(const uint8_t* buffer, size_t size) {
+    return stream.write(buffer, size);
+}
+
+Console console(USBSerial);
+
+static struct ConsoleSetup {
+    ConsoleSetup() {
+        console.enableColors(false);
+    }
+} consoleSetup;
+
+/* File system */
+
+bool fsLock(TickType_t timeout) {
+    (void) timeout;
+    return true;
+}
+
+void fsUnlock(void) {}
+
+File::File(File&& other) {
+    *this = std::move(other);
+}
+
+File& File::operator=(File&& other) {
+    if(this != &other) {
+        close();
+        fd = other.fd;
+        dir = other.dir;
+        path = std::move(other.path);
+        name = std::move(other.name);
+        other.fd = -1;
+        other.dir = NULL;
+    }
+    return *this;
+}
+
+File::~File() {
+    close();
+}
+
+int File::read(void* buffer, size_t size) {
+    return fd >= 0 ? ::read(fd, buffer, size) : -1;
+}
+
+size_t File::write(const void* buffer, size_t size) {
+    if(fd < 0) return 0;
+    ssize_t length = ::write(fd, buffer, size);
+    return length > 0 ? length : 0;
+}
+
+bool File::seekSet(uint32_t position) {
+    return fd >= 0 && lseek(fd, position, SEEK_SET) == (off_t) position;
+}
+
+uint32_t File::fileSize() const {
+    struct stat info;
+    return (fd >= 0 && fstat(fd, &info) == 0) ? info.st_size : 0;
+}
+
+bool File::sync() {
+    return fd >= 0 && fsync(fd) == 0;
+}
+
+bool File::close() {
+    if(fd >= 0) ::close(fd);
+    if(dir) closedir((DIR*) dir);
+    fd = -1;
+    dir = NULL;
+    return true;
+}
+
+bool File::openNext(File* directory, int flags) {
+    close();
+    if(!directory || !directory->dir) return false;
+
+    struct dirent* entry;
+    while((entry = readdir((DIR*) directory->dir)) != NULL) {
+        if(strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) continue;
+
+        path = directory->path + "/" + entry->d_name;
+        name = entry->d_name;
+        struct stat info;
+        if(stat(path.c_str(), &info) != 0) continue;
+        if(S_ISDIR(info.st_mode)) {
+            dir = opendir(path.c_str());
+        } else {
+            fd = ::open(path.c_str(), flags & ~O_CREAT);
+        }
+        if(*this) return true;
+    }
+    return false;
+}
+
+size_t File::getName(char* buffer, size_t size) const {
+    snprintf(buffer, size, "%s", name.c_str());
+    return strlen(buffer);
+}
+
+void FatFileSystem::setRoot(const char* directory) {
+    root = directory;
+    cwd = "/";
+}
+
+std::string FatFileSystem::resolve(const char* path) const {
+    if(path[0] == '/') return root + path;
+    return root + cwd + (cwd.back() == '/' ? "" : "/") + path;
+}
+
+File FatFileSystem::open(const char* path, int flags) {
+    File file;
+    file.path = resolve(path);
+    const char* slash = strrchr(path, '/');
+    file.name = slash ? slash + 1 : path;
+
+    struct stat info;
+    if(stat(file.path.c_str(), &info) == 0 && S_ISDIR(info.st_mode)) {
+        file.dir = opendir(file.path.c_str());
+    } else {
+        file.fd = ::open(file.path.c_str(), flags, 0644);
+    }
+    return file;
+}
+
+bool FatFileSystem::exists(const char* path) {
+    struct stat info;
+    return stat(resolve(path).c_str(), &info) == 0;
+}
+
+bool FatFileSystem::remove(const char* path) {
+    return unlink(resolve(path).c_str()) == 0;
+}
+
+bool FatFileSystem::mkdir(const char* path) {
+    return ::mkdir(resolve(path).c_str(), 0755) == 0;
+}
+
+bool FatFileSystem::chdir(const char* path) {
+    std::string next = path[0] == '/' ? std::string(path) : cwd + "/" + path;
+    struct stat info;
+    if(stat((root + next).c_str(), &info) != 0 || !S_ISDIR(info.st_mode)) return false;
+    cwd = next;
+    return true;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+/*
+ * Host stand-in for src/utils.h. The fatfs drive is a directory of the host
+ * (current directory unless setRoot() is called), files and directories are
+ * opened with the SdFat calls used by the log index and the map pack.
+ */
+
+#include <Arduino.h>
+#include <fcntl.h>
+#include <string>
+
+#define FILE_READ   O_RDONLY
+#define FILE_WRITE  (O_RDWR | O_CREAT | O_APPEND)
+
+bool fsLock(TickType_t timeout = portMAX_DELAY);
+void fsUnlock(void);
+
+class File {
+    public:
+        File() {}
+        File(const File& other) = delete;
+        File& operator=(const File& other) = delete;
+        File(File&& other);
+        File& operator=(File&& other);
+        ~File();
+
+        operator bool() const {
+            return fd >= 0 || dir != NULL;
+        }
+
+        bool isDir() const {
+            return dir != NULL;
+        }
+
+        int read(void* buffer, size_t size);
+        size_t write(const void* buffer, size_t size);
+        bool seekSet(uint32_t position);
+        uint32_t fileSize() const;
+        bool sync();
+        bool close();
+
+        /* Next entry of the directory, like FatFile::openNext() */
+        bool openNext(File* directory, int flags = O_RDONLY);
+        size_t getName(char* name, size_t size) const;
+
+    private:
+        friend class FatFileSystem;
+
+        int fd = -1;
+        void* dir = NULL;
+        std::string path;
+        std::string name;
+};
+
+class FatFileSystem {
+    public:
+        /* Host directory of the drive root */
+        void setRoot(const char* directory);
+
+        File open(const char* path, int flags = FILE_READ);
+        bool exists(const char* path);
+        bool remove(const char* path);
+        bool mkdir(const char* path);
+        bool chdir(const char* path);
+
+    private:
+        std::string resolve(const char* path) const;
+
+        std::string root = ".";
+        std::string cwd = "/";
+};
+
+extern FatFileSystem fatfs;
@@ -0,0 +1,112 @@
+/*
+ * Text benchmark of the glyph cache
+ *
+ *   text_bench [rounds]
+ *
+ * Prints the same lines in the fonts the Window caches once through the
+ * GlyphCache masks and once through the pixel by pixel path of
+ * Adafruit_GFX::write, and reports characters per second for both. The two
+ * frame buffers must be equal, otherwise the cache draws wrong glyphs and
+ * the benchmark fails.
+ */
+
+#include "display.h"
+#include <Fonts/FreeSans9pt7b.h>
+#include <Fonts/FreeSans12pt7b.h>
+
+#define TEXT_WIDTH  400     // [px]
+#define TEXT_HEIGHT 240     // [px]
+
+typedef struct {
+    const char* name;
+    const GFXfont* font;
+} text_font_t;
+
+static const text_font_t fonts[] = {
+    {"FreeSans9pt", &FreeSans9pt7b},
+    {"FreeSans12pt", &FreeSans12pt7b},
+};
+
+/* Lines like the Live and Recovery pages print, all fit the width in both fonts */
+static const char* const lines[] = {
+    "1520 m  87 m/s  COAST",
+    "47.3765 N  8.5432 E",
+    "AGE 0.0  SNR 9  RSSI -72",
+    ">1 1532m Az 274 El 12",
+    "Settings: Telemetry",
+};
+
+static GlyphCache cache9pt(&FreeSans9pt7b);
+static GlyphCache cache12pt(&FreeSans12pt7b);
+static SharpDisplay cached(0, 0, 0, TEXT_WIDTH, TEXT_HEIGHT);
+static SharpDisplay plain(0, 0, 0, TEXT_WIDTH, TEXT_HEIGHT);   // No caches, Adafruit_GFX draws the glyphs
+
+/* [us] Prints all lines rounds times, returns the number of characters */
+static uint64_t printLines(SharpDisplay& display, const GFXfont* font, uint32_t rounds, uint64_t* time){
+    display.setFont(font);
+    display.setTextSize(1);
+    display.setTextColor(0);
+    display.setTextWrap(false);
+
+    const uint32_t count = sizeof(lines) / sizeof(lines[0]);
+    uint64_t characters = 0;
+    uint32_t start = micros();
+    for(uint32_t round = 0; round < rounds; round++){
+        for(uint32_t i = 0; i < count; i++){
+            display.setCursor(0, (i + 1) * font->yAdvance);
+            characters += display.print(lines[i]);
+        }
+    }
+    *time += micros() - start;
+    return characters;
+}
+
+static uint32_t countDifferences(const SharpDisplay& a, const SharpDisplay& b){
+    uint8_t rowA[TEXT_WIDTH / 8], rowB[TEXT_WIDTH / 8];
+    uint32_t differences = 0;
+    for(int16_t y = 0; y < TEXT_HEIGHT; y++){
+        a.getPbmRow(y, rowA);
+        b.getPbmRow(y, rowB);
+        for(uint32_t i = 0; i < sizeof(rowA); i++){
+            differences += __builtin_popcount(rowA[i] ^ rowB[i]);
+        }
+    }
+    return differences;
+}
+
+int main(int argc, char** argv){
+    uint32_t rounds = (argc > 1) ? strtoul(argv[1], NULL, 10) : 2000;
+    if(rounds == 0) rounds = 1;
+
+    cached.begin();
+    plain.begin();
+    if(!cache9pt.begin() || !cache12pt.begin()){
+        printf("Glyph cache allocation failed\n");
+        return 1;
+    }
+    cached.addGlyphCache(&cache9pt);
+    cached.addGlyphCache(&cache12pt);
+
+    uint32_t failures = 0;
+    printf("%u rounds of %u lines\n", rounds, (unsigned) (sizeof(lines) / sizeof(lines[0])));
+    printf("%-14s %12s %12s %8s\n", "font", "gfx[char/s]", "cache[char/s]", "speedup");
+    for(const text_font_t& font : fonts){
+        cached.clearDisplayBuffer();
+        plain.clearDisplayBuffer();
+
+        uint64_t plainTime = 0, cachedTime = 0;
+        uint64_t characters = printLines(plain, font.font, rounds, &plainTime);
+        printLines(cached, font.font, rounds, &cachedTime);
+
+        double plainRate = characters * 1e6 / (plainTime ? plainTime : 1);
+        double cachedRate = characters * 1e6 / (cachedTime ? cachedTime : 1);
+        printf("%-14s %12.0f %12.0f %7.1fx\n", font.name, plainRate, cachedRate, cachedRate / plainRate);
+
+        uint32_t differences = countDifferences(cached, plain);
+        if(differences){
+            printf("%-14s FAIL, %u pixels differ from the GFX path\n", font.name, differences);
+            failures++;
+        }
+    }
+    return failures ? 1 : 0;
+}
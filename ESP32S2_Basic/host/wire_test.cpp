@@ -0,0 +1,207 @@
+/*
+ * Wire format test of the partial refresh
+ *
+ *   wire_test
+ *
+ * Every frame the driver sends must be one write command with the mode
+ * byte, per line 1 address byte, WIDTH / 8 data bytes and 1 trailer byte,
+ * and a final trailer byte. Only lines that changed may be sent, every
+ * changed line must be sent, and consecutive lines go out in transfers of up
+ * to SHARPMEM_REFRESH_CHUNK_LINES lines. The driver is checked on its own
+ * with and without the shadow frame, then through the Window with the
+ * pages and the highlight moves of the HMI. Bytes and times are printed per
+ * frame.
+ */
+
+#include <algorithm>
+#include "pages.h"
+#include "sharp_panel.h"
+
+#define WIRE_WIDTH      400     // [px]
+#define WIRE_HEIGHT     240     // [px]
+#define WIRE_LINE_BYTES (WIRE_WIDTH / 8 + 2)    // [B]    Address, data and trailer
+
+static SharpPanel panel(WIRE_WIDTH, WIRE_HEIGHT);
+static Adafruit_SharpMem driver(SHARP_SCK, SHARP_MOSI, SHARP_SS, WIRE_WIDTH, WIRE_HEIGHT);
+static Window window;
+static uint32_t failures = 0;
+
+static void fail(const char* name, const char* format, ...){
+    char text[128];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    printf("%-22s FAIL, %s\n", name, text);
+    failures++;
+}
+
+/* Layout of the transfers: mode byte, runs in full chunks, trailer byte */
+static bool checkBatching(const char* name, const sharp_panel_frame_t& frame){
+    const std::vector<uint32_t>& sizes = frame.transferSizes;
+    if(sizes.size() < 3 || sizes.front() != 1 || sizes.back() != 1){
+        fail(name, "transfers are not mode byte, lines and trailer");
+        return false;
+    }
+
+    size_t line = 0;
+    for(size_t i = 1; i + 1 < sizes.size(); i++){
+        uint32_t count = sizes[i] / WIRE_LINE_BYTES;
+        if(sizes[i] % WIRE_LINE_BYTES || count == 0 || count > SHARPMEM_REFRESH_CHUNK_LINES){
+            fail(name, "transfer %u of %u bytes", (unsigned) i, sizes[i]);
+            return false;
+        }
+        for(uint32_t j = 1; j < count; j++){
+            if(frame.lines[line + j] != frame.lines[line + j - 1] + 1){
+                fail(name, "transfer %u spans a gap after line %u", (unsigned) i, frame.lines[line + j - 1]);
+                return false;
+            }
+        }
+        // A chunk may only be cut short by the end of its run
+        size_t last = line + count - 1;
+        bool runEnds = (last + 1 == frame.lines.size()) || frame.lines[last + 1] != frame.lines[last] + 1;
+        if(count < SHARPMEM_REFRESH_CHUNK_LINES && !runEnds){
+            fail(name, "transfer %u ends a run early at line %u", (unsigned) i, frame.lines[last]);
+            return false;
+        }
+        line += count;
+    }
+    return true;
+}
+
+/*
+ * Sends the frame of the display and checks it against the lines that
+ * differed from the panel before. Without the shadow frame the driver may
+ * send unchanged lines it drew over, but never fewer.
+ */
+static void checkFrame(const char* name, const Adafruit_SharpMem& display, void (*send)(), bool exact){
+    std::vector<uint16_t> changed = panel.differingLines(display);
+    uint32_t errors = panel.getErrors();
+    uint32_t frames = panel.getFrames();
+
+    send();
+
+    const sharp_panel_frame_t& frame = panel.getLastFrame();
+    if(panel.getFrames() != frames + 1){
+        fail(name, "%u frames sent instead of 1", panel.getFrames() - frames);
+        return;
+    }
+    if(panel.getErrors() != errors){
+        fail(name, "protocol error: %s", panel.getFirstError().c_str());
+        return;
+    }
+    if(panel.compare(display)){
+        fail(name, "the panel does not show the frame buffer");
+        return;
+    }
+
+    if(frame.lines.empty()){
+        if(!changed.empty()){
+            fail(name, "%u changed lines not sent", (unsigned) changed.size());
+            return;
+        }
+        if(frame.bytes != 2 || (frame.mode & SHARP_PANEL_MODE_WRITE)){
+            fail(name, "%u bytes sent without lines instead of the VCOM toggle", frame.bytes);
+            return;
+        }
+    } else {
+        if(frame.bytes != 2 + frame.lines.size() * WIRE_LINE_BYTES){
+            fail(name, "%u bytes for %u lines", frame.bytes, (unsigned) frame.lines.size());
+            return;
+        }
+        if(exact && frame.lines != changed){
+            fail(name, "%u lines sent, %u changed", (unsigned) frame.lines.size(), (unsigned) changed.size());
+            return;
+        }
+        for(uint16_t line : changed){
+            if(std::find(frame.lines.begin(), frame.lines.end(), line) == frame.lines.end()){
+                fail(name, "changed line %u not sent", line);
+                return;
+            }
+        }
+        if(!checkBatching(name, frame)) return;
+    }
+
+    printf("%-22s %5u %4u %5u %6u %11u %8u\n", name, (unsigned) frame.lines.size(), frame.runs,
+           frame.transfers, frame.bytes, display.getRefreshTime(), panel.getWireTime());
+}
+
+static void refreshDriver(){
+    driver.refresh();
+}
+
+static void flushWindow(){
+    window.flush(true);
+}
+
+/* Two separate blocks, the first longer than a chunk */
+static void drawBlocks(){
+    driver.fillRect(0, 10, WIRE_WIDTH, 10, 0);
+    driver.fillRect(5, 100, 3, 3, 0);
+}
+
+static void testDriver(){
+    setHostSpiBus(&panel);
+    driver.begin();
+    driver.clearDisplay();
+
+    drawBlocks();
+    checkFrame("driver blocks", driver, refreshDriver, true);
+    if(panel.getLastFrame().runs != 2){
+        fail("driver blocks", "%u runs instead of 2", panel.getLastFrame().runs);
+    }
+    checkFrame("driver idle", driver, refreshDriver, true);
+
+    // Without the shadow frame redrawn lines go out again although they are equal
+    drawBlocks();
+    checkFrame("driver redraw", driver, refreshDriver, false);
+    if(panel.getLastFrame().lines.size() != 13){
+        fail("driver redraw", "%u lines instead of the 13 drawn", (unsigned) panel.getLastFrame().lines.size());
+    }
+
+    driver.setShadowFrame(true);
+    driver.refresh();                   // The shadow frame starts with every line
+    drawBlocks();
+    checkFrame("driver shadow redraw", driver, refreshDriver, true);
+
+    driver.fillRect(0, 0, WIRE_WIDTH, WIRE_HEIGHT, 0);
+    checkFrame("driver full", driver, refreshDriver, true);
+    driver.setShadowFrame(false);
+}
+
+static void testWindow(){
+    setHostSpiBus(&panel);
+    hostBegin(window);
+    window.flush(true);
+    const SharpDisplay& display = window.getDisplay();
+
+    for(uint32_t i = 0; i < HOST_PAGE_COUNT; i++){
+        hostPages[i].render(window);
+        checkFrame(hostPages[i].name, display, flushWindow, true);
+        if(strcmp(hostPages[i].name, "menu") == 0){
+            for(uint32_t index = 1; index < 6; index++){
+                window.updateMenu(index);
+                checkFrame("menu highlight", display, flushWindow, true);
+            }
+        } else if(strcmp(hostPages[i].name, "settings") == 0){
+            window.updateSettings(1);
+            checkFrame("settings highlight", display, flushWindow, true);
+        }
+    }
+
+    window.initKeyboard("CATS", 0, true);
+    window.updateKeyboard("CATS", 0, true);
+    window.flush(true);
+    for(int32_t key = 1; key < 4; key++){
+        window.updateKeyboard("CATS", key, true);
+        checkFrame("keyboard highlight", display, flushWindow, true);
+    }
+}
+
+int main(){
+    printf("%-22s %5s %4s %5s %6s %11s %8s\n", "frame", "lines", "runs", "xfers", "bytes", "refresh[us]", "wire[us]");
+    testDriver();
+    testWindow();
+    printf("%u checks failed\n", failures);
+    return failures ? 1 : 0;
+}
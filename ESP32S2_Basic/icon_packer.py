@@ -0,0 +1,143 @@
+###############################################################################
+# file    icon_packer.py
+###############################################################################
+# brief   Packs the bitmaps of src/hmi/bmp.h into src/hmi/icons.h/.cpp
+###############################################################################
+# Every bitmap of bmp.h needs a "// 'name', WxHpx" comment above its array.
+# The bitmaps are PackBits compressed into one blob with an index table,
+# SharpDisplay::drawIcon() decodes them straight into the frame buffer.
+#
+# Runs as PlatformIO pre-script (extra_scripts = pre:icon_packer.py) and
+# regenerates the files if bmp.h changed, or standalone: python icon_packer.py
+###############################################################################
+
+import os
+import re
+import sys
+
+try:
+    Import("env")
+    PROJECT_DIR = env.subst("$PROJECT_DIR")
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.abspath(__file__))
+
+SOURCE = os.path.join(PROJECT_DIR, "src", "hmi", "bmp.h")
+HEADER = os.path.join(PROJECT_DIR, "src", "hmi", "icons.h")
+TABLE = os.path.join(PROJECT_DIR, "src", "hmi", "icons.cpp")
+
+BITMAP = re.compile(r"//\s*'([^']*)',\s*(\d+)x(\d+)px\s*\n\s*const unsigned char (\w+)\s*\[\]\s*(?:PROGMEM\s*)?=\s*\{([^}]*)\}")
+
+
+def parse(text):
+    icons = []
+    for match in BITMAP.finditer(text):
+        width, height, name = int(match.group(2)), int(match.group(3)), match.group(4)
+        data = bytes(int(value, 16) for value in re.findall(r"0x[0-9a-fA-F]+", match.group(5)))
+        if len(data) != (width + 7) // 8 * height:
+            sys.exit(f"icon_packer: {name} has {len(data)} bytes, expected {(width + 7) // 8 * height}")
+        icons.append((name, width, height, data))
+    return icons
+
+
+def packbits(data):
+    """Header n: 0..127 copy n + 1 literal bytes, -127..-1 repeat the next byte 1 - n times"""
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run >= 3 or (run == 2 and i + 2 >= len(data)):
+            out += bytes([(257 - run) & 0xFF, data[i]])
+            i += run
+            continue
+        # Literals end before the next run of three, shorter runs are cheaper as literal
+        start = i
+        while i < len(data) and i - start < 128:
+            if i + 2 < len(data) and data[i] == data[i + 1] == data[i + 2]:
+                break
+            i += 1
+        out += bytes([i - start - 1]) + data[start:i]
+    return bytes(out)
+
+
+def unpackbits(data, length):
+    out = bytearray()
+    i = 0
+    while len(out) < length:
+        n = data[i] - 256 if data[i] > 127 else data[i]
+        if n >= 0:
+            out += data[i + 1:i + 2 + n]
+            i += n + 2
+        elif n != -128:
+            out += bytes([data[i + 1]]) * (1 - n)
+            i += 2
+        else:
+            i += 1
+    return bytes(out)
+
+
+def hexLines(data, indent="    "):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append(indent + ", ".join(f"0x{b:02x}" for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def generate():
+    with open(SOURCE) as file:
+        icons = parse(file.read())
+
+    blob = bytearray()
+    entries = []
+    rawSize = 0
+    for name, width, height, data in icons:
+        packed = packbits(data)
+        assert unpackbits(packed, len(data)) == data
+        entries.append((name, width, height, len(blob), len(data), len(packed)))
+        blob += packed
+        rawSize += len(data)
+    tableSize = len(entries) * 4
+
+    header = ["#pragma once", "",
+              "// Generated by icon_packer.py from bmp.h, do not edit", "",
+              "#include <Arduino.h>", "",
+              "typedef enum {"]
+    for name, width, height, offset, raw, packed in entries:
+        header.append(f"    ICON_{name.upper()},".ljust(36) + f"// {width}x{height}, {raw} B packed to {packed} B")
+    header += ["    ICON_COUNT,", "} icon_e;", "",
+               "typedef struct {",
+               "    uint16_t offset;                // [B]    Start of the PackBits stream in iconData",
+               "    uint8_t width;                  // [px]",
+               "    uint8_t height;                 // [px]",
+               "} packed_icon_t;", "",
+               f"// {rawSize} B of bitmaps packed to {len(blob)} B plus {tableSize} B index",
+               "extern const uint8_t iconData[];",
+               "extern const packed_icon_t iconTable[ICON_COUNT];", ""]
+
+    table = ["// Generated by icon_packer.py from bmp.h, do not edit", "",
+             '#include "icons.h"', "",
+             "const uint8_t iconData[] PROGMEM = {",
+             hexLines(blob),
+             "};", "",
+             "const packed_icon_t iconTable[ICON_COUNT] = {"]
+    for name, width, height, offset, raw, packed in entries:
+        table.append(f"    {{{offset}, {width}, {height}}},".ljust(36) + f"// ICON_{name.upper()}")
+    table += ["};", ""]
+
+    with open(HEADER, "w", newline="\n") as file:
+        file.write("\n".join(header))
+    with open(TABLE, "w", newline="\n") as file:
+        file.write("\n".join(table))
+
+    print(f"icon_packer: {len(entries)} icons, {rawSize} B packed to {len(blob) + tableSize} B")
+
+
+def outdated():
+    if not all(os.path.exists(path) for path in (HEADER, TABLE)):
+        return True
+    return os.path.getmtime(SOURCE) > min(os.path.getmtime(HEADER), os.path.getmtime(TABLE))
+
+
+if outdated() or __name__ == "__main__":
+    generate()
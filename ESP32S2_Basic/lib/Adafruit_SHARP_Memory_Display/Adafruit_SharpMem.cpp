@@ -73,11 +73,17 @@ Adafruit_SharpMem::Adafruit_SharpMem(uint8_t clk, uint8_t mosi, uint8_t cs,
                                      uint32_t freq)
     : Adafruit_GFX(width, height) {
   _cs = cs;
+  _clk = clk;
+  _mosi = mosi;
+  _freq = freq;
   if (spidev) {
     delete spidev;
   }
   spidev =
       new Adafruit_SPIDevice(cs, clk, -1, mosi, freq, SPI_BITORDER_LSBFIRST);
+#if SHARPMEM_ROTATION > 0
+  setRotation(SHARPMEM_ROTATION);
+#endif
 }
 
 /**
@@ -94,11 +100,15 @@ Adafruit_SharpMem::Adafruit_SharpMem(SPIClass *theSPI, uint8_t cs,
                                      uint32_t freq)
     : Adafruit_GFX(width, height) {
   _cs = cs;
+  _freq = freq;
   if (spidev) {
     delete spidev;
   }
   spidev = new Adafruit_SPIDevice(cs, freq, SPI_BITORDER_LSBFIRST, SPI_MODE0,
                                   theSPI);
+#if SHARPMEM_ROTATION > 0
+  setRotation(SHARPMEM_ROTATION);
+#endif
 }
 
 /**
@@ -118,17 +128,100 @@ boolean Adafruit_SharpMem::begin(void) {
   // Set the vcom bit to a defined state
   _sharpmem_vcom = SHARPMEM_BIT_VCOM;
 
+  if (!allocateBuffers())
+    return false;
+
+  setRotation(0);
+
+  return true;
+}
+
+bool Adafruit_SharpMem::allocateBuffers(void) {
   sharpmem_buffer = (uint8_t *)malloc((WIDTH * HEIGHT) / 8);
+  sharpmem_chunk =
+      (uint8_t *)malloc(SHARPMEM_REFRESH_CHUNK_LINES * (WIDTH / 8 + 2));
+  dirty_lines = (uint32_t *)malloc(((HEIGHT + 31) / 32) * sizeof(uint32_t));
 
-  if (!sharpmem_buffer)
+  if (!sharpmem_buffer || !sharpmem_chunk || !dirty_lines)
     return false;
 
+  markDirty(0, HEIGHT - 1);
+  return true;
+}
+
+#ifdef SHARPMEM_DMA_SUPPORTED
+/**
+ * @brief Start the driver on an ESP32 SPI peripheral with DMA instead of
+ * Adafruit_SPIDevice. Only possible with the pin constructor. Afterwards
+ * refreshAsync() returns immediately while the frame is transmitted.
+ *
+ * @param host The SPI peripheral to use, must not be shared
+ * @return boolean true: success false: failure
+ */
+boolean Adafruit_SharpMem::beginDMA(spi_host_device_t host) {
+  if (_clk < 0 || _mosi < 0)
+    return false;
+
+  _sharpmem_vcom = SHARPMEM_BIT_VCOM;
+  if (!allocateBuffers())
+    return false;
+
+  // Write command, all lines with address and trailer, final trailer
+  uint32_t frame_size = 2 + HEIGHT * (WIDTH / 8 + 2);
+  dma_buffer = (uint8_t *)heap_caps_malloc(frame_size, MALLOC_CAP_DMA);
+  if (!dma_buffer)
+    return false;
+
+  spi_bus_config_t bus = {};
+  bus.mosi_io_num = _mosi;
+  bus.miso_io_num = -1;
+  bus.sclk_io_num = _clk;
+  bus.quadwp_io_num = -1;
+  bus.quadhd_io_num = -1;
+  bus.max_transfer_sz = frame_size;
+  if (spi_bus_initialize(host, &bus, SPI_DMA_CH_AUTO) != ESP_OK)
+    return false;
+
+  // CS of this display is active high, data is sent LSB first
+  spi_device_interface_config_t device = {};
+  device.mode = 0;
+  device.clock_speed_hz = _freq;
+  device.spics_io_num = _cs;
+  device.flags = SPI_DEVICE_POSITIVE_CS | SPI_DEVICE_TXBIT_LSBFIRST;
+  device.queue_size = 1;
+  device.post_cb = dmaDone;
+  if (spi_bus_add_device(host, &device, &dma_device) != ESP_OK) {
+    spi_bus_free(host);
+    return false;
+  }
+
   setRotation(0);
 
   return true;
 }
 
+void IRAM_ATTR Adafruit_SharpMem::dmaDone(spi_transaction_t *t) {
+  Adafruit_SharpMem *ref = (Adafruit_SharpMem *)t->user;
+  if (ref == NULL)
+    return;
+  ref->_refresh_time = micros() - ref->_refresh_start;
+  ref->_refresh_busy = false;
+  if (ref->_refresh_notify) {
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(ref->_refresh_notify, &woken);
+    if (woken)
+      portYIELD_FROM_ISR();
+  }
+}
+#endif
+
 // 1<<n is a costly operation on AVR -- table usu. smaller & faster
+static inline uint8_t reverseBits(uint8_t b) {
+  b = (b & 0xF0) >> 4 | (b & 0x0F) << 4;
+  b = (b & 0xCC) >> 2 | (b & 0x33) << 2;
+  return (b & 0xAA) >> 1 | (b & 0x55) << 1;
+}
+
 static const uint8_t set[] = {1, 2, 4, 8, 16, 32, 64, 128},
                      clr[] = {(uint8_t)~1,  (uint8_t)~2,  (uint8_t)~4,
                                       (uint8_t)~8,  (uint8_t)~16, (uint8_t)~32,
@@ -148,64 +241,228 @@ static const uint8_t set[] = {1, 2, 4, 8, 16, 32, 64, 128},
 */
 /**************************************************************************/
 void Adafruit_SharpMem::drawPixel(int16_t x, int16_t y, uint16_t color) {
-  if ((x < 0) || (x >= _width) || (y < 0) || (y >= HEIGHT))
+  if ((x < 0) || (x >= _width) || (y < 0) || (y >= _height))
     return;
+  SharpMemRotationPolicy::map(x, y, WIDTH, HEIGHT, rotation);
 
+  markDirty(y);
+  _stats.pixels++;
+  uint8_t *dst = sharpmem_buffer + y * (WIDTH / 8) + (x >> 3);
   if (color) {
-    sharpmem_buffer[(y * WIDTH + x) / 8] |= set[x % 8];
+    *dst |= set[x & 7];
   } else {
-    sharpmem_buffer[(y * WIDTH + x) / 8] &= clr[x % 8];
+    *dst &= clr[x & 7];
   }
 }
 
-void Adafruit_SharpMem::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
-  if ((x < 0) || (x >= _width) || (y < 0) || (y >= HEIGHT))
-    return;
+/**************************************************************************/
+/*!
+    @brief Sets the rotation. With a fixed SHARPMEM_ROTATION the argument is
+    ignored and the compile time rotation is kept.
+
+    @param r The rotation 0..3
+*/
+/**************************************************************************/
+void Adafruit_SharpMem::setRotation(uint8_t r) {
+#if SHARPMEM_ROTATION >= 0
+  (void)r;
+  Adafruit_GFX::setRotation(SHARPMEM_ROTATION);
+#else
+  Adafruit_GFX::setRotation(r);
+#endif
+}
 
-  int end = x+w;
-  if((end) >= WIDTH) end = WIDTH-1;
-  
+/**************************************************************************/
+/*!
+    @brief Sets or clears the buffer bits [start, end). The buffer is handled
+    as little endian 32-bit words, so with the LSB first bit order a word
+    holds 32 consecutive pixels and a span needs two edge masks at most.
+
+    @param start First bit index (y * WIDTH + x)
+    @param end Bit index after the last one
+    @param color The color to set
+*/
+/**************************************************************************/
+void Adafruit_SharpMem::fillBits(uint32_t start, uint32_t end,
+                                 uint16_t color) {
+  uint32_t *words = (uint32_t *)sharpmem_buffer;
+  uint32_t w0 = start >> 5;
+  uint32_t w1 = (end - 1) >> 5;
+  uint32_t first = 0xFFFFFFFFUL << (start & 31);
+  uint32_t last = 0xFFFFFFFFUL >> (31 - ((end - 1) & 31));
+
+  if (w0 == w1) {
+    first &= last;
+    if (color)
+      words[w0] |= first;
+    else
+      words[w0] &= ~first;
+    return;
+  }
 
   if (color) {
-    for(int i = x; i < end; i++){
-        if(i % 8 == 0 && (i - end) >= 8) {
-          sharpmem_buffer[(y * WIDTH + i) / 8] = 0xFF;
-          i += 7;
-        }
-        else {
-          sharpmem_buffer[(y * WIDTH + i) / 8] |= set[i % 8];
-        }
-    }
+    words[w0] |= first;
+    for (uint32_t i = w0 + 1; i < w1; i++)
+      words[i] = 0xFFFFFFFFUL;
+    words[w1] |= last;
+  } else {
+    words[w0] &= ~first;
+    for (uint32_t i = w0 + 1; i < w1; i++)
+      words[i] = 0;
+    words[w1] &= ~last;
   }
-  else {
-    for(int i = x; i < end; i++){
-      if(i % 8 == 0 && (i - end) >= 8) {
-          sharpmem_buffer[(y * WIDTH + i) / 8] = 0x00;
-          i += 7;
-        }
-        else {
-          sharpmem_buffer[(y * WIDTH + i) / 8] &= clr[i % 8];
-        }
-    }
+}
+
+void Adafruit_SharpMem::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  if (!SharpMemRotationPolicy::identity(rotation)) {
+    Adafruit_GFX::drawFastHLine(x, y, w, color);
+    return;
   }
+  if (x < 0) {
+    w += x;
+    x = 0;
+  }
+  if (x + w > WIDTH)
+    w = WIDTH - x;
+  if ((w <= 0) || (y < 0) || (y >= HEIGHT))
+    return;
+
+  markDirty(y);
+  _stats.pixels += w;
+  fillBits((uint32_t)y * WIDTH + x, (uint32_t)y * WIDTH + x + w, color);
 }
 
 void Adafruit_SharpMem::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color){
-  if ((x < 0) || (x >= _width) || (y < 0) || ((y) >= HEIGHT))
+  if (!SharpMemRotationPolicy::identity(rotation)) {
+    Adafruit_GFX::drawFastVLine(x, y, h, color);
+    return;
+  }
+  if (y < 0) {
+    h += y;
+    y = 0;
+  }
+  if (y + h > HEIGHT)
+    h = HEIGHT - y;
+  if ((h <= 0) || (x < 0) || (x >= WIDTH))
     return;
-  if(y+h >= HEIGHT) h = HEIGHT-y-1;
 
+  markDirty(y, y + h - 1);
+  _stats.pixels += h;
+
+  uint8_t bytes_per_line = WIDTH / 8;
+  uint8_t *dst = sharpmem_buffer + y * bytes_per_line + x / 8;
   if (color) {
     uint8_t mask = set[x % 8];
-    for(int i = y; i < y+h; i++){
-        sharpmem_buffer[(i * WIDTH + x) / 8] |= mask;
+    for (int16_t i = 0; i < h; i++, dst += bytes_per_line)
+      *dst |= mask;
+  } else {
+    uint8_t mask = clr[x % 8];
+    for (int16_t i = 0; i < h; i++, dst += bytes_per_line)
+      *dst &= mask;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief Fills a rectangle with word wide row fills
+
+    @param[in]  x
+                The x position of the upper left corner
+    @param[in]  y
+                The y position of the upper left corner
+    @param w The width in pixels
+    @param h The height in pixels
+    @param color The color to fill
+*/
+/**************************************************************************/
+void Adafruit_SharpMem::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                 uint16_t color) {
+  if (!SharpMemRotationPolicy::identity(rotation)) {
+    Adafruit_GFX::fillRect(x, y, w, h, color);
+    return;
+  }
+  if (x < 0) {
+    w += x;
+    x = 0;
+  }
+  if (y < 0) {
+    h += y;
+    y = 0;
+  }
+  if (x + w > WIDTH)
+    w = WIDTH - x;
+  if (y + h > HEIGHT)
+    h = HEIGHT - y;
+  if ((w <= 0) || (h <= 0))
+    return;
+
+  markDirty(y, y + h - 1);
+  _stats.pixels += (uint32_t)w * h;
+  for (int16_t r = y; r < y + h; r++) {
+    fillBits((uint32_t)r * WIDTH + x, (uint32_t)r * WIDTH + x + w, color);
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief Moves the content of a rectangle n pixels to the left and fills
+    the uncovered columns on the right. Rows are shifted as little endian
+    32-bit words in place, like fillBits(), so a strip chart only has to
+    draw its newest column. Rotated displays fall back to getPixel().
+
+    @param[in]  x
+                The x position of the upper left corner
+    @param[in]  y
+                The y position of the upper left corner
+    @param w The width in pixels
+    @param h The height in pixels
+    @param n The number of pixels to scroll
+    @param color The color of the uncovered columns
+*/
+/**************************************************************************/
+void Adafruit_SharpMem::scrollLeft(int16_t x, int16_t y, int16_t w, int16_t h,
+                                   int16_t n, uint16_t color) {
+  if (n <= 0)
+    return;
+  if (n >= w) {
+    fillRect(x, y, w, h, color);
+    return;
+  }
+  if (!SharpMemRotationPolicy::identity(rotation)) {
+    for (int16_t r = y; r < y + h; r++) {
+      for (int16_t c = x; c < x + w - n; c++)
+        drawPixel(c, r, getPixel(c + n, r));
     }
+    fillRect(x + w - n, y, n, h, color);
+    return;
   }
-  else {
-    uint8_t mask = clr[x % 8];
-    for(int i = y; i < y+h; i++){
-      sharpmem_buffer[(i * WIDTH + x) / 8] &= mask;
+  if ((x < 0) || (y < 0) || (x + w > WIDTH) || (y + h > HEIGHT))
+    return;
+
+  markDirty(y, y + h - 1);
+  _stats.pixels += (uint32_t)w * h;
+
+  uint32_t *words = (uint32_t *)sharpmem_buffer;
+  const uint32_t count = ((uint32_t)WIDTH * HEIGHT) / 32;
+  const uint32_t q = n >> 5, b = n & 31;
+  for (int16_t r = y; r < y + h; r++) {
+    uint32_t start = (uint32_t)r * WIDTH + x;
+    uint32_t end = start + w - n; // Destination bits [start, end)
+    uint32_t w0 = start >> 5, w1 = (end - 1) >> 5;
+    for (uint32_t k = w0; k <= w1; k++) {
+      // Sources lie above the destination, so ascending k reads unmodified
+      // words only
+      uint32_t lo = words[k + q];
+      uint32_t hi = (k + q + 1 < count) ? words[k + q + 1] : 0;
+      uint32_t bits = b ? ((lo >> b) | (hi << (32 - b))) : lo;
+      uint32_t mask = 0xFFFFFFFFUL;
+      if (k == w0)
+        mask &= 0xFFFFFFFFUL << (start & 31);
+      if (k == w1)
+        mask &= 0xFFFFFFFFUL >> (31 - ((end - 1) & 31));
+      words[k] = (words[k] & ~mask) | (bits & mask);
     }
+    fillBits(end, end + n, color);
   }
 }
 
@@ -225,23 +482,307 @@ uint8_t Adafruit_SharpMem::getPixel(uint16_t x, uint16_t y) {
   if ((x >= _width) || (y >= _height))
     return 0; // <0 test not needed, unsigned
 
-  switch (rotation) {
-  case 1:
-    _swap_uint16_t(x, y);
-    x = WIDTH - 1 - x;
-    break;
-  case 2:
-    x = WIDTH - 1 - x;
-    y = HEIGHT - 1 - y;
-    break;
-  case 3:
-    _swap_uint16_t(x, y);
-    y = HEIGHT - 1 - y;
-    break;
+  int16_t bx = x, by = y;
+  SharpMemRotationPolicy::map(bx, by, WIDTH, HEIGHT, rotation);
+  return (sharpmem_buffer[by * (WIDTH / 8) + (bx >> 3)] & set[bx & 7]) ? 1 : 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief Draws all set bits of a 1-bpp mask in one color. The mask rows use
+    the buffer bit order (LSB is the leftmost pixel) and start on a byte
+    boundary, unused bits must be zero. Rows are combined bytewise with
+    shift-and-OR and clipped to the panel, columns left of it are shifted
+    out of each row first. Rotated masks fall back to drawPixel.
+
+    @param[in]  x
+                The x position of the upper left corner
+    @param[in]  y
+                The y position of the upper left corner
+    @param mask The mask, h rows of stride bytes
+    @param w The mask width in pixels
+    @param h The mask height in pixels
+    @param stride Bytes per mask row, at least (w + 7) / 8
+    @param color The color of the set bits
+*/
+/**************************************************************************/
+void Adafruit_SharpMem::drawMask(int16_t x, int16_t y, const uint8_t *mask,
+                                 uint16_t w, uint16_t h, uint16_t stride,
+                                 uint16_t color) {
+  if ((x >= WIDTH) || (y >= HEIGHT) || (x + w <= 0) || (y + h <= 0))
+    return;
+
+  if (!SharpMemRotationPolicy::identity(rotation) ||
+      ((x < 0) && ((w + 7) / 8 > SHARPMEM_CLIP_MAX_BYTES))) {
+    for (uint16_t r = 0; r < h; r++) {
+      for (uint16_t c = 0; c < w; c++) {
+        if (mask[r * stride + c / 8] & set[c % 8])
+          drawPixel(x + c, y + r, color);
+      }
+    }
+    return;
+  }
+
+  int16_t skip = (x < 0) ? -x : 0;
+  int16_t visible = ((x + w > WIDTH) ? WIDTH - x : w) - skip;
+  uint16_t bytes = (visible + 7) / 8;
+  uint16_t src_bytes = (w + 7) / 8;
+  uint8_t first = skip >> 3;
+  uint8_t shift = skip & 7;
+  int16_t r0 = (y < 0) ? -y : 0;
+  int16_t r1 = (y + h > HEIGHT) ? HEIGHT - y : h;
+
+  _stats.pixels += (uint32_t)visible * (r1 - r0);
+  for (int16_t r = r0; r < r1; r++) {
+    const uint8_t *src = mask + r * stride;
+    markDirty(y + r);
+    if (skip == 0) {
+      blitRow(y + r, x, src, bytes, color);
+      continue;
+    }
+    uint8_t row[SHARPMEM_CLIP_MAX_BYTES];
+    for (uint16_t j = 0; j < bytes; j++) {
+      uint16_t bits = src[first + j];
+      if (first + j + 1 < src_bytes)
+        bits |= (uint16_t)src[first + j + 1] << 8;
+      row[j] = bits >> shift;
+    }
+    if (visible & 7)
+      row[bytes - 1] &= (1 << (visible & 7)) - 1;
+    blitRow(y + r, 0, row, bytes, color);
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief Combines one mask row into a buffer line with shift-and-OR. A
+    byte aligned x needs no shift and touches one buffer byte per mask byte.
+
+    @param[in]  y
+                The buffer line
+    @param[in]  x
+                The x position of the first mask bit, 0 <= x < WIDTH
+    @param src The mask row, buffer bit order
+    @param bytes Number of mask bytes
+    @param color The color of the set bits
+*/
+/**************************************************************************/
+void Adafruit_SharpMem::blitRow(int16_t y, int16_t x, const uint8_t *src,
+                                uint16_t bytes, uint16_t color) {
+  uint8_t bytes_per_line = WIDTH / 8;
+  uint8_t first = x >> 3;
+  uint8_t shift = x & 7;
+  uint8_t *dst = sharpmem_buffer + y * bytes_per_line + first;
+
+  if (shift == 0) {
+    if (color) {
+      for (uint16_t j = 0; j < bytes; j++)
+        dst[j] |= src[j];
+    } else {
+      for (uint16_t j = 0; j < bytes; j++)
+        dst[j] &= ~src[j];
+    }
+    return;
+  }
+
+  for (uint16_t j = 0; j < bytes; j++) {
+    uint16_t bits = (uint16_t)src[j] << shift;
+    bool next = (bits >> 8) && (first + j + 1 < bytes_per_line);
+    if (color) {
+      dst[j] |= bits;
+      if (next)
+        dst[j + 1] |= bits >> 8;
+    } else {
+      dst[j] &= ~bits;
+      if (next)
+        dst[j + 1] &= ~(bits >> 8);
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief Draws the set bits of an Adafruit_GFX bitmap (MSB is the leftmost
+    pixel, rows padded to whole bytes). Every row is bit reversed into the
+    buffer order once and blitted with blitRow(), clipped or rotated bitmaps
+    use the Adafruit_GFX implementation.
+
+    @param[in]  x
+                The x position of the upper left corner
+    @param[in]  y
+                The y position of the upper left corner
+    @param bitmap The bitmap in PROGMEM
+    @param w The bitmap width in pixels
+    @param h The bitmap height in pixels
+    @param color The color of the set bits
+*/
+/**************************************************************************/
+void Adafruit_SharpMem::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                                   int16_t w, int16_t h, uint16_t color) {
+  uint16_t bytes = (w + 7) / 8;
+  if ((x < 0) || (x + w > WIDTH) || (y < 0) || (y + h > HEIGHT) ||
+      !SharpMemRotationPolicy::identity(rotation) ||
+      (bytes > SHARPMEM_BLIT_MAX_BYTES)) {
+    Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color);
+    return;
+  }
+  if ((w <= 0) || (h <= 0))
+    return;
+
+  uint8_t row[SHARPMEM_BLIT_MAX_BYTES];
+  uint8_t tail = (w & 7) ? (1 << (w & 7)) - 1 : 0xFF;
+
+  markDirty(y, y + h - 1);
+  _stats.pixels += (uint32_t)w * h;
+  for (int16_t r = 0; r < h; r++) {
+    for (uint16_t j = 0; j < bytes; j++)
+      row[j] = reverseBits(pgm_read_byte(&bitmap[r * bytes + j]));
+    row[bytes - 1] &= tail;
+    blitRow(y + r, x, row, bytes, color);
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief Draws one byte of an MSB-first bitmap row, the set bits in color
+
+    @param[in]  x
+                The x position of the MSB
+    @param[in]  y
+                The y position
+    @param bits The bitmap byte
+    @param clip true to go through drawPixel (clipped, rotated)
+    @param color The color of the set bits
+*/
+/**************************************************************************/
+void Adafruit_SharpMem::blitByte(int16_t x, int16_t y, uint8_t bits, bool clip,
+                                 uint16_t color) {
+  if (clip) {
+    for (uint8_t i = 0; i < 8; i++) {
+      if (bits & (0x80 >> i))
+        drawPixel(x + i, y, color);
+    }
+    return;
+  }
+
+  uint8_t *dst = sharpmem_buffer + y * (WIDTH / 8) + (x >> 3);
+  uint16_t value = (uint16_t)reverseBits(bits) << (x & 7);
+  if (color) {
+    dst[0] |= value;
+    if (value >> 8)
+      dst[1] |= value >> 8;
+  } else {
+    dst[0] &= ~value;
+    if (value >> 8)
+      dst[1] &= ~(value >> 8);
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief Draws the set bits of a PackBits compressed bitmap. The stream
+    holds the MSB-first rows of an Adafruit_GFX bitmap. A header byte n of
+    0..127 is followed by n + 1 literal bytes, -127..-1 by one byte repeated
+    1 - n times. The bytes are decoded straight into the frame buffer, runs
+    of zero bytes are skipped without touching it.
+
+    @param[in]  x
+                The x position of the upper left corner
+    @param[in]  y
+                The y position of the upper left corner
+    @param data The PackBits stream in PROGMEM
+    @param w The bitmap width in pixels
+    @param h The bitmap height in pixels
+    @param color The color of the set bits
+*/
+/**************************************************************************/
+void Adafruit_SharpMem::drawPackedBitmap(int16_t x, int16_t y,
+                                         const uint8_t *data, int16_t w,
+                                         int16_t h, uint16_t color) {
+  if ((w <= 0) || (h <= 0))
+    return;
+
+  uint16_t bytes = (w + 7) / 8;
+  uint32_t total = (uint32_t)bytes * h;
+  uint8_t tail = (w & 7) ? (uint8_t)(0xFF << (8 - (w & 7))) : 0xFF;
+  bool clip = (x < 0) || (x + w > WIDTH) || (y < 0) || (y + h > HEIGHT) ||
+              !SharpMemRotationPolicy::identity(rotation);
+
+  if (!clip) {
+    markDirty(y, y + h - 1);
+    _stats.pixels += (uint32_t)w * h;
+  }
+
+  uint32_t index = 0;
+  uint16_t col = 0;
+  int16_t row = 0;
+  while (index < total) {
+    int8_t n = (int8_t)pgm_read_byte(data++);
+    if (n == -128)
+      continue;
+
+    uint16_t count = (n >= 0) ? n + 1 : 1 - n;
+    bool repeat = (n < 0);
+    uint8_t value = repeat ? pgm_read_byte(data++) : 0;
+    if (count > total - index)
+      count = total - index;
+
+    if (repeat && value == 0) {
+      index += count;
+      col += count;
+      row += col / bytes;
+      col %= bytes;
+      continue;
+    }
+
+    for (uint16_t i = 0; i < count; i++) {
+      uint8_t bits = repeat ? value : pgm_read_byte(data++);
+      if (col == bytes - 1)
+        bits &= tail;
+      if (bits)
+        blitByte(x + col * 8, y + row, bits, clip, color);
+      if (++col == bytes) {
+        col = 0;
+        row++;
+      }
+    }
+    index += count;
   }
+}
 
-  return sharpmem_buffer[(y * WIDTH + x) / 8] & pgm_read_byte(&set[x & 7]) ? 1
-                                                                           : 0;
+/**************************************************************************/
+/*!
+    @brief Marks the lines y0 to y1 (inclusive) for the next refresh()
+*/
+/**************************************************************************/
+void Adafruit_SharpMem::markDirty(int16_t y0, int16_t y1) {
+  for (int16_t y = y0; y <= y1;) {
+    if ((y & 31) == 0 && (y1 - y) >= 31) {
+      dirty_lines[y >> 5] = 0xFFFFFFFF;
+      y += 32;
+    } else {
+      markDirty(y++);
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief Checks if any line changed since the last refresh
+
+    @return true if a refresh would send at least one line
+*/
+/**************************************************************************/
+bool Adafruit_SharpMem::needsRefresh(void) const {
+  for (int16_t i = 0; i < (HEIGHT + 31) / 32; i++) {
+    if (dirty_lines[i])
+      return true;
+  }
+  return false;
+}
+
+void Adafruit_SharpMem::clearDirty(void) {
+  memset(dirty_lines, 0, ((HEIGHT + 31) / 32) * sizeof(uint32_t));
 }
 
 /**************************************************************************/
@@ -251,12 +792,31 @@ uint8_t Adafruit_SharpMem::getPixel(uint16_t x, uint16_t y) {
 /**************************************************************************/
 void Adafruit_SharpMem::clearDisplay() {
   memset(sharpmem_buffer, 0xff, (WIDTH * HEIGHT) / 8);
+  clearDirty(); // Buffer and panel are both white now
+  if (shadow_buffer) {
+    memset(shadow_buffer, 0xff, (WIDTH * HEIGHT) / 8);
+    _shadow_valid = true;
+  }
+
+#ifdef SHARPMEM_DMA_SUPPORTED
+  if (dma_device) {
+    waitRefresh();
+    spi_transaction_t t = {};
+    t.flags = SPI_TRANS_USE_TXDATA;
+    t.length = 16;
+    t.tx_data[0] = _sharpmem_vcom | SHARPMEM_BIT_CLEAR;
+    t.tx_data[1] = 0x00;
+    spi_device_transmit(dma_device, &t);
+    TOGGLE_VCOM;
+    return;
+  }
+#endif
 
   spidev->beginTransaction();
   // Send the clear screen command rather than doing a HW refresh (quicker)
   digitalWrite(_cs, HIGH);
 
-  uint8_t clear_data[2] = {_sharpmem_vcom | SHARPMEM_BIT_CLEAR, 0x00};
+  uint8_t clear_data[2] = {(uint8_t)(_sharpmem_vcom | SHARPMEM_BIT_CLEAR), 0x00};
   spidev->transfer(clear_data, 2);
 
   TOGGLE_VCOM;
@@ -266,40 +826,247 @@ void Adafruit_SharpMem::clearDisplay() {
 
 /**************************************************************************/
 /*!
-    @brief Renders the contents of the pixel buffer on the LCD
+    @brief Renders the contents of the pixel buffer on the LCD. Only lines
+    that changed since the last refresh are sent, consecutive lines are
+    batched into one transfer. With no changes only the VCOM toggle is sent.
 */
 /**************************************************************************/
 void Adafruit_SharpMem::refresh(void) {
-  uint16_t i, currentline;
+#ifdef SHARPMEM_DMA_SUPPORTED
+  if (dma_device) {
+    refreshAsync();
+    waitRefresh();
+    return;
+  }
+#endif
+
+  uint32_t start = micros();
+  uint8_t bytes_per_line = WIDTH / 8;
+  uint16_t chunk_lines = 0;
+
+  skipUnchanged();
+
+  _refresh_bytes = 0;
+  _refresh_lines = 0;
 
   spidev->beginTransaction();
-  // Send the write command
   digitalWrite(_cs, HIGH);
 
-  spidev->transfer(_sharpmem_vcom | SHARPMEM_BIT_WRITECMD);
+  for (int16_t y = 0; y < HEIGHT; y++) {
+    if (isDirty(y)) {
+      if (_refresh_lines == 0) {
+        // Send the write command
+        spidev->transfer(_sharpmem_vcom | SHARPMEM_BIT_WRITECMD);
+        _refresh_bytes++;
+      }
+      uint8_t *line = sharpmem_chunk + chunk_lines * (bytes_per_line + 2);
+      line[0] = y + 1; // Address byte, lines start at 1
+      memcpy(line + 1, sharpmem_buffer + y * bytes_per_line, bytes_per_line);
+      line[bytes_per_line + 1] = 0x00; // End of line
+      chunk_lines++;
+      _refresh_lines++;
+    }
+    // Flush at the end of a run of dirty lines or if the chunk is full
+    if (chunk_lines > 0 &&
+        (chunk_lines == SHARPMEM_REFRESH_CHUNK_LINES || y == HEIGHT - 1 ||
+         !isDirty(y + 1))) {
+      spidev->transfer(sharpmem_chunk, chunk_lines * (bytes_per_line + 2));
+      _refresh_bytes += chunk_lines * (bytes_per_line + 2);
+      chunk_lines = 0;
+    }
+  }
+
+  if (_refresh_lines > 0) {
+    // Send another trailing 8 bits for the last line
+    spidev->transfer(0x00);
+    _refresh_bytes++;
+  } else {
+    // Nothing changed, keep toggling VCOM with a display mode command
+    uint8_t vcom_data[2] = {_sharpmem_vcom, 0x00};
+    spidev->transfer(vcom_data, 2);
+    _refresh_bytes += 2;
+  }
   TOGGLE_VCOM;
 
+  digitalWrite(_cs, LOW);
+  spidev->endTransaction();
+
+  clearDirty();
+  _stats.lines += _refresh_lines;
+  _stats.spi_bytes += _refresh_bytes;
+  _stats.frames++;
+  _refresh_time = micros() - start;
+}
+
+/**************************************************************************/
+/*!
+    @brief Copies the dirty lines as a complete write command into dst, which
+    must hold 2 + HEIGHT * (WIDTH / 8 + 2) bytes. Clears the dirty lines and
+    toggles VCOM.
+
+    @return Number of bytes to send
+*/
+/**************************************************************************/
+uint32_t Adafruit_SharpMem::buildFrame(uint8_t *dst) {
   uint8_t bytes_per_line = WIDTH / 8;
-  uint16_t totalbytes = (WIDTH * HEIGHT) / 8;
+  uint32_t length = 1;
 
-  for (i = 0; i < totalbytes; i += bytes_per_line) {
-    uint8_t line[bytes_per_line + 2];
+  skipUnchanged();
 
-    // Send address byte
-    currentline = ((i + 1) / (WIDTH / 8)) + 1;
-    line[0] = currentline;
-    // copy over this line
-    memcpy(line + 1, sharpmem_buffer + i, bytes_per_line);
-    // Send end of line
-    line[bytes_per_line + 1] = 0x00;
-    // send it!
-    spidev->transfer(line, bytes_per_line + 2);
+  _refresh_lines = 0;
+  dst[0] = _sharpmem_vcom | SHARPMEM_BIT_WRITECMD;
+  for (int16_t y = 0; y < HEIGHT; y++) {
+    if (isDirty(y)) {
+      dst[length] = y + 1; // Address byte, lines start at 1
+      memcpy(dst + length + 1, sharpmem_buffer + y * bytes_per_line,
+             bytes_per_line);
+      dst[length + bytes_per_line + 1] = 0x00; // End of line
+      length += bytes_per_line + 2;
+      _refresh_lines++;
+    }
   }
 
-  // Send another trailing 8 bits for the last line
-  spidev->transfer(0x00);
-  digitalWrite(_cs, LOW);
-  spidev->endTransaction();
+  if (_refresh_lines > 0) {
+    dst[length++] = 0x00; // Trailing 8 bits for the last line
+  } else {
+    // Nothing changed, keep toggling VCOM with a display mode command
+    dst[0] = _sharpmem_vcom;
+    dst[1] = 0x00;
+    length = 2;
+  }
+  TOGGLE_VCOM;
+  clearDirty();
+
+  _refresh_bytes = length;
+  _stats.lines += _refresh_lines;
+  _stats.spi_bytes += length;
+  _stats.frames++;
+  return length;
+}
+
+/**************************************************************************/
+/*!
+    @brief Starts rendering the pixel buffer on the LCD and returns without
+    waiting for the transfer. The dirty lines are copied into the DMA buffer,
+    so the pixel buffer can be drawn to right away. A refresh that is still
+    in flight is waited for first. Falls back to refresh() without DMA.
+*/
+/**************************************************************************/
+void Adafruit_SharpMem::refreshAsync(void) {
+#ifdef SHARPMEM_DMA_SUPPORTED
+  if (dma_device) {
+    waitRefresh();
+
+    memset(&dma_transaction, 0, sizeof(dma_transaction));
+    dma_transaction.length = buildFrame(dma_buffer) * 8;
+    dma_transaction.tx_buffer = dma_buffer;
+    dma_transaction.user = this;
+
+    _refresh_start = micros();
+    _refresh_busy = true;
+    if (spi_device_queue_trans(dma_device, &dma_transaction, portMAX_DELAY) ==
+        ESP_OK) {
+      _dma_queued = true;
+    } else {
+      _refresh_busy = false;
+    }
+    return;
+  }
+#endif
+  refresh();
+}
+
+/**************************************************************************/
+/*!
+    @brief Blocks until an asynchronous refresh has been transmitted
+*/
+/**************************************************************************/
+void Adafruit_SharpMem::waitRefresh(void) {
+#ifdef SHARPMEM_DMA_SUPPORTED
+  if (_dma_queued) {
+    spi_transaction_t *result;
+    spi_device_get_trans_result(dma_device, &result, portMAX_DELAY);
+    _dma_queued = false;
+  }
+#endif
+}
+
+/**************************************************************************/
+/*!
+    @brief Keeps a copy of the last frame sent to the panel. Before a
+    refresh every dirty line is compared with its copy and not sent if it is
+    identical, e.g. after a region was cleared and the same content drawn
+    again. Costs one frame buffer of memory, taken from PSRAM if available.
+
+    @param enable true to allocate the shadow frame, false to free it
+    @return true on success, false if the memory could not be allocated
+*/
+/**************************************************************************/
+boolean Adafruit_SharpMem::setShadowFrame(bool enable) {
+  if (!enable) {
+    free(shadow_buffer);
+    shadow_buffer = NULL;
+    return true;
+  }
+  if (shadow_buffer)
+    return true;
+
+#ifdef ARDUINO_ARCH_ESP32
+  shadow_buffer = (uint8_t *)heap_caps_malloc(
+      (WIDTH * HEIGHT) / 8, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+#endif
+  if (!shadow_buffer)
+    shadow_buffer = (uint8_t *)malloc((WIDTH * HEIGHT) / 8);
+  if (!shadow_buffer)
+    return false;
+
+  // The panel content is unknown until the next refresh sent every line
+  _shadow_valid = false;
+  markDirty(0, HEIGHT - 1);
+  return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief Clears the dirty flag of all lines equal to the shadow frame and
+    copies the remaining dirty lines into it
+*/
+/**************************************************************************/
+void Adafruit_SharpMem::skipUnchanged(void) {
+  if (!shadow_buffer)
+    return;
+
+  uint8_t bytes_per_line = WIDTH / 8;
+  for (int16_t y = 0; y < HEIGHT; y++) {
+    if (!isDirty(y))
+      continue;
+    const uint8_t *line = sharpmem_buffer + y * bytes_per_line;
+    uint8_t *shadow = shadow_buffer + y * bytes_per_line;
+    if (_shadow_valid && memcmp(line, shadow, bytes_per_line) == 0) {
+      dirty_lines[y >> 5] &= ~(1UL << (y & 31));
+      _stats.skipped++;
+    } else {
+      memcpy(shadow, line, bytes_per_line);
+    }
+  }
+  _shadow_valid = true;
+}
+
+/**************************************************************************/
+/*!
+    @brief Writes one frame buffer line as a binary PBM (P4) row: MSB is the
+    leftmost pixel and set bits are black
+
+    @param[in]  y
+                The line (0 based)
+    @param dst  Destination for WIDTH / 8 bytes
+*/
+/**************************************************************************/
+void Adafruit_SharpMem::getPbmRow(int16_t y, uint8_t *dst) const {
+  const uint8_t *src = sharpmem_buffer + y * (WIDTH / 8);
+  for (uint8_t i = 0; i < WIDTH / 8; i++) {
+    dst[i] = ~reverseBits(src[i]);
+  }
 }
 
 /**************************************************************************/
@@ -309,4 +1076,6 @@ void Adafruit_SharpMem::refresh(void) {
 /**************************************************************************/
 void Adafruit_SharpMem::clearDisplayBuffer() {
   memset(sharpmem_buffer, 0xff, (WIDTH * HEIGHT) / 8);
+  markDirty(0, HEIGHT - 1);
+  _stats.pixels += (uint32_t)WIDTH * HEIGHT;
 }
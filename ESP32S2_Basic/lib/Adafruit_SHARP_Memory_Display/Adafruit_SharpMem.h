@@ -22,6 +22,11 @@ All text above, and the splash screen must be included in any redistribution
 #include <Adafruit_SPIDevice.h>
 #include <Arduino.h>
 
+#if defined(ARDUINO_ARCH_ESP32)
+#include "driver/spi_master.h"
+#define SHARPMEM_DMA_SUPPORTED
+#endif
+
 #if defined(RAMSTART) && defined(RAMEND) && ((RAMEND - RAMSTART) < 4096)
 #warning "Display may not work on devices with less than 4K RAM"
 #endif
@@ -30,6 +35,75 @@ All text above, and the splash screen must be included in any redistribution
 #define SHARPMEM_BIT_VCOM (0x02)     // 0x40 in LSB format
 #define SHARPMEM_BIT_CLEAR (0x04)    // 0x20 in LSB format
 
+#define SHARPMEM_REFRESH_CHUNK_LINES (8) // Lines sent per SPI transfer in refresh()
+#define SHARPMEM_BLIT_MAX_BYTES (16) // Widest row drawBitmap() blits, in bytes
+#define SHARPMEM_CLIP_MAX_BYTES (64) // Widest mask drawMask() clips on the left
+
+// Fixed display rotation 0..3, resolved at compile time. -1 keeps the
+// runtime setRotation() of Adafruit_GFX.
+#ifndef SHARPMEM_ROTATION
+#define SHARPMEM_ROTATION (-1)
+#endif
+
+/**
+ * @brief Maps rotated coordinates to frame buffer coordinates. The fixed
+ * rotations are specialized, so rotation 0 compiles to nothing and -1
+ * switches on the runtime rotation.
+ */
+template <int8_t R> struct SharpMemRotation;
+
+template <> struct SharpMemRotation<-1> {
+  /*! @brief True if the buffer and the rotated coordinates are the same */
+  static inline bool identity(uint8_t rotation) { return rotation == 0; }
+  /*! @brief Maps x/y in place, w/h are the raw buffer dimensions */
+  static inline void map(int16_t &x, int16_t &y, int16_t w, int16_t h,
+                         uint8_t rotation) {
+    int16_t t;
+    switch (rotation) {
+    case 1:
+      t = x;
+      x = w - 1 - y;
+      y = t;
+      break;
+    case 2:
+      x = w - 1 - x;
+      y = h - 1 - y;
+      break;
+    case 3:
+      t = x;
+      x = y;
+      y = h - 1 - t;
+      break;
+    }
+  }
+};
+
+template <> struct SharpMemRotation<0> {
+  static inline bool identity(uint8_t) { return true; }
+  static inline void map(int16_t &, int16_t &, int16_t, int16_t, uint8_t) {}
+};
+
+template <int8_t R> struct SharpMemRotation {
+  static inline bool identity(uint8_t) { return false; }
+  static inline void map(int16_t &x, int16_t &y, int16_t w, int16_t h,
+                         uint8_t) {
+    SharpMemRotation<-1>::map(x, y, w, h, R);
+  }
+};
+
+typedef SharpMemRotation<SHARPMEM_ROTATION> SharpMemRotationPolicy;
+
+/**
+ * @brief Drawing and transfer counters, accumulated until resetStats()
+ */
+typedef struct {
+  uint32_t pixels;    ///< Pixels written by the drawing primitives
+  uint32_t lines;     ///< Lines sent to the panel
+  uint32_t skipped;   ///< Dirty lines not sent because the shadow frame matched
+  uint32_t spi_bytes; ///< Bytes sent over SPI by refresh()
+  uint32_t frames;    ///< Number of refresh() calls
+} sharpmem_stats_t;
+
 /**
  * @brief Class to control a Sharp memory display
  *
@@ -41,19 +115,106 @@ public:
   Adafruit_SharpMem(SPIClass *theSPI, uint8_t cs, uint16_t w = 96,
                     uint16_t h = 96, uint32_t freq = 3000000);
   boolean begin();
+#ifdef SHARPMEM_DMA_SUPPORTED
+  boolean beginDMA(spi_host_device_t host = SPI3_HOST);
+#endif
   void drawPixel(int16_t x, int16_t y, uint16_t color);
+  void setRotation(uint8_t r);
   void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
   void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void scrollLeft(int16_t x, int16_t y, int16_t w, int16_t h, int16_t n,
+                  uint16_t color);
+  using Adafruit_GFX::drawBitmap;
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
+                  int16_t h, uint16_t color);
+  void drawPackedBitmap(int16_t x, int16_t y, const uint8_t *data, int16_t w,
+                        int16_t h, uint16_t color);
+  void drawMask(int16_t x, int16_t y, const uint8_t *mask, uint16_t w,
+                uint16_t h, uint16_t stride, uint16_t color);
   uint8_t getPixel(uint16_t x, uint16_t y);
   void clearDisplay();
   void refresh(void);
+  void refreshAsync(void);
+  void waitRefresh(void);
   void clearDisplayBuffer();
+  boolean setShadowFrame(bool enable);
+
+  /*! @brief True while an asynchronous refresh is being transmitted */
+  bool refreshBusy(void) const { return _refresh_busy; }
+#ifdef SHARPMEM_DMA_SUPPORTED
+  /*! @brief Task to notify (xTaskNotifyGive) when an asynchronous refresh is
+   * done, NULL to disable */
+  void setRefreshNotify(TaskHandle_t task) { _refresh_notify = task; }
+#endif
+
+  bool needsRefresh(void) const;
+  void getPbmRow(int16_t y, uint8_t *dst) const;
+  /*! @brief Frame buffer width, independent of the rotation */
+  int16_t getRawWidth(void) const { return WIDTH; }
+  /*! @brief Frame buffer height, independent of the rotation */
+  int16_t getRawHeight(void) const { return HEIGHT; }
+
+  /*! @brief Drawing and transfer counters since the last resetStats() */
+  const sharpmem_stats_t &getStats(void) const { return _stats; }
+  void resetStats(void) { memset(&_stats, 0, sizeof(_stats)); }
+
+  /*! @brief Number of bytes sent over SPI by the last refresh() */
+  uint32_t getRefreshBytes(void) const { return _refresh_bytes; }
+  /*! @brief Number of lines sent by the last refresh() */
+  uint16_t getRefreshLines(void) const { return _refresh_lines; }
+  /*! @brief Duration of the last refresh() in microseconds */
+  uint32_t getRefreshTime(void) const { return _refresh_time; }
 
 private:
   Adafruit_SPIDevice *spidev = NULL;
   uint8_t *sharpmem_buffer = NULL;
+  uint8_t *sharpmem_chunk = NULL;
+  uint32_t *dirty_lines = NULL;
+  uint8_t *shadow_buffer = NULL;
+  bool _shadow_valid = false;
   uint8_t _cs;
+  int8_t _clk = -1;
+  int8_t _mosi = -1;
+  uint32_t _freq;
   uint8_t _sharpmem_vcom;
+
+  volatile bool _refresh_busy = false;
+  uint32_t _refresh_start = 0;
+
+#ifdef SHARPMEM_DMA_SUPPORTED
+  TaskHandle_t _refresh_notify = NULL;
+  spi_device_handle_t dma_device = NULL;
+  uint8_t *dma_buffer = NULL;
+  spi_transaction_t dma_transaction;
+  bool _dma_queued = false;
+
+  static void IRAM_ATTR dmaDone(spi_transaction_t *t);
+#endif
+
+  bool allocateBuffers(void);
+  void fillBits(uint32_t start, uint32_t end, uint16_t color);
+  void blitRow(int16_t y, int16_t x, const uint8_t *src, uint16_t bytes,
+               uint16_t color);
+  void blitByte(int16_t x, int16_t y, uint8_t bits, bool clip, uint16_t color);
+  uint32_t buildFrame(uint8_t *dst);
+  void skipUnchanged(void);
+
+  uint32_t _refresh_bytes = 0;
+  uint16_t _refresh_lines = 0;
+  uint32_t _refresh_time = 0;
+  sharpmem_stats_t _stats = {};
+
+  // One bit per display line, set by every drawing primitive and cleared by
+  // refresh()
+  inline void markDirty(int16_t y) {
+    dirty_lines[y >> 5] |= (1UL << (y & 31));
+  }
+  inline bool isDirty(int16_t y) const {
+    return dirty_lines[y >> 5] & (1UL << (y & 31));
+  }
+  void markDirty(int16_t y0, int16_t y1);
+  void clearDirty(void);
 };
 
 #endif
@@ -106,12 +106,12 @@ void QMC5883LCompass::setCalibration(int x_min, int x_max, int y_min, int y_max,
 }
 
 
-void QMC5883LCompass::read(){
+bool QMC5883LCompass::read(){
 	Wire.beginTransmission(_ADDR);
 	Wire.write(0x00);
 	int err = Wire.endTransmission();
-	if (!err) {
-		Wire.requestFrom(_ADDR, (byte)6);
+	bool ok = !err && Wire.requestFrom(_ADDR, (byte)6) == 6;
+	if (ok) {
 		raw[0] = (float)(int16_t)(Wire.read() | Wire.read() << 8);
 		raw[1] = (float)(int16_t)(Wire.read() | Wire.read() << 8);
 		raw[2] = (float)(int16_t)(Wire.read() | Wire.read() << 8);
@@ -121,6 +121,7 @@ void QMC5883LCompass::read(){
 		calibrated[1] = (raw[1] - yOffset) * yScale;
 		calibrated[2] = (raw[2] - zOffset) * zScale;
 	}
+	return ok;
 }
 
 
@@ -15,7 +15,7 @@ class QMC5883LCompass{
 
 	void setCalibration(int x_min, int x_max, int y_min, int y_max, int z_min, int z_max);
     void setReset();
-    void read();
+    bool read();
 
 
 
@@ -0,0 +1,154 @@
+###############################################################################
+# file    map_packer.py
+###############################################################################
+# brief   Builds the offline map pack of a launch site for the Recovery page
+###############################################################################
+# Reads 256 px Web Mercator raster tiles from a local MBTiles file or a
+# {z}/{x}/{y}.png directory (e.g. rendered from a vector source with a local
+# tile server) and writes the tiles around the site as 1-bpp PackBits
+# streams with one index per zoom level, see src/hmi/mappack.h.
+#
+#   python map_packer.py --source site.mbtiles --center 47.2368,8.8195 \
+#                        --radius 3 --zoom 13-17 --output site.pack
+#
+# Copy the pack to /maps/site.pack on the flash drive. Needs Pillow.
+###############################################################################
+
+import argparse
+import io
+import math
+import os
+import sqlite3
+import struct
+import sys
+
+from PIL import Image
+
+from icon_packer import packbits, unpackbits
+
+MAGIC = 0x50414D43                  # "CMAP"
+VERSION = 1
+TILE_SIZE = 256
+HEADER = struct.Struct("<IHHB3x")
+LEVEL = struct.Struct("<B3xIIHHI")
+ENTRY = struct.Struct("<II")
+MAX_LEVELS = 8
+
+
+def tileOf(lat, lon, zoom):
+    n = 2 ** zoom
+    phi = math.radians(lat)
+    x = (lon + 180.0) / 360.0 * n
+    y = (1.0 - math.log(math.tan(phi) + 1.0 / math.cos(phi)) / math.pi) / 2.0 * n
+    return int(x), int(y)
+
+
+class TileSource:
+    def __init__(self, path):
+        self.path = path
+        self.db = None
+        if os.path.isfile(path):
+            self.db = sqlite3.connect(path)
+
+    def read(self, zoom, x, y):
+        if self.db:
+            # MBTiles rows count from the south (TMS)
+            row = self.db.execute("SELECT tile_data FROM tiles WHERE zoom_level=? AND tile_column=? AND tile_row=?",
+                                  (zoom, x, (2 ** zoom - 1) - y)).fetchone()
+            return Image.open(io.BytesIO(row[0])) if row else None
+        for extension in ("png", "jpg", "jpeg"):
+            name = os.path.join(self.path, str(zoom), str(x), f"{y}.{extension}")
+            if os.path.exists(name):
+                return Image.open(name)
+        return None
+
+
+def toBits(image, threshold, dither):
+    """Rows of 32 bytes, LSB is the leftmost pixel, set bits are dark (drawn in black)"""
+    gray = image.convert("L")
+    if gray.size != (TILE_SIZE, TILE_SIZE):
+        gray = gray.resize((TILE_SIZE, TILE_SIZE))
+    if dither:
+        mono = gray.convert("1")
+    else:
+        mono = gray.point(lambda value: 255 if value >= threshold else 0, "1")
+    pixels = mono.load()
+    out = bytearray(TILE_SIZE * TILE_SIZE // 8)
+    for row in range(TILE_SIZE):
+        for column in range(TILE_SIZE):
+            if not pixels[column, row]:
+                out[row * TILE_SIZE // 8 + column // 8] |= 1 << (column % 8)
+    return bytes(out)
+
+
+def build(args):
+    lat, lon = (float(value) for value in args.center.split(","))
+    first, _, last = args.zoom.partition("-")
+    zooms = list(range(int(first), int(last or first) + 1))
+    if not zooms or len(zooms) > MAX_LEVELS:
+        sys.exit(f"map_packer: 1 to {MAX_LEVELS} zoom levels")
+
+    source = TileSource(args.source)
+    # Radius in degrees, the longitude span grows with the latitude
+    dLat = args.radius / 111.32
+    dLon = args.radius / (111.32 * math.cos(math.radians(lat)))
+
+    levels = []
+    for zoom in zooms:
+        x0, y0 = tileOf(lat + dLat, lon - dLon, zoom)
+        x1, y1 = tileOf(lat - dLat, lon + dLon, zoom)
+        if (x1 - x0 + 1) * (y1 - y0 + 1) > 65535:
+            sys.exit(f"map_packer: zoom {zoom} has too many tiles, reduce the radius")
+        levels.append((zoom, x0, y0, x1 - x0 + 1, y1 - y0 + 1))
+
+    offset = HEADER.size + LEVEL.size * len(levels)
+    indexOffsets = []
+    for zoom, x0, y0, columns, rows in levels:
+        indexOffsets.append(offset)
+        offset += ENTRY.size * columns * rows
+
+    blob = bytearray()
+    entries = []
+    rawSize = 0
+    missing = 0
+    for zoom, x0, y0, columns, rows in levels:
+        for y in range(y0, y0 + rows):
+            for x in range(x0, x0 + columns):
+                image = source.read(zoom, x, y)
+                if image is None:
+                    missing += 1
+                    entries.append((0, 0))
+                    continue
+                bits = toBits(image, args.threshold, args.dither)
+                if not any(bits):
+                    entries.append((0, 0))
+                    continue
+                packed = packbits(bits)
+                assert unpackbits(packed, len(bits)) == bits
+                entries.append((offset + len(blob), len(packed)))
+                blob += packed
+                rawSize += len(bits)
+        print(f"map_packer: zoom {zoom}, {columns}x{rows} tiles from {x0}/{y0}")
+
+    with open(args.output, "wb") as file:
+        file.write(HEADER.pack(MAGIC, VERSION, TILE_SIZE, len(levels)))
+        for (zoom, x0, y0, columns, rows), indexOffset in zip(levels, indexOffsets):
+            file.write(LEVEL.pack(zoom, x0, y0, columns, rows, indexOffset))
+        for entry in entries:
+            file.write(ENTRY.pack(*entry))
+        file.write(blob)
+
+    print(f"map_packer: {len(entries)} tiles ({missing} missing), {rawSize} B packed to {len(blob)} B, "
+          f"{os.path.getsize(args.output)} B written to {args.output}")
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Build an offline map pack for the Recovery page")
+    parser.add_argument("--source", required=True, help="MBTiles file or {z}/{x}/{y}.png tile directory")
+    parser.add_argument("--center", required=True, help="lat,lon of the launch site in degrees")
+    parser.add_argument("--radius", type=float, default=3.0, help="covered radius in km (default 3)")
+    parser.add_argument("--zoom", default="13-17", help="zoom level or range, e.g. 13-17")
+    parser.add_argument("--threshold", type=int, default=160, help="gray level below which a pixel is black")
+    parser.add_argument("--dither", action="store_true", help="Floyd-Steinberg dithering instead of the threshold")
+    parser.add_argument("--output", default="site.pack")
+    build(parser.parse_args())
@@ -2,6 +2,7 @@
 #include "systemParser.h"
 #include "config.h"
 #include "console.h"
+#include "utils.h"
 
 SystemParser systemParser;
 Config systemConfig;
@@ -38,12 +39,17 @@ void Config::save()
   systemParser.setTelemetryMode(config.receiverMode);
   systemParser.setNeverStopLoggingFlag(config.neverStopLogging);
   systemParser.setTimeZone(config.timeZoneOffset);
+  systemParser.setPowerMode(config.powerMode);
+  fsLock();
   systemParser.saveFile("/config.json");
+  fsUnlock();
 }
 
 void Config::load()
 { 
+  fsLock();
   systemParser.loadFile("/config.json");
+  fsUnlock();
   console.log.println("Load config file");
   bool mode;
   bool stop;
@@ -80,6 +86,9 @@ void Config::load()
   } else {
     console.log.println(config.timeZoneOffset);
   }
+  if (!systemParser.getPowerMode(config.powerMode)) {
+    config.powerMode = 0;
+  }
   config.neverStopLogging = static_cast<uint8_t>(stop);
   config.receiverMode = static_cast<ReceiverTelemetryMode_e>(mode);
 }
\ No newline at end of file
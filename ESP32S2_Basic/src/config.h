@@ -8,6 +8,7 @@ typedef enum : bool{
 typedef struct {
     int16_t timeZoneOffset;
     uint8_t neverStopLogging;
+    uint8_t powerMode;
     ReceiverTelemetryMode_e receiverMode;
     char linkPhrase1[9];
     char linkPhrase2[9];
@@ -31,6 +31,13 @@
 ******************************************************************************/
 
 #include "console.h"
+#include "telemetry/stream.h"
+#include "esp32-hal-tinyusb.h"
+
+static Console* consoleInstance = nullptr;
+
+ConsoleRateLimit* ConsoleRateLimit::first = nullptr;
+portMUX_TYPE ConsoleRateLimit::lock = portMUX_INITIALIZER_UNLOCKED;
 
 bool Console::begin(void)
 {
@@ -56,6 +63,7 @@ bool Console::begin(unsigned long baud, uint32_t config, int8_t rxPin, int8_t tx
 
 bool Console::initialize(void)
 {
+  consoleInstance = this;
   initialized = true;
   bufferAccessSemaphore = xSemaphoreCreateMutex();
   xTaskCreate(writeTask, "task_consoleWrite", 4096, this, 1, &writeTaskHandle);
@@ -71,24 +79,26 @@ void Console::end(void)
 void Console::writeTask(void *pvParameter)
 {
   Console* ref = (Console*)pvParameter;
+  bool pending = false;
 
   while(ref->initialized)
   {
-    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);          // Wait on notification for data in buffer or console opened
+    // Wait on notification for data in buffer, console opened or USB FIFO space freed (TX complete event).
+    // The timeout is only a fallback in case a TX complete event got lost while data is pending.
+    ulTaskNotifyTake(pdTRUE, pending ? pdMS_TO_TICKS(CONSOLE_TX_RETRY_TIME) : portMAX_DELAY);
+    pending = false;
     if(ref->streamActive)
     {
       if(xSemaphoreTake(ref->bufferAccessSemaphore, portMAX_DELAY))
       {
-        if(ref->readIdx < ref->writeIdx)              // Regular case, no wrap around needed
+        if(ref->type == USBCDC_t && ref->directUsb)
         {
-          ref->stream.write((const uint8_t*) ref->ringBuffer + ref->readIdx, ref->writeIdx - ref->readIdx);
+          pending = ref->transmitUsb();
         }
-        else if(ref->readIdx > ref->writeIdx)         // Need to send buffer in two parts (ReadIdx to End | 0 to WriteIdx)
+        else
         {
-          ref->stream.write((const uint8_t*) ref->ringBuffer + ref->readIdx, QUEUE_BUFFER_LENGTH - ref->readIdx);
-          ref->stream.write((const uint8_t*) ref->ringBuffer, ref->writeIdx);
+          ref->transmitStream();
         }
-        ref->readIdx = ref->writeIdx;
         xSemaphoreGive(ref->bufferAccessSemaphore);
       }
     }
@@ -96,10 +106,46 @@ void Console::writeTask(void *pvParameter)
   vTaskDelete(NULL);
 }
 
+/* Copies contiguous ring buffer regions straight into the TinyUSB FIFO, never waits for space. Returns true if data is left. */
+bool Console::transmitUsb(void)
+{
+  if(!tud_cdc_n_connected(CONSOLE_CDC_ITF)) return false;
+  while(readIdx != writeIdx)
+  {
+    uint32_t space = tud_cdc_n_write_available(CONSOLE_CDC_ITF);
+    if(space == 0)
+    {
+      txStalls++;
+      break;
+    }
+    uint32_t end = (readIdx < writeIdx) ? writeIdx : QUEUE_BUFFER_LENGTH;
+    uint32_t length = tud_cdc_n_write(CONSOLE_CDC_ITF, (const uint8_t*) ringBuffer + readIdx, _min(end - readIdx, space));
+    readIdx = (readIdx + length) & (QUEUE_BUFFER_LENGTH - 1);
+    txBytes += length;
+  }
+  tud_cdc_n_write_flush(CONSOLE_CDC_ITF);
+  return readIdx != writeIdx;
+}
+
+void Console::transmitStream(void)
+{
+  if(readIdx < writeIdx)              // Regular case, no wrap around needed
+  {
+    txBytes += stream.write((const uint8_t*) ringBuffer + readIdx, writeIdx - readIdx);
+  }
+  else if(readIdx > writeIdx)         // Need to send buffer in two parts (ReadIdx to End | 0 to WriteIdx)
+  {
+    txBytes += stream.write((const uint8_t*) ringBuffer + readIdx, QUEUE_BUFFER_LENGTH - readIdx);
+    txBytes += stream.write((const uint8_t*) ringBuffer, writeIdx);
+  }
+  readIdx = writeIdx;
+}
+
 void Console::interfaceTask(void *pvParameter)
 {
   Console* ref = (Console*)pvParameter;
 
+  TickType_t summaryTimer = xTaskGetTickCount();
   TickType_t interfaceTimer = 0;
   TickType_t enabledTimer = 0;
   bool enabledOld = false, enabledDelayed = false;
@@ -126,7 +172,7 @@ void Console::interfaceTask(void *pvParameter)
     ref->streamActive = enabledDelayed && interfaceDelayed;
     if(ref->streamActive && !streamActiveOld)
     {
-      ref->printStartupMessage();
+      if(!ref->binaryMode) ref->printStartupMessage();
       vTaskDelay((const TickType_t) 10);                    // Make sure that startup message is printed befor everything else
       xTaskNotifyGive(ref->writeTaskHandle);                // Send signal to update task (for sending out data in queue buffer)
     }
@@ -137,12 +183,69 @@ void Console::interfaceTask(void *pvParameter)
     }
     streamActiveOld = ref->streamActive;
 
+    if(xTaskGetTickCount() - summaryTimer >= pdMS_TO_TICKS(CONSOLE_RATE_LIMIT_SUMMARY))
+    {
+      summaryTimer = xTaskGetTickCount();
+      ConsoleRateLimit::report(CONSOLE_RATE_LIMIT_SUMMARY);
+    }
+
     vTaskDelayUntil(&task_last_tick, (const TickType_t) 1000 / INTERFACE_UPDATE_RATE);
   }
   vTaskDelete(NULL);
 }
 
+void Console::setBinaryMode(bool state)
+{
+  if(xSemaphoreTake(bufferAccessSemaphore, portMAX_DELAY))
+  {
+    readIdx = writeIdx;                             // Never mix pending text with binary records
+    binaryMode = state;
+    xSemaphoreGive(bufferAccessSemaphore);
+  }
+}
+
+void Console::setDirectUsb(bool state)
+{
+  if(xSemaphoreTake(bufferAccessSemaphore, portMAX_DELAY))     // Never switch in the middle of a transmit pass
+  {
+    directUsb = state;
+    xSemaphoreGive(bufferAccessSemaphore);
+  }
+}
+
+bool Console::claim(void)
+{
+  bool claimed = false;
+  if(xSemaphoreTake(bufferAccessSemaphore, portMAX_DELAY))
+  {
+    if(owner == nullptr && !binaryMode)
+    {
+      owner = xTaskGetCurrentTaskHandle();
+      claimed = true;
+    }
+    xSemaphoreGive(bufferAccessSemaphore);
+  }
+  return claimed;
+}
+
+void Console::release(void)
+{
+  if(xSemaphoreTake(bufferAccessSemaphore, portMAX_DELAY))
+  {
+    owner = nullptr;
+    xSemaphoreGive(bufferAccessSemaphore);
+  }
+}
+
 size_t Console::write(const uint8_t *buffer, size_t size)
+{
+  if(binaryMode) return size;                       // Text logging is replaced by the binary stream
+  TaskHandle_t task = owner;
+  if(task != nullptr && task != xTaskGetCurrentTaskHandle()) return size;     // Another task owns the output
+  return enqueue(buffer, size);
+}
+
+size_t Console::enqueue(const uint8_t *buffer, size_t size)
 {
   if(size == 0) return 0;
   if(xSemaphoreTake(bufferAccessSemaphore, portMAX_DELAY))
@@ -164,6 +267,7 @@ size_t Console::write(const uint8_t *buffer, size_t size)
     writeIdx = (writeIdx + size) & (QUEUE_BUFFER_LENGTH - 1);
     if(size > free)
     {
+      overwrittenBytes += size - free;
       readIdx = (readIdx + (size - free)) & (QUEUE_BUFFER_LENGTH - 1);
     }
 
@@ -174,6 +278,59 @@ size_t Console::write(const uint8_t *buffer, size_t size)
   return 0;
 }
 
+ConsoleRateLimit::ConsoleRateLimit(const char* label, Print* output, uint32_t burst, uint32_t rate):
+  label(label), output(output), burst(burst), rate(rate), tokens(burst), lastRefill(millis())
+{
+  portENTER_CRITICAL(&lock);
+  next = first;
+  first = this;
+  portEXIT_CRITICAL(&lock);
+}
+
+bool ConsoleRateLimit::allow(void)
+{
+  uint32_t now = millis();
+  bool allowed = false;
+  portENTER_CRITICAL(&lock);
+  uint32_t elapsed = _min(now - lastRefill, (uint32_t) 60000);
+  uint32_t refill = elapsed * rate / 1000;
+  if(refill > 0)
+  {
+    tokens = _min(tokens + refill, burst);
+    lastRefill = (tokens == burst) ? now : lastRefill + refill * 1000 / rate;
+  }
+  if(tokens > 0)
+  {
+    tokens--;
+    allowed = true;
+  }
+  else
+  {
+    suppressed++;
+  }
+  portEXIT_CRITICAL(&lock);
+  return allowed;
+}
+
+void ConsoleRateLimit::report(uint32_t interval)
+{
+  portENTER_CRITICAL(&lock);
+  ConsoleRateLimit* limit = first;
+  portEXIT_CRITICAL(&lock);
+  while(limit != nullptr)
+  {
+    portENTER_CRITICAL(&lock);
+    uint32_t count = limit->suppressed;
+    limit->suppressed = 0;
+    portEXIT_CRITICAL(&lock);
+    if(count > 0)
+    {
+      limit->output->printf("%s x%u in last %us\n", limit->label, count, interval / 1000);
+    }
+    limit = limit->next;
+  }
+}
+
 void Console::printTimestamp(void)
 {
   int h = _min(millis() / 3600000, 99);
@@ -185,12 +342,16 @@ void Console::printTimestamp(void)
 
 void Console::printStartupMessage(void)
 {
-  stream.print(CONSOLE_CLEAR);
-  stream.print(CONSOLE_COLOR_BOLD_CYAN CONSOLE_BACKGROUND_DEFAULT);
-  stream.println("****************************************************");
-  stream.println("*                CATS Groundstation                *");
-  stream.println("****************************************************");
-  stream.println(CONSOLE_LOG);
+  if(xSemaphoreTake(bufferAccessSemaphore, portMAX_DELAY))     // The write task accesses the USB FIFO directly
+  {
+    stream.print(CONSOLE_CLEAR);
+    stream.print(CONSOLE_COLOR_BOLD_CYAN CONSOLE_BACKGROUND_DEFAULT);
+    stream.println("****************************************************");
+    stream.println("*                CATS Groundstation                *");
+    stream.println("****************************************************");
+    stream.println(CONSOLE_LOG);
+    xSemaphoreGive(bufferAccessSemaphore);
+  }
 }
 
 void Console::usbEventCallback(void* arg, esp_event_base_t event_base, int32_t event_id, void* event_data)
@@ -206,7 +367,18 @@ void Console::usbEventCallback(void* arg, esp_event_base_t event_base, int32_t e
         break;
       case ARDUINO_USB_CDC_LINE_STATE_EVENT:
         break;
+      case ARDUINO_USB_CDC_TX_EVENT:
+        if(consoleInstance != nullptr)
+        {
+          xTaskNotifyGive(consoleInstance->writeTaskHandle);    // FIFO space has been freed, continue sending
+        }
+        break;
       case ARDUINO_USB_CDC_LINE_CODING_EVENT:
+        if(consoleInstance != nullptr)
+        {
+          // Runs in the USB event task, the stream task does the switch and its logging
+          telemetryStream.requestEnable(data->line_coding.bit_rate == CONSOLE_BINARY_BAUDRATE);
+        }
         break;
       default:
         break;
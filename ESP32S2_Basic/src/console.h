@@ -40,6 +40,12 @@
 #define QUEUE_BUFFER_LENGTH             (1<<13)       // [#]    Buffer Size must be power of 2
 #define CONSOLE_ACTIVE_DELAY            3000          // [ms]   Data transmission hold-back delay after console object has been enabled
 #define INTERFACE_ACTIVE_DELAY          1500          // [ms]   Data transmission hold-back delay after physical connection has been established (Terminal opened)
+#define CONSOLE_BINARY_BAUDRATE         1000000       // [bit/s] Opening the port with this baudrate switches the console to the binary telemetry stream
+#define CONSOLE_CDC_ITF                 0             // [#]    TinyUSB CDC instance used by USBSerial
+#define CONSOLE_RATE_LIMIT_BURST        5             // [#]    Messages a rate limited call site may print at once
+#define CONSOLE_RATE_LIMIT_RATE         2             // [1/s]  Sustained message rate of a rate limited call site
+#define CONSOLE_RATE_LIMIT_SUMMARY      1000          // [ms]   Interval of the summaries for suppressed messages
+#define CONSOLE_TX_RETRY_TIME           5             // [ms]   Fallback poll interval while the USB FIFO is full (normally woken by the TX complete event)
 
 
 #define CONSOLE_CLEAR                   "\033[2J\033[1;1H"
@@ -81,6 +87,10 @@
 
 #define DISABLE_MODULE_LEVEL            dummy
 
+// Rate limited line, e.g. CONSOLE_LIMITED(console.error, "[PARSER] CRC Failed");
+// Every call site gets its own static token bucket, suppressed lines are summarized with the same message.
+#define CONSOLE_LIMITED(status, message)  do { static ConsoleRateLimit limit(message, &(status)); if(limit.allow()) (status).println(message); } while(0)
+
 
 enum ConsoleColor {COLOR_DEFAULT, COLOR_BLACK, COLOR_RED, COLOR_GREEN, COLOR_YELLOW, COLOR_BLUE, COLOR_MAGENTA, COLOR_CYAN, COLOR_WHITE};
 
@@ -88,6 +98,7 @@ class ConsoleStatus: public Stream
 {
   public:
     Stream* console = nullptr;
+    Print* persist = nullptr;                    // Optional second sink that receives the plain text (no color codes)
     enum ConsoleType {StatusOk_t, StatusLog_t, StatusWarning_t, StatusError_t, StatusCustom_t, StatusDummy_t};
     ConsoleType type;
     bool enabled = true;
@@ -98,6 +109,7 @@ class ConsoleStatus: public Stream
     ConsoleStatus(ConsoleType t): type(t) {}
     inline void ref(Stream* c) {console = c;}
     inline void enable(bool s) {enabled = s;}
+    inline void persistTo(Print* p) {persist = p;}
     inline int available(void) {return console->available();}
     inline int read(void) {return console->read();}
     inline int peek(void) {return console->peek();}
@@ -145,6 +157,10 @@ class ConsoleStatus: public Stream
         }
       }
       size = console->write((const uint8_t*) buffer, size);
+      if(persist != nullptr)
+      {
+        persist->write((const uint8_t*) buffer, size);
+      }
       if(colorEnabled)
       {
         console->print(CONSOLE_LOG);
@@ -155,6 +171,28 @@ class ConsoleStatus: public Stream
 };
 
 
+class ConsoleRateLimit
+{
+  public:
+    ConsoleRateLimit(const char* label, Print* output, uint32_t burst = CONSOLE_RATE_LIMIT_BURST, uint32_t rate = CONSOLE_RATE_LIMIT_RATE);
+    bool allow(void);
+    static void report(uint32_t interval);       // Prints and clears the suppressed counts of all call sites
+
+  private:
+    const char* label;
+    Print* output;
+    const uint32_t burst;
+    const uint32_t rate;
+    uint32_t tokens;
+    uint32_t lastRefill;
+    uint32_t suppressed = 0;
+    ConsoleRateLimit* next = nullptr;            // Call sites are kept in an intrusive list, entries are never removed
+
+    static ConsoleRateLimit* first;
+    static portMUX_TYPE lock;
+};
+
+
 class Console: public Stream
 {
   private:
@@ -164,14 +202,23 @@ class Console: public Stream
     volatile bool initialized = false;
     volatile bool enabled = false;               // Indicates if the stream is enabled (e.g. is set after USB MSC setup is done)
     volatile bool streamActive = false;          // Indicates if the console is opened and data is tranmitted
+    volatile bool binaryMode = false;            // Text output is suppressed, only binary records are transmitted
+    volatile bool directUsb = true;              // USB CDC: feed the TinyUSB FIFO directly, otherwise through USBCDC::write like a HardwareSerial
+    volatile TaskHandle_t owner = nullptr;       // Task with exclusive text output (e.g. a file dump), the text of all others is suppressed
     volatile char ringBuffer[QUEUE_BUFFER_LENGTH];
     volatile uint32_t writeIdx = 0, readIdx = 0;
     SemaphoreHandle_t bufferAccessSemaphore = nullptr;
     TaskHandle_t writeTaskHandle = nullptr;
+    volatile uint32_t txBytes = 0;               // Bytes handed to the USB FIFO / serial driver
+    volatile uint32_t overwrittenBytes = 0;      // Bytes lost because the ring buffer was full
+    volatile uint32_t txStalls = 0;              // Number of times the FIFO was full while data was pending
     ConsoleStatus custom = ConsoleStatus(ConsoleStatus::StatusCustom_t);
 
     bool initialize(void);
     void printStartupMessage(void);
+    size_t enqueue(const uint8_t *buffer, size_t size);
+    bool transmitUsb(void);
+    void transmitStream(void);
     static void writeTask(void *pvParameter);
     static void interfaceTask(void *pvParameter);
     static void usbEventCallback(void* arg, esp_event_base_t event_base, int32_t event_id, void* event_data);
@@ -203,6 +250,18 @@ class Console: public Stream
     void end(void);
     void enable(bool state) {enabled = state;}
     void flush(void) {readIdx = writeIdx;}
+    void setBinaryMode(bool state);
+    bool isBinaryMode(void) const {return binaryMode;}
+    void setDirectUsb(bool state);    // Selects the USB transmit path, for comparing both with the shell 'bench' command
+    bool isDirectUsb(void) const {return directUsb;}
+    bool isIdle(void) const {return readIdx == writeIdx;}
+    bool claim(void);             // Gives the calling task exclusive text output until release(), fails in binary mode or if claimed
+    void release(void);
+    int availableForWrite(void) {return QUEUE_BUFFER_LENGTH - 1 - ((writeIdx - readIdx) & (QUEUE_BUFFER_LENGTH - 1));}
+    size_t writeBinary(const uint8_t *buffer, size_t size) {return binaryMode ? enqueue(buffer, size) : 0;}
+    uint32_t getTxBytes(void) const {return txBytes;}
+    uint32_t getOverwrittenBytes(void) const {return overwrittenBytes;}
+    uint32_t getTxStalls(void) const {return txStalls;}
     void printTimestamp(void);        // TODO: Add possibillity to add string as parameter
     void enableColors(bool state)
     {
@@ -215,6 +274,13 @@ class Console: public Stream
       warning.enable(level <= LEVEL_WARNING);
       error.enable(level <= LEVEL_ERROR);
     }
+    void persistTo(Print* sink, ConsoleLevel level)      // Copies all messages of the given level and above to sink (nullptr to stop)
+    {
+      log.persistTo(level <= LEVEL_LOG ? sink : nullptr);
+      ok.persistTo(level <= LEVEL_OK ? sink : nullptr);
+      warning.persistTo(level <= LEVEL_WARNING ? sink : nullptr);
+      error.persistTo(level <= LEVEL_ERROR ? sink : nullptr);
+    }
     ConsoleStatus& operator[] (ConsoleColor color)
     {
       switch(color)
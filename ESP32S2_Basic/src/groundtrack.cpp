@@ -0,0 +1,133 @@
+#include "groundtrack.h"
+#include "navigation.h"
+
+void GroundTrack::clear(){
+    started = false;
+    tolerance = TRACK_TOLERANCE;
+    count = 0;
+    windowCount = 0;
+    headValid = false;
+    generation++;
+    publish();
+}
+
+void GroundTrack::add(float lat, float lon){
+    if(!started){
+        originLat = lat;
+        originLon = lon;
+        metersPerLat = R * (PI / 180);
+        metersPerLon = cosf(lat * (PI / 180)) * R * (PI / 180);
+        vertices[0] = {0, 0};
+        count = 1;
+        started = true;
+        publish();
+        return;
+    }
+
+    track_point_t point = {(int32_t) lroundf((lon - originLon) * metersPerLon), (int32_t) lroundf((lat - originLat) * metersPerLat)};
+    const track_point_t& last = headValid ? head : vertices[count - 1];
+    if(hypotf(point.x - last.x, point.y - last.y) < TRACK_MIN_DISTANCE) return;
+
+    if(headValid){
+        // The window holds the points between the last vertex and the head, all close to the chord
+        const track_point_t& anchor = vertices[count - 1];
+        bool fits = windowCount < TRACK_WINDOW && deviation(head, anchor, point) <= tolerance;
+        for(uint32_t i = 0; i < windowCount && fits; i++){
+            fits = deviation(window[i], anchor, point) <= tolerance;
+        }
+        if(fits){
+            window[windowCount++] = head;
+        } else {
+            commit(head);
+            windowCount = 0;
+        }
+    }
+    head = point;
+    headValid = true;
+    publish();
+}
+
+/* Distance of the point from the segment a-b */
+float GroundTrack::deviation(const track_point_t& point, const track_point_t& a, const track_point_t& b){
+    float dx = b.x - a.x;
+    float dy = b.y - a.y;
+    float length = dx * dx + dy * dy;
+    float t = 0;
+    if(length > 0){
+        t = constrain(((point.x - a.x) * dx + (point.y - a.y) * dy) / length, 0.0f, 1.0f);
+    }
+    return hypotf(point.x - (a.x + t * dx), point.y - (a.y + t * dy));
+}
+
+/* A full buffer is simplified down to three quarters, so this does not repeat with the next vertices */
+void GroundTrack::commit(const track_point_t& point){
+    if(count >= TRACK_MAX_POINTS){
+        do {
+            tolerance *= 2;
+            simplify();
+        } while(count > TRACK_MAX_POINTS * 3 / 4);
+    }
+    vertices[count++] = point;
+}
+
+/* Douglas-Peucker over the vertices with an explicit stack, the first and last vertex stay */
+void GroundTrack::simplify(){
+    if(count < 3) return;
+
+    bool keep[TRACK_MAX_POINTS] = {};
+    uint8_t stack[TRACK_MAX_POINTS][2];
+    uint32_t top = 0;
+
+    keep[0] = true;
+    keep[count - 1] = true;
+    stack[top][0] = 0;
+    stack[top][1] = count - 1;
+    top++;
+
+    while(top > 0){
+        top--;
+        uint32_t first = stack[top][0];
+        uint32_t last = stack[top][1];
+
+        float maximum = 0;
+        uint32_t index = 0;
+        for(uint32_t i = first + 1; i < last; i++){
+            float d = deviation(vertices[i], vertices[first], vertices[last]);
+            if(d > maximum){
+                maximum = d;
+                index = i;
+            }
+        }
+        if(maximum <= tolerance) continue;
+
+        // Every split adds a kept vertex, so there are never more open ranges than vertices
+        keep[index] = true;
+        stack[top][0] = first;
+        stack[top][1] = index;
+        top++;
+        stack[top][0] = index;
+        stack[top][1] = last;
+        top++;
+    }
+
+    uint32_t kept = 0;
+    for(uint32_t i = 0; i < count; i++){
+        if(keep[i]) vertices[kept++] = vertices[i];
+    }
+    count = kept;
+}
+
+void GroundTrack::publish(){
+    portENTER_CRITICAL(&lock);
+    memcpy(snapshot.points, vertices, count * sizeof(track_point_t));
+    snapshot.count = count;
+    if(headValid){
+        snapshot.points[snapshot.count++] = head;
+    }
+    snapshot.generation = generation;
+    snapshot.originLat = originLat;
+    snapshot.originLon = originLon;
+    snapshot.metersPerLat = metersPerLat;
+    snapshot.metersPerLon = metersPerLon;
+    portEXIT_CRITICAL(&lock);
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <Arduino.h>
+
+#define TRACK_MAX_POINTS        64      // [#]    Vertices kept, the tolerance doubles whenever they are full
+#define TRACK_WINDOW            16      // [#]    Points since the last vertex checked against its chord
+#define TRACK_MIN_DISTANCE      5       // [m]    Radial filter, closer points are dropped
+#define TRACK_TOLERANCE         5.0f    // [m]    Initial Douglas-Peucker tolerance
+
+typedef struct {
+    int32_t x, y;                       // [m]    East and north of the launch point
+} track_point_t;
+
+/* Simplified track, the vertices followed by the latest position */
+typedef struct {
+    track_point_t points[TRACK_MAX_POINTS + 1];
+    uint32_t count;                     // [#]
+    uint32_t generation;                // [#]    Counts the restarts of the track, e.g. at a new launch
+    float originLat, originLon;         // [deg]  Launch point
+    float metersPerLat, metersPerLon;   // [m/deg]
+} track_snapshot_t;
+
+/*
+ * Ground track of one rocket with a bounded number of points. Positions
+ * closer than TRACK_MIN_DISTANCE to the last one are dropped. The others
+ * are checked against the chord from the last vertex to the new position
+ * (an opening window Douglas-Peucker), and the previous position only
+ * becomes a vertex once a point of the window deviates from that chord by
+ * more than the tolerance. A full vertex buffer doubles the tolerance and
+ * simplifies the vertices with the same criterion, so long flights keep
+ * the memory flat at the cost of detail.
+ *
+ * One task adds positions, others read a snapshot copied under a lock.
+ */
+class GroundTrack {
+    public:
+        void clear();
+        void add(float lat, float lon);
+
+        void getSnapshot(track_snapshot_t* snapshot){
+            portENTER_CRITICAL(&lock);
+            *snapshot = this->snapshot;
+            portEXIT_CRITICAL(&lock);
+        }
+
+    private:
+        static float deviation(const track_point_t& point, const track_point_t& a, const track_point_t& b);
+        void commit(const track_point_t& point);
+        void simplify();
+        void publish();
+
+        bool started = false;
+        float originLat = 0;
+        float originLon = 0;
+        float metersPerLat = 0;
+        float metersPerLon = 0;
+        float tolerance = TRACK_TOLERANCE;
+        uint32_t generation = 0;
+
+        track_point_t vertices[TRACK_MAX_POINTS];
+        uint32_t count = 0;
+        track_point_t window[TRACK_WINDOW];
+        uint32_t windowCount = 0;
+        track_point_t head;
+        bool headValid = false;
+
+        portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+        track_snapshot_t snapshot = {};
+};
@@ -132,6 +132,7 @@ const unsigned char bar_location [] PROGMEM = {
   0x11, 0x88, 0x18, 0x18, 0x0c, 0x30, 0x0c, 0x30, 0x06, 0x60, 0x03, 0xc0, 0x03, 0xc0, 0x01, 0x80
 };
 
+// 'flash', 16x16px
 const unsigned char bar_flash [] PROGMEM = {
 	0x01, 0xf0, 0x01, 0xf0, 0x03, 0xe0, 0x03, 0xc0, 0x07, 0xc0, 0x07, 0xf0, 0x0f, 0xf0, 0x0f, 0xe0, 
 	0x0f, 0xc0, 0x03, 0x80, 0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x00
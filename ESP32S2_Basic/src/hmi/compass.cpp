@@ -0,0 +1,118 @@
+#include "compass.h"
+
+/* First quarter of a sine wave in Q14, ANGLE_QUARTER + 1 entries */
+static const int16_t sineTable[ANGLE_QUARTER + 1] = {
+        0,   101,   201,   302,   402,   503,   603,   704,   804,   904,  1005,  1105,
+     1205,  1306,  1406,  1506,  1606,  1706,  1806,  1906,  2006,  2105,  2205,  2305,
+     2404,  2503,  2603,  2702,  2801,  2900,  2999,  3098,  3196,  3295,  3393,  3492,
+     3590,  3688,  3786,  3883,  3981,  4078,  4176,  4273,  4370,  4467,  4563,  4660,
+     4756,  4852,  4948,  5044,  5139,  5235,  5330,  5425,  5520,  5614,  5708,  5803,
+     5897,  5990,  6084,  6177,  6270,  6363,  6455,  6547,  6639,  6731,  6823,  6914,
+     7005,  7096,  7186,  7276,  7366,  7456,  7545,  7635,  7723,  7812,  7900,  7988,
+     8076,  8163,  8250,  8337,  8423,  8509,  8595,  8680,  8765,  8850,  8935,  9019,
+     9102,  9186,  9269,  9352,  9434,  9516,  9598,  9679,  9760,  9841,  9921, 10001,
+    10080, 10159, 10238, 10316, 10394, 10471, 10549, 10625, 10702, 10778, 10853, 10928,
+    11003, 11077, 11151, 11224, 11297, 11370, 11442, 11514, 11585, 11656, 11727, 11797,
+    11866, 11935, 12004, 12072, 12140, 12207, 12274, 12340, 12406, 12472, 12537, 12601,
+    12665, 12729, 12792, 12854, 12916, 12978, 13039, 13100, 13160, 13219, 13279, 13337,
+    13395, 13453, 13510, 13567, 13623, 13678, 13733, 13788, 13842, 13896, 13949, 14001,
+    14053, 14104, 14155, 14206, 14256, 14305, 14354, 14402, 14449, 14497, 14543, 14589,
+    14635, 14680, 14724, 14768, 14811, 14854, 14896, 14937, 14978, 15019, 15059, 15098,
+    15137, 15175, 15213, 15250, 15286, 15322, 15357, 15392, 15426, 15460, 15493, 15525,
+    15557, 15588, 15619, 15649, 15679, 15707, 15736, 15763, 15791, 15817, 15843, 15868,
+    15893, 15917, 15941, 15964, 15986, 16008, 16029, 16049, 16069, 16088, 16107, 16125,
+    16143, 16160, 16176, 16192, 16207, 16221, 16235, 16248, 16261, 16273, 16284, 16295,
+    16305, 16315, 16324, 16332, 16340, 16347, 16353, 16359, 16364, 16369, 16373, 16376,
+    16379, 16381, 16383, 16384, 16384,
+};
+
+static const char* const labels[4] = {"N", "E", "S", "W"};
+
+int32_t fixedSin(int32_t angle){
+    angle &= ANGLE_STEPS - 1;
+    if(angle < ANGLE_QUARTER) return sineTable[angle];
+    if(angle < 2 * ANGLE_QUARTER) return sineTable[2 * ANGLE_QUARTER - angle];
+    if(angle < 3 * ANGLE_QUARTER) return -sineTable[angle - 2 * ANGLE_QUARTER];
+    return -sineTable[ANGLE_STEPS - angle];
+}
+
+int32_t fixedCos(int32_t angle){
+    return fixedSin(angle + ANGLE_QUARTER);
+}
+
+int32_t radiansToAngle(float radians){
+    return (int32_t)lroundf(radians * (ANGLE_STEPS / TWO_PI)) & (ANGLE_STEPS - 1);
+}
+
+void Compass::point(int32_t angle, int16_t distance, int16_t* x, int16_t* y) const {
+    *x = cx + ((distance * fixedCos(angle) + (1 << (SINE_SHIFT - 1))) >> SINE_SHIFT);
+    *y = cy + ((distance * fixedSin(angle) + (1 << (SINE_SHIFT - 1))) >> SINE_SHIFT);
+}
+
+void Compass::clear(Adafruit_GFX& display, const Box& box){
+    if(box.w > 0 && box.h > 0){
+        display.fillRect(box.x, box.y, box.w, box.h, background);
+    }
+}
+
+void Compass::drawLabel(Adafruit_GFX& display, uint32_t index, int32_t angle){
+    int16_t x, y, x1, y1;
+    uint16_t w, h;
+
+    point(angle, radius + COMPASS_LABEL_OFFSET, &x, &y);
+    display.getTextBounds(labels[index], 0, 0, &x1, &y1, &w, &h);
+    display.setCursor(x - x1 - w / 2, y - y1 - h / 2);
+    display.print(labels[index]);
+
+    labelBox[index] = {(int16_t)(x - w / 2), (int16_t)(y - h / 2), (int16_t)w, (int16_t)h};
+}
+
+void Compass::drawArrow(Adafruit_GFX& display, int32_t angle){
+    int16_t x0, y0, x1, y1, x2, y2;
+
+    point(angle, radius - COMPASS_ARROW_TIP, &x0, &y0);
+    point(angle + COMPASS_ARROW_SPREAD, COMPASS_ARROW_BASE, &x1, &y1);
+    point(angle - COMPASS_ARROW_SPREAD, COMPASS_ARROW_BASE, &x2, &y2);
+    display.fillTriangle(x0, y0, x1, y1, x2, y2, color);
+
+    int16_t left = min(x0, min(x1, x2));
+    int16_t top = min(y0, min(y1, y2));
+    arrowBox = {left, top, (int16_t)(max(x0, max(x1, x2)) - left + 1), (int16_t)(max(y0, max(y1, y2)) - top + 1)};
+}
+
+bool Compass::update(Adafruit_GFX& display, float heading, float bearing, compass_marker_e marker){
+    int32_t north = radiansToAngle(heading) - ANGLE_QUARTER;
+    int32_t target = radiansToAngle(heading + bearing) - ANGLE_QUARTER;
+
+    if(valid && north == lastHeading && marker == lastMarker && (marker != COMPASS_ARROW || target == lastBearing)) return false;
+
+    for(uint32_t i = 0; i < 4; i++){
+        clear(display, labelBox[i]);
+    }
+    clear(display, arrowBox);
+
+    display.drawCircle(cx, cy, radius, color);
+
+    display.setFont(font);
+    display.setTextSize(1);
+    display.setTextColor(color);
+    for(uint32_t i = 0; i < 4; i++){
+        drawLabel(display, i, north + i * ANGLE_QUARTER);
+    }
+
+    if(marker == COMPASS_ARROW){
+        drawArrow(display, target);
+    } else if(marker == COMPASS_CIRCLE){
+        display.drawCircle(cx, cy, COMPASS_MARKER_RADIUS, color);
+        arrowBox = {(int16_t)(cx - COMPASS_MARKER_RADIUS), (int16_t)(cy - COMPASS_MARKER_RADIUS),
+                    2 * COMPASS_MARKER_RADIUS + 1, 2 * COMPASS_MARKER_RADIUS + 1};
+    } else {
+        arrowBox = {};
+    }
+
+    valid = true;
+    lastHeading = north;
+    lastBearing = target;
+    lastMarker = marker;
+    return true;
+}
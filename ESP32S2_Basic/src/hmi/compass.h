@@ -0,0 +1,67 @@
+#pragma once
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+
+#define ANGLE_STEPS             1024    // [#]    Fixed point angle units per turn
+#define ANGLE_QUARTER           (ANGLE_STEPS / 4)
+#define SINE_SHIFT              14      // [#]    fixedSin/fixedCos return Q14 values
+
+#define COMPASS_LABEL_OFFSET    10      // [px]   Label centres outside of the ring
+#define COMPASS_ARROW_TIP       10      // [px]   Arrow tip inside of the ring
+#define COMPASS_ARROW_BASE      30      // [px]   Distance of the arrow base corners from the centre
+#define COMPASS_ARROW_SPREAD    33      // [#]    Angle between arrow axis and base corners (~0.2 rad)
+#define COMPASS_MARKER_RADIUS   6       // [px]   Circle shown instead of the arrow
+
+typedef enum {
+    COMPASS_NONE = 0,                   // Rose only, no target
+    COMPASS_ARROW,                      // Arrow towards the target
+    COMPASS_CIRCLE,                     // Target reached
+} compass_marker_e;
+
+/* Table based sine and cosine, angle in ANGLE_STEPS per turn, result in Q14 */
+int32_t fixedSin(int32_t angle);
+int32_t fixedCos(int32_t angle);
+int32_t radiansToAngle(float radians);
+
+/*
+ * Compass rose with the N/E/S/W labels and a bearing arrow. Angles are
+ * quantized to ANGLE_STEPS, update() returns without drawing if nothing
+ * moved. Otherwise only the boxes of the previous labels and arrow are
+ * cleared before the ring, labels and arrow are drawn at the new angles.
+ */
+class Compass {
+    public:
+        Compass(int16_t cx, int16_t cy, int16_t radius, const GFXfont* font, uint16_t color, uint16_t background) :
+            cx(cx), cy(cy), radius(radius), font(font), color(color), background(background) {}
+
+        /* heading: north in screen coordinates, bearing: direction to the target relative to north */
+        bool update(Adafruit_GFX& display, float heading, float bearing, compass_marker_e marker);
+
+        /* Forces a full redraw on the next update, e.g. after the screen has been cleared */
+        void invalidate(){
+            valid = false;
+        }
+
+    private:
+        struct Box {
+            int16_t x, y, w, h;
+        };
+
+        void point(int32_t angle, int16_t distance, int16_t* x, int16_t* y) const;
+        void clear(Adafruit_GFX& display, const Box& box);
+        void drawLabel(Adafruit_GFX& display, uint32_t index, int32_t angle);
+        void drawArrow(Adafruit_GFX& display, int32_t angle);
+
+        const int16_t cx, cy, radius;
+        const GFXfont* font;
+        const uint16_t color, background;
+
+        bool valid = false;
+        int32_t lastHeading = 0;
+        int32_t lastBearing = 0;
+        compass_marker_e lastMarker = COMPASS_NONE;
+
+        Box labelBox[4] = {};
+        Box arrowBox = {};
+};
@@ -0,0 +1,57 @@
+#include "display.h"
+
+bool SharpDisplay::addGlyphCache(GlyphCache* cache){
+    if(cacheCount >= DISPLAY_MAX_GLYPH_CACHES) return false;
+    caches[cacheCount++] = cache;
+    return true;
+}
+
+GlyphCache* SharpDisplay::findCache(){
+    if(gfxFont == NULL || textsize_x != 1 || textsize_y != 1 || !SharpMemRotationPolicy::identity(rotation)) return NULL;
+    for(uint32_t i = 0; i < cacheCount; i++){
+        if(caches[i]->getFont() == gfxFont) return caches[i];
+    }
+    return NULL;
+}
+
+/* Mirrors the custom font path of Adafruit_GFX::write */
+size_t SharpDisplay::write(uint8_t c){
+    GlyphCache* cache = findCache();
+    if(cache == NULL){
+        return Adafruit_SharpMem::write(c);
+    }
+
+    if(c == '\n'){
+        cursor_x = 0;
+        cursor_y += gfxFont->yAdvance;
+    } else if(c != '\r' && cache->contains(c)){
+        const cached_glyph_t* glyph = cache->glyph(c);
+        if(glyph->width > 0 && glyph->height > 0){
+            if(wrap && (cursor_x + glyph->xOffset + glyph->width) > _width){
+                cursor_x = 0;
+                cursor_y += gfxFont->yAdvance;
+            }
+            drawMask(cursor_x + glyph->xOffset, cursor_y + glyph->yOffset, cache->mask(glyph), glyph->width, glyph->height, glyph->stride, textcolor);
+        }
+        cursor_x += glyph->xAdvance;
+    }
+    return 1;
+}
+
+uint16_t SharpDisplay::textWidth(const char* text){
+    GlyphCache* cache = findCache();
+    if(cache != NULL){
+        return cache->textWidth(text);
+    }
+
+    int16_t x1, y1;
+    uint16_t w, h;
+    getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
+    return w;
+}
+
+void SharpDisplay::drawIcon(int16_t x, int16_t y, icon_e icon, uint16_t color){
+    if(icon >= ICON_COUNT) return;
+    const packed_icon_t* entry = &iconTable[icon];
+    drawPackedBitmap(x, y, &iconData[entry->offset], entry->width, entry->height, color);
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <Adafruit_SharpMem.h>
+#include "glyphcache.h"
+#include "icons.h"
+
+#define DISPLAY_MAX_GLYPH_CACHES 4
+
+/*
+ * Sharp display with cached fonts. Text in a font with a registered
+ * GlyphCache is blitted from the pre-rasterized masks instead of going
+ * pixel by pixel through Adafruit_GFX::drawChar. Icons are decoded from
+ * the packed icon table (icons.h, generated by icon_packer.py).
+ */
+class SharpDisplay : public Adafruit_SharpMem {
+    public:
+        SharpDisplay(uint8_t clk, uint8_t mosi, uint8_t cs, uint16_t w, uint16_t h) : Adafruit_SharpMem(clk, mosi, cs, w, h) {}
+
+        bool addGlyphCache(GlyphCache* cache);
+
+        size_t write(uint8_t c) override;
+        using Print::write;
+
+        uint16_t textWidth(const char* text);
+
+        void drawIcon(int16_t x, int16_t y, icon_e icon, uint16_t color);
+
+    private:
+        GlyphCache* caches[DISPLAY_MAX_GLYPH_CACHES] = {};
+        uint32_t cacheCount = 0;
+
+        GlyphCache* findCache();
+};
@@ -0,0 +1,66 @@
+#include "glyphcache.h"
+
+bool GlyphCache::begin(){
+    uint32_t count = font->last - font->first + 1;
+    uint32_t size = 0;
+
+    for(uint32_t i = 0; i < count; i++){
+        size += ((font->glyph[i].width + 7) / 8) * font->glyph[i].height;
+    }
+
+    glyphs = (cached_glyph_t*)malloc(count * sizeof(cached_glyph_t));
+    masks = (uint8_t*)calloc(size, 1);
+    if(glyphs == NULL || masks == NULL){
+        free(glyphs);
+        free(masks);
+        glyphs = NULL;
+        masks = NULL;
+        return false;
+    }
+
+    uint32_t offset = 0;
+    for(uint32_t i = 0; i < count; i++){
+        const GFXglyph* source = &font->glyph[i];
+        cached_glyph_t* cached = &glyphs[i];
+        cached->offset = offset;
+        cached->width = source->width;
+        cached->height = source->height;
+        cached->stride = (source->width + 7) / 8;
+        cached->xAdvance = source->xAdvance;
+        cached->xOffset = source->xOffset;
+        cached->yOffset = source->yOffset;
+
+        // GFX glyph bitmaps are one continuous MSB first bit stream without row padding
+        const uint8_t* bitmap = &font->bitmap[source->bitmapOffset];
+        uint32_t bit = 0;
+        for(uint8_t y = 0; y < source->height; y++){
+            uint8_t* row = &masks[offset + y * cached->stride];
+            for(uint8_t x = 0; x < source->width; x++, bit++){
+                if(bitmap[bit / 8] & (0x80 >> (bit % 8))){
+                    row[x / 8] |= 1 << (x % 8);
+                }
+            }
+        }
+        offset += cached->stride * cached->height;
+    }
+    return true;
+}
+
+/* Same result as Adafruit_GFX::getTextBounds for a single line without wrapping */
+uint16_t GlyphCache::textWidth(const char* text) const {
+    int16_t x = 0;
+    int16_t minx = 0x7FFF;
+    int16_t maxx = -1;
+
+    for(; *text; text++){
+        uint8_t c = *text;
+        if(!contains(c)) continue;
+        const cached_glyph_t* g = glyph(c);
+        int16_t x1 = x + g->xOffset;
+        int16_t x2 = x1 + g->width - 1;
+        if(x1 < minx) minx = x1;
+        if(x2 > maxx) maxx = x2;
+        x += g->xAdvance;
+    }
+    return (maxx >= minx) ? maxx - minx + 1 : 0;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <Arduino.h>
+#include <gfxfont.h>
+
+typedef struct {
+    uint32_t offset;        // Start of the mask in the mask buffer
+    uint8_t width;
+    uint8_t height;
+    uint8_t stride;         // Bytes per mask row
+    uint8_t xAdvance;
+    int8_t xOffset;
+    int8_t yOffset;
+} cached_glyph_t;
+
+/*
+ * Glyphs of a GFX font pre-rasterized into row aligned 1-bpp masks in the
+ * bit order of the Sharp frame buffer (LSB is the leftmost pixel), so text
+ * can be blitted bytewise with Adafruit_SharpMem::drawMask.
+ */
+class GlyphCache {
+    public:
+        GlyphCache(const GFXfont* font) : font(font) {}
+        bool begin();
+
+        const GFXfont* getFont() const {
+            return font;
+        }
+
+        bool contains(uint8_t c) const {
+            return glyphs != NULL && c >= font->first && c <= font->last;
+        }
+
+        const cached_glyph_t* glyph(uint8_t c) const {
+            return &glyphs[c - font->first];
+        }
+
+        const uint8_t* mask(const cached_glyph_t* glyph) const {
+            return &masks[glyph->offset];
+        }
+
+        uint16_t textWidth(const char* text) const;
+
+    private:
+        const GFXfont* font;
+        cached_glyph_t* glyphs = NULL;
+        uint8_t* masks = NULL;
+};
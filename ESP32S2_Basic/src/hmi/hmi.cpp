@@ -3,6 +3,8 @@
 #include "console.h"
 #include "telemetry/telemetry.h"
 #include "navigation.h"
+#include "logging/crashlog.h"
+#include "power.h"
 #include <timeLib.h>
 
 extern Telemetry link1;
@@ -11,21 +13,16 @@ extern Telemetry link2;
 extern Navigation navigation;
 
 void Hmi::begin(){
-    upButton.begin();
-    downButton.begin();
-    leftButton.begin();
-    rightButton.begin();
-    centerButton.begin();
-
-    okButton.begin();
-    backButton.begin();
+    input.begin();
+    settingQueue = xQueueCreate(HMI_SETTING_QUEUE, sizeof(hmi_setting_request_t));
 
     recorder.begin();
     recorder.enable();
+    renderer.setLogIndex(&recorder.getIndex());
 
-    window.begin();
+    renderer.begin();
     initialized = true;
-    xTaskCreate(update, "task_hmi", 8196, this, 1, NULL);
+    xTaskCreate(update, "task_hmi", 8196, this, HMI_TASK_PRIORITY, NULL);
 }
 
 void Hmi::fsm(){
@@ -66,32 +63,32 @@ void Hmi::fsm(){
 /* MENU */
 
 void Hmi::initMenu(){
-    window.initMenu(menuIndex);
+    renderer.initMenu(menuIndex);
 }
 
 void Hmi::menu(){
     uint32_t oldIndex = menuIndex;
-    if(rightButton.wasPressed() && (menuIndex % 3) < 2){
+    if(input.wasPressed(BUTTON_RIGHT) && (menuIndex % 3) < 2){
         menuIndex++;
     }
     
-    if(leftButton.wasPressed() && (menuIndex % 3) > 0) {
+    if(input.wasPressed(BUTTON_LEFT) && (menuIndex % 3) > 0) {
         menuIndex--;
     }
 
-    if(downButton.wasPressed() && menuIndex < 3) {
+    if(input.wasPressed(BUTTON_DOWN) && menuIndex < 3) {
         menuIndex += 3;
     }
 
-    if(upButton.wasPressed() && menuIndex > 2) {
+    if(input.wasPressed(BUTTON_UP) && menuIndex > 2) {
         menuIndex -= 3;
     }
 
     if(menuIndex != oldIndex){
-        window.updateMenu(menuIndex);
+        renderer.updateMenu(menuIndex);
     }
 
-    if(okButton.wasPressed() || centerButton.wasPressed()){
+    if(input.wasPressed(BUTTON_OK) || input.wasPressed(BUTTON_CENTER)){
         state = (State)(menuIndex + 1);
         if(state == LIVE) {
             initLive();
@@ -113,7 +110,7 @@ void Hmi::menu(){
 /* LIVE */
 
 void Hmi::initLive(){
-    window.initLive();
+    renderer.initLive();
 }
 
 void Hmi::live(){
@@ -126,7 +123,7 @@ void Hmi::live(){
             exit = true;
         }
 
-        if(okButton.wasPressed()){
+        if(input.wasPressed(BUTTON_OK)){
             link2.disable();
             if(triggerTouchdown) {
                 link1.triggerEvent(6);
@@ -136,22 +133,18 @@ void Hmi::live(){
             }
         }
 
-        if(backButton.wasPressed() || exit){
-            window.initLive();
+        if(input.wasPressed(BUTTON_BACK) || exit){
+            renderer.initLive();
             boxWindow = false;
             enableTestMode = false;
             triggerTouchdown = false;
         }
     } else {
         /* Normal Mode */
-        bool updated = false;
-        
         if(link1.data.isUpdated() && link1.info.isUpdated()){
-            window.updateLive(&link1.data, &link1.info, 0);
-            updated = true;
+            renderer.updateLive(&link1.data, &link1.info, 0);
         } else if (link1.info.isUpdated()){
-            window.updateLive(&link1.info, 0);
-            updated = true;
+            renderer.updateLive(&link1.info, 0);
         }
 
         if(link2.data.isUpdated() && link2.info.isUpdated()){
@@ -161,30 +154,29 @@ void Hmi::live(){
             } else {
                 isLogging = false;
             }
-            window.updateLive(&link2.data, &link2.info, 1);
-            updated = true;
+            renderer.updateLive(&link2.data, &link2.info, 1);
         } else if (link2.info.isUpdated()){
-            window.updateLive(&link2.info, 1);
-            updated = true;
+            renderer.updateLive(&link2.info, 1);
         }
 
-        if(updated) {
-            window.refresh();
+        if(input.wasPressed(BUTTON_CENTER)){
+            liveCharts = !liveCharts;
+            renderer.setLiveView(liveCharts);
         }
 
-        if(backButton.wasPressed()){
+        if(input.wasPressed(BUTTON_BACK)){
             state = MENU;
-            window.initMenu(menuIndex);
+            renderer.initMenu(menuIndex);
         }
 
-        if(rightButton.pressedFor(100) && link1.data.testingMode() && link1.data.state() == 0){
-            window.initBox("Go to Testing?");
+        if(input.pressedFor(BUTTON_RIGHT, 100) && link1.data.testingMode() && link1.data.state() == 0){
+            renderer.initBox("Go to Testing?");
             boxWindow = true;
             enableTestMode = true;
         }
 
-        if(rightButton.pressedFor(100) && link1.data.testingMode() && link1.data.state() == 1){
-            window.initBox("Go to Touchdown?");
+        if(input.pressedFor(BUTTON_RIGHT, 100) && link1.data.testingMode() && link1.data.state() == 1){
+            renderer.initBox("Go to Touchdown?");
             boxWindow = true;
             triggerTouchdown = true;
         }
@@ -195,37 +187,51 @@ void Hmi::live(){
 /* RECOVERY */
 
 void Hmi::initRecovery(){
-    window.initRecovery();
+    renderer.initRecovery();
 }
 
 void Hmi::recovery(){
-    
-    EarthPoint3D a;
-    EarthPoint3D b;
-
-    a = navigation.getPointA();
-    b = navigation.getPointB();
-    if(a.lat && a.lon && b.lat && b.lon){
-        //window.updateRecovery(a, b, navigation.getHorizontalDistance(), navigation.getBearing());
-        
-    } else {
-        //window.updateRecovery(a, b);
+    if(input.wasPressed(BUTTON_BACK)){
+        state = MENU;
+        renderer.initMenu(menuIndex);
+        return;
     }
 
-    if(navigation.isUpdated()){
-        window.updateRecovery(&navigation);
+    if(input.wasPressed(BUTTON_CENTER)){
+        recoveryView = (recovery_view_e)((recoveryView + 1) % RECOVERY_VIEW_COUNT);
+        renderer.setRecoveryView(recoveryView);
     }
-    
-    if(backButton.wasPressed()){
-        state = MENU;
-        window.initMenu(menuIndex);
+
+    if(recoveryView == RECOVERY_MAP){
+        const button_e pan[] = {BUTTON_UP, BUTTON_DOWN, BUTTON_LEFT, BUTTON_RIGHT};
+        const map_control_e command[] = {MAP_PAN_UP, MAP_PAN_DOWN, MAP_PAN_LEFT, MAP_PAN_RIGHT};
+        for(uint32_t i = 0; i < 4; i++){
+            if(input.wasRepeated(pan[i])) renderer.controlMap(command[i]);
+        }
+        if(input.wasPressed(BUTTON_OK)){
+            renderer.controlMap(MAP_ZOOM_IN);
+        }
+    } else if(navigation.getTargetCount() > 1){
+        // The arrows pan the map, so the target is selected in the compass and track view
+        uint32_t count = navigation.getTargetCount();
+        if(input.wasPressed(BUTTON_DOWN)){
+            recoveryTarget = (recoveryTarget + 1) % count;
+            renderer.selectRecoveryTarget(recoveryTarget);
+        } else if(input.wasPressed(BUTTON_UP)){
+            recoveryTarget = (recoveryTarget + count - 1) % count;
+            renderer.selectRecoveryTarget(recoveryTarget);
+        }
     }
+
+    // After the button requests, which drop pending periodic updates. The heading changes with
+    // every filter step, the window skips frames in which the compass, map or track did not change
+    renderer.updateRecovery(&navigation, recoveryTarget);
 }
 
 /* TESTING */
 
 void Hmi::initTesting(){
-    window.initTesting();
+    renderer.initTesting();
 }
 
 void Hmi::testing() {
@@ -233,20 +239,20 @@ void Hmi::testing() {
     if(boxWindow){
 
         bool exit = false;
-        if(okButton.wasPressed()){
+        if(input.wasPressed(BUTTON_OK)){
             link1.triggerEvent(testingIndex + 1);
             exit = true;
         }
 
-        if(backButton.wasPressed() || exit){
-            window.initTestingReady();
-            window.updateTesting(testingIndex);
+        if(input.wasPressed(BUTTON_BACK) || exit){
+            renderer.initTestingReady();
+            renderer.updateTesting(testingIndex);
             boxWindow = false;
         }
         return;
     }
 
-    if(backButton.wasPressed()){
+    if(input.wasPressed(BUTTON_BACK)){
         state = MENU;
         if(testingState >= WAIT_FOR_START) {
             link1.exitTesting();
@@ -254,18 +260,18 @@ void Hmi::testing() {
         }
         testingState = DISCLAIMER;
         
-        window.initMenu(menuIndex);
+        renderer.initMenu(menuIndex);
     }
 
     switch(testingState){
         case DISCLAIMER: {
-            if(okButton.wasPressed()) {
+            if(input.wasPressed(BUTTON_OK)) {
                 bool connected = false; 
                 if((link1.data.getLastUpdateTime() + 1000) > xTaskGetTickCount()){
                     connected = true; 
                 }
                 
-                window.initTestingConfirmed(connected, link1.data.testingMode());
+                renderer.initTestingConfirmed(connected, link1.data.testingMode());
                 if(connected) {
                     testingState = CAN_START;
                 } else {
@@ -275,12 +281,12 @@ void Hmi::testing() {
         } break;
 
         case CAN_START: {
-            if(okButton.wasPressed()) {
+            if(input.wasPressed(BUTTON_OK)) {
                 // Disable Link2
                 link2.disable();
                 link1.enterTesting();
                 
-                window.initTestingWait();
+                renderer.initTestingWait();
 
                 startTestingTime = xTaskGetTickCount();
                 testingState = WAIT_FOR_START;
@@ -294,8 +300,8 @@ void Hmi::testing() {
                 if((link1.data.getLastUpdateTime() + 200) > xTaskGetTickCount()){
                     counter++;
                     if(link1.data.state() == 1 && counter > 5) {
-                        window.initTestingReady();
-                        window.updateTesting(0);
+                        renderer.initTestingReady();
+                        renderer.updateTesting(0);
                         testingIndex = 0;
                         testingState = STARTED;
                         counter = 0;
@@ -306,7 +312,7 @@ void Hmi::testing() {
             } 
             if((startTestingTime + 10000) < xTaskGetTickCount()) {
                     link1.disable();
-                    window.initTestingFailed();
+                    renderer.initTestingFailed();
                     testingState = FAILED;
                     counter = 0;
             }
@@ -322,13 +328,13 @@ void Hmi::testing() {
 
         case STARTED: {
             uint32_t oldIndex = testingIndex;
-            if(upButton.wasPressed() && (testingIndex % 4) > 0) {
+            if(input.wasPressed(BUTTON_UP) && (testingIndex % 4) > 0) {
                 testingIndex--;
-            } else if(downButton.wasPressed() && (testingIndex % 4) < 3) {
+            } else if(input.wasPressed(BUTTON_DOWN) && (testingIndex % 4) < 3) {
                 testingIndex++;
-            } else if (rightButton.wasPressed() && (testingIndex < 4)){
+            } else if (input.wasPressed(BUTTON_RIGHT) && (testingIndex < 4)){
                 testingIndex += 4; 
-            } else if (leftButton.wasPressed() && (testingIndex > 3)) {
+            } else if (input.wasPressed(BUTTON_LEFT) && (testingIndex > 3)) {
                 testingIndex -= 4;
             }
 
@@ -336,22 +342,22 @@ void Hmi::testing() {
                 if(link1.data.state() != 1) {
                     testingState = FAILED;
                     link1.exitTesting();
-                    window.initTestingLost();
+                    renderer.initTestingLost();
                 }
             } 
             
             if ((link1.data.getLastUpdateTime() + 1000) < xTaskGetTickCount()){
                 testingState = FAILED;
                 link1.exitTesting();
-                window.initTestingLost();
+                renderer.initTestingLost();
             }
 
             if(oldIndex != testingIndex) {
-                window.updateTesting(testingIndex);
+                renderer.updateTesting(testingIndex);
             }
 
-            if(okButton.wasPressed()) {
-                window.initTestingBox(testingIndex);
+            if(input.wasPressed(BUTTON_OK)) {
+                renderer.initTestingBox(testingIndex);
                 boxWindow = true;
             }
         } break;
@@ -364,26 +370,71 @@ void Hmi::testing() {
 /* DATA */
 
 void Hmi::initData(){
-    window.initData();
+    dataIndex = 0;
+    dataDetail = false;
+    renderer.initData();
+    renderer.updateData(dataIndex);
 }
 
+/* Row 0 is the newest log, left and right flip pages */
 void Hmi::data() {
-    if(backButton.wasPressed()){
+    uint32_t count = recorder.getIndex().getCount();
+
+    if(dataDetail){
+        if(input.wasPressed(BUTTON_BACK) || input.wasPressed(BUTTON_OK)){
+            dataDetail = false;
+            renderer.initData();
+            renderer.updateData(dataIndex);
+        }
+        return;
+    }
+
+    uint32_t oldIndex = dataIndex;
+    if(input.wasRepeated(BUTTON_DOWN) && dataIndex + 1 < count){
+        dataIndex++;
+    }
+    if(input.wasRepeated(BUTTON_UP) && dataIndex > 0){
+        dataIndex--;
+    }
+    if(input.wasPressed(BUTTON_RIGHT) && count){
+        dataIndex = min(dataIndex + WINDOW_DATA_ROWS, count - 1);
+    }
+    if(input.wasPressed(BUTTON_LEFT)){
+        dataIndex = (dataIndex >= WINDOW_DATA_ROWS) ? dataIndex - WINDOW_DATA_ROWS : 0;
+    }
+    if(dataIndex != oldIndex){
+        renderer.updateData(dataIndex);
+    }
+
+    if((input.wasPressed(BUTTON_OK) || input.wasPressed(BUTTON_CENTER)) && dataIndex < count){
+        dataDetail = true;
+        renderer.initDataDetail(dataIndex);
+    }
+
+    if(input.wasPressed(BUTTON_BACK)){
         state = MENU;
-        window.initMenu(menuIndex);
+        renderer.initMenu(menuIndex);
     }
 }
 
 /* SENSORS */
 
 void Hmi::initSensors(){
-    window.initSesnors();
+    renderer.initSensors();
+    renderer.updateSensors(&navigation);
+    sensorsUpdate = millis();
 }
 
 void Hmi::sensors() {
-    if(backButton.wasPressed()){
+    // Button events wake the task early, the readout keeps its own rate
+    if(millis() - sensorsUpdate >= 1000 / HMI_SENSORS_FREQ){
+        sensorsUpdate = millis();
+        renderer.updateSensors(&navigation);
+    }
+
+    if(input.wasPressed(BUTTON_BACK)){
         state = MENU;
-        window.initMenu(menuIndex);
+        renderer.initMenu(menuIndex);
     }
 }
 
@@ -392,177 +443,204 @@ void Hmi::sensors() {
 void Hmi::initSettings(){
     settingSubMenu = 0;
     settingIndex = -1;
-    window.initSettings(settingSubMenu);
+    renderer.initSettings(settingSubMenu);
 }
 
 void Hmi::settings(){
-    static bool keyboardActive = false;
     static bool configChanged = false;
-    static int32_t i = 0;
     if(keyboardActive){
-        if(rightButton.wasPressed() || rightButton.pressedFor(500)){
-            
-            if(i != 9 && i != 19 && i != 28 && i != 37) {
-                i++;
-                window.updateKeyboard(keyboardString, i);
-            }   
-        }
-        if(leftButton.wasPressed() || leftButton.pressedFor(500)){
-            if(i != -1 && i != 0 && i != 10 && i != 20 && i != 29) {
-                i--;
-                window.updateKeyboard(keyboardString, i);
-            }   
-        }
-        if(downButton.wasPressed() || downButton.pressedFor(500)){
-            if (i == -1){
-                i = 7;
-                window.updateKeyboard(keyboardString, i);
-            } else if (i < 15){
-                i += 10;
-                window.updateKeyboard(keyboardString, i);
-            } else if (i < 29){
-                i += 9;
-                window.updateKeyboard(keyboardString, i);
-            }  
-        }
-        if(upButton.wasPressed() || upButton.pressedFor(500)){
-            if(i > 9){
-                if(i < 25){
-                    i -= 10;
-                    window.updateKeyboard(keyboardString, i);
-                } else if (i < 38){
-                    i -= 9;
-                    window.updateKeyboard(keyboardString, i);
-                }
-            } else {
-                i = -1;
-                window.updateKeyboard(keyboardString, i);
-            } 
-        }
-        if(okButton.wasPressed() || okButton.pressedFor(500)){
-            if(i == 29) { // shift
-                window.updateKeyboard(keyboardString, i, true);
-            } else if (i == 37) { // enter
-                memcpy((char*)settingsTable[settingSubMenu][settingIndex].dataPtr, keyboardString, 8);
-                window.initSettings(settingSubMenu);
-                configChanged = true;
-                window.updateSettings(settingIndex);
-                keyboardActive = false;
-            } else {
-                window.updateKeyboard(keyboardString, i, true);
-            }
-        }
-
-        if(backButton.wasPressed()){
-            memcpy((char*)settingsTable[settingSubMenu][settingIndex].dataPtr, keyboardString, 8);
-            window.initSettings(settingSubMenu);
+        keyboard_event_e event = KEYBOARD_NONE;
+        if(input.wasRepeated(BUTTON_RIGHT)) event = max(event, keyboard.moveRight());
+        if(input.wasRepeated(BUTTON_LEFT)) event = max(event, keyboard.moveLeft());
+        if(input.wasRepeated(BUTTON_DOWN)) event = max(event, keyboard.moveDown());
+        if(input.wasRepeated(BUTTON_UP)) event = max(event, keyboard.moveUp());
+        if(input.wasRepeated(BUTTON_OK)) event = max(event, keyboard.press());
+
+        if(event == KEYBOARD_DONE || input.wasPressed(BUTTON_BACK)){
+            keyboard.store((char*)settingsTable[settingSubMenu][settingIndex].dataPtr);
+            renderer.initSettings(settingSubMenu);
             configChanged = true;
-            window.updateSettings(settingIndex);
+            renderer.updateSettings(settingIndex);
             keyboardActive = false;
+        } else if(event != KEYBOARD_NONE){
+            renderer.updateKeyboard(keyboard);
         }
 
-
     } else {
         if(settingIndex == -1){
-        if(rightButton.wasPressed() && settingSubMenu < 1){
+        if(input.wasPressed(BUTTON_RIGHT) && settingSubMenu < 1){
         settingSubMenu++;
-        window.initSettings(settingSubMenu);
+        renderer.initSettings(settingSubMenu);
         }
 
-        if(leftButton.wasPressed() && settingSubMenu > 0){
+        if(input.wasPressed(BUTTON_LEFT) && settingSubMenu > 0){
             settingSubMenu--;
-            window.initSettings(settingSubMenu);
+            renderer.initSettings(settingSubMenu);
         }
         } else {
 
             if(settingsTable[settingSubMenu][settingIndex].type == NUMBER){
-                if((rightButton.wasPressed() || rightButton.pressedFor(500)) && \
+                if(input.wasRepeated(BUTTON_RIGHT) && \
                     *(int16_t*)settingsTable[settingSubMenu][settingIndex].dataPtr < \
                     settingsTable[settingSubMenu][settingIndex].config.minmax.max) {
                         (*(int16_t*)settingsTable[settingSubMenu][settingIndex].dataPtr)++;
                         configChanged = true;
-                        window.updateSettings(settingIndex);
+                        renderer.updateSettings(settingIndex);
                 }
-                if((leftButton.wasPressed() || leftButton.pressedFor(500)) && \
+                if(input.wasRepeated(BUTTON_LEFT) && \
                     *(int16_t*)settingsTable[settingSubMenu][settingIndex].dataPtr > \
                     settingsTable[settingSubMenu][settingIndex].config.minmax.min) {
                         (*(int16_t*)settingsTable[settingSubMenu][settingIndex].dataPtr)--;
                         configChanged = true;
-                        window.updateSettings(settingIndex);
+                        renderer.updateSettings(settingIndex);
                 }
             }
 
             if(settingsTable[settingSubMenu][settingIndex].type == TOGGLE){
-                if(rightButton.wasPressed() && *(bool*)settingsTable[settingSubMenu][settingIndex].dataPtr == false) {
+                if(input.wasPressed(BUTTON_RIGHT) && *(bool*)settingsTable[settingSubMenu][settingIndex].dataPtr == false) {
                     (*(bool*)settingsTable[settingSubMenu][settingIndex].dataPtr) = true;
                     configChanged = true;
-                    window.updateSettings(settingIndex);
+                    renderer.updateSettings(settingIndex);
                 }
-                if(leftButton.wasPressed() && *(bool*)settingsTable[settingSubMenu][settingIndex].dataPtr == true) {
+                if(input.wasPressed(BUTTON_LEFT) && *(bool*)settingsTable[settingSubMenu][settingIndex].dataPtr == true) {
                     (*(bool*)settingsTable[settingSubMenu][settingIndex].dataPtr) = false;
                     configChanged = true;
-                    window.updateSettings(settingIndex);
+                    renderer.updateSettings(settingIndex);
                 }
             }
 
             if(settingsTable[settingSubMenu][settingIndex].type == STRING){
-                if(okButton.wasPressed()){
-                    memcpy(keyboardString, (char*)settingsTable[settingSubMenu][settingIndex].dataPtr, 8);
-                    
-                    window.initKeyboard(keyboardString, settingsTable[settingSubMenu][settingIndex].config.stringLength);
+                if(input.wasPressed(BUTTON_OK)){
+                    keyboard.begin((char*)settingsTable[settingSubMenu][settingIndex].dataPtr, settingsTable[settingSubMenu][settingIndex].config.stringLength);
+                    renderer.initKeyboard(keyboard);
                     keyboardActive = true;
                 }
             }
         }
 
-        if(downButton.wasPressed() && settingIndex < settingsTableValueCount[settingSubMenu]-1){
+        if(input.wasPressed(BUTTON_DOWN) && settingIndex < settingsTableValueCount[settingSubMenu]-1){
             settingIndex++;
             configChanged = true;
-            window.updateSettings(settingIndex);
+            renderer.updateSettings(settingIndex);
         }
 
-        if(upButton.wasPressed() && settingIndex > -1){
+        if(input.wasPressed(BUTTON_UP) && settingIndex > -1){
             settingIndex--;
             configChanged = true;
-            window.updateSettings(settingIndex);
+            renderer.updateSettings(settingIndex);
         }
 
         
 
-        if(backButton.wasPressed()){
+        if(input.wasPressed(BUTTON_BACK)){
             state = MENU;
             if(configChanged) {
                 configChanged = false;
                 link1.setLinkPhrase(systemConfig.config.linkPhrase1, 8);
                 link2.setLinkPhrase(systemConfig.config.linkPhrase2, 8);
                 link1.setTestingPhrase(systemConfig.config.testingPhrase, 8);
+                power.setMode((power_mode_e)systemConfig.config.powerMode);
                 systemConfig.save();
                 console.log.println("Save config");
             }
-            window.initMenu(menuIndex);
+            renderer.initMenu(menuIndex);
         }
     }
     
 }
 
+bool Hmi::changeSetting(const device_settings_t* setting, const settings_value_u& value){
+    hmi_setting_request_t request = {setting, value, xTaskGetCurrentTaskHandle()};
+    if(settingQueue == NULL) return false;
+
+    ulTaskNotifyTake(pdTRUE, 0);        // Late notification of a request that timed out
+    if(xQueueSend(settingQueue, &request, 0) != pdTRUE) return false;
+    return ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(HMI_SETTING_TIMEOUT)) > 0;
+}
+
+/* Runs in the HMI task after the FSM, so button edits and requests never interleave */
+void Hmi::applySettingRequests(){
+    hmi_setting_request_t request;
+    while(xQueueReceive(settingQueue, &request, 0) == pdTRUE){
+        const device_settings_t* setting = request.setting;
+        if(setting->type == STRING){
+            memset(setting->dataPtr, 0, setting->config.stringLength + 1);
+            strncpy((char*)setting->dataPtr, request.value.text, setting->config.stringLength);
+        } else if(setting->type == TOGGLE){
+            *(bool*)setting->dataPtr = request.value.toggle;
+        } else if(setting->type == NUMBER){
+            *(int16_t*)setting->dataPtr = request.value.number;
+        }
+        applySetting(setting);
+        systemConfig.save();
+
+        // The keyboard stores its own copy of the phrase when it is closed
+        if(state == SETTINGS && !keyboardActive){
+            renderer.initSettings(settingSubMenu);
+            renderer.updateSettings(settingIndex);
+        }
+        xTaskNotifyGive(request.caller);
+    }
+}
+
+/* Settings without an entry take effect on the next use or after a restart */
+void Hmi::applySetting(const device_settings_t* setting){
+    if(setting->dataPtr == systemConfig.config.linkPhrase1){
+        link1.setLinkPhrase(systemConfig.config.linkPhrase1, 8);
+    } else if(setting->dataPtr == systemConfig.config.linkPhrase2){
+        link2.setLinkPhrase(systemConfig.config.linkPhrase2, 8);
+    } else if(setting->dataPtr == systemConfig.config.testingPhrase){
+        link1.setTestingPhrase(systemConfig.config.testingPhrase, 8);
+    } else if(setting->dataPtr == &systemConfig.config.powerMode){
+        power.setMode((power_mode_e)systemConfig.config.powerMode);
+    }
+}
+
+/* Pages without live data only wait for buttons and the status bar */
+TickType_t Hmi::tickPeriod(){
+    bool idle = (state == MENU || state == DATA || state == SETTINGS);
+    if(idle){
+        return pdMS_TO_TICKS(1000 / HMI_IDLE_FREQ);
+    }
+    if(state == SENSORS){
+        return pdMS_TO_TICKS(1000 / HMI_SENSORS_FREQ);
+    }
+    return pdMS_TO_TICKS(1000 / HMI_TASK_FREQ);
+}
+
 void Hmi::update(void *pvParameter){
     Hmi* ref = (Hmi*)pvParameter;
 
-    ref->window.logo();
+    ref->renderer.logo();
+    ref->renderer.commit();
 
     vTaskDelay(2000);
 
     int oldUsbStatus = 0;
-    ref->window.initBar();
+    ref->renderer.initBar();
     ref->initMenu();
+    ref->renderer.commit();
 
     uint32_t barUpdate = millis();
     bool timeValid = false;
 
     while(ref->initialized){
-        TickType_t task_last_tick = xTaskGetTickCount();
+        // Wakes up on a button event or when the page needs its next periodic update
+        bool event = ref->input.receive(ref->tickPeriod());
+        crashLog.heartbeat(HEARTBEAT_HMI);
+        ref->cpuLock.acquire();
+
+        uint32_t eventTime = event ? ref->input.getEvent().time : 0;
+        ref->renderer.setEventTime(eventTime);
 
         ref->fsm();
+        ref->applySettingRequests();
+
+        // Commands like link1.triggerEvent() are issued by now, the display is drawn by the render task
+        if(event){
+            ref->commandLatency.add(micros() - eventTime);
+        }
+        ref->renderer.setEventTime(0);
 
         if(link1.data.isUpdated()){
             //ref->window.updateBar(link1.data.ts());
@@ -570,26 +648,17 @@ void Hmi::update(void *pvParameter){
 
         if(millis() - barUpdate >= 1000){
             barUpdate = millis();
-            float voltage = analogRead(18)*0.00059154929;
+            bool usb = digitalRead(21);
+            float voltage = power.sampleBattery(usb);
             if(link2.time.isUpdated()){
                 setTime(link2.time.hour(), link2.time.minute(), link2.time.second(),0,0,0);
                 adjustTime(systemConfig.config.timeZoneOffset * 3600);
                 timeValid = true;
             }
-            ref->window.updateBar(voltage, digitalRead(21), ref->isLogging, link2.location.isValid(), timeValid);
+            ref->renderer.updateBar(voltage, usb, ref->isLogging, link2.location.isValid(), timeValid);
         }
 
-        
-        
-        
-        ref->upButton.read();
-        ref->downButton.read();
-        ref->leftButton.read();
-        ref->rightButton.read();
-        ref->centerButton.read();
-
-        ref->okButton.read();
-        ref->backButton.read();
-        vTaskDelayUntil(&task_last_tick, (const TickType_t) 1000 / 50);
+        ref->renderer.commit();
+        ref->cpuLock.release();
     }
 }
\ No newline at end of file
@@ -1,23 +1,58 @@
 #pragma once
 #include <Arduino.h>
-#include "JC_Button.h"
-#include "window.h"
+#include "input.h"
+#include "renderer.h"
 #include "logging/recorder.h"
+#include "power.h"
+
+#define HMI_TASK_FREQ           50      // [Hz]   Update rate of pages with live data
+#define HMI_IDLE_FREQ           4       // [Hz]   Update rate of pages that only react to buttons
+#define HMI_SENSORS_FREQ        5       // [Hz]   Readout rate of the Sensors page, independent of the sensor rate
+#define HMI_TASK_PRIORITY       2       // [#]    Above the render task
+#define HMI_SETTING_QUEUE       4       // [#]    Setting changes of other tasks waiting for the HMI task
+#define HMI_SETTING_TIMEOUT     1000    // [ms]   Longest wait of changeSetting() until the HMI task applied it
+
+typedef struct {
+    const device_settings_t* setting;
+    settings_value_u value;
+    TaskHandle_t caller;                // Notified once the setting is saved
+} hmi_setting_request_t;
 
 
 class Hmi {
     public:
-        Hmi(const char* dir) : recorder(dir),  
-                upButton(3), 
-                downButton(4), 
-                leftButton(2), 
-                rightButton(5), 
-                centerButton(1), 
-                okButton(7), 
-                backButton(6) {}
+        Hmi(const char* dir) : recorder(dir) {}
 
         void begin();
 
+        const Window& getWindow() const {
+            return renderer.getWindow();
+        }
+
+        Window& getWindow() {
+            return renderer.getWindow();
+        }
+
+        Renderer& getRenderer() {
+            return renderer;
+        }
+
+        /* Button event until the FSM handled it, including the commands it sent */
+        LatencyHistogram& getCommandLatency() {
+            return commandLatency;
+        }
+
+        uint32_t getDroppedInputEvents() const {
+            return input.getDroppedEvents();
+        }
+
+        /*
+         * For other tasks, e.g. the shell. The HMI task owns systemConfig, it
+         * writes the value, applies only this setting and saves the config.
+         * False if that did not happen within HMI_SETTING_TIMEOUT.
+         */
+        bool changeSetting(const device_settings_t* setting, const settings_value_u& value);
+
     private:
         enum State{
             MENU = 0,
@@ -49,9 +84,12 @@ class Hmi {
 
         uint32_t settingSubMenu = 0;
         int32_t settingIndex = -1;
-        char keyboardString[9] = {};
+        Keyboard keyboard;
+        bool keyboardActive = false;
+        QueueHandle_t settingQueue = NULL;
 
         static void update (void *pvParameter);
+        TickType_t tickPeriod();
 
         void fsm();
         void initMenu();
@@ -68,24 +106,27 @@ class Hmi {
         void sensors();
         void initSettings();
         void settings();
+        void applySettingRequests();
+        void applySetting(const device_settings_t* setting);
 
         bool initialized = false;
         bool isLogging = false;
         bool boxWindow = false;
         bool enableTestMode = false;
         bool triggerTouchdown = false;
+        bool liveCharts = false;
+        recovery_view_e recoveryView = RECOVERY_COMPASS;
+        uint32_t recoveryTarget = 0;
 
-        Button upButton;
-        Button downButton;
-        Button leftButton;
-        Button rightButton;
-        Button centerButton;
-
-        Button okButton;
-        Button backButton;
+        Input input;
+        PowerLock cpuLock = PowerLock("hmi");
 
-        Window window;
+        Renderer renderer;
+        LatencyHistogram commandLatency;
 
         uint32_t menuIndex = 0;
+        uint32_t dataIndex = 0;
+        bool dataDetail = false;
+        uint32_t sensorsUpdate = 0;
 
 };
\ No newline at end of file
@@ -0,0 +1,381 @@
+// Generated by icon_packer.py from bmp.h, do not edit
+
+#include "icons.h"
+
+const uint8_t iconData[] PROGMEM = {
+    0xfa, 0x00, 0x00, 0x06, 0xfe, 0x00, 0x00, 0x1e, 0xfe, 0x00, 0x00, 0x34, 0xfe, 0x00, 0x00, 0x6c,
+    0xfe, 0x00, 0x13, 0xd8, 0x00, 0x00, 0x01, 0xb0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x06, 0xc0,
+    0x00, 0x00, 0x0d, 0x80, 0x00, 0x00, 0x1b, 0xfe, 0x00, 0x00, 0x36, 0xfe, 0x00, 0x00, 0x6c, 0xfe,
+    0x00, 0x13, 0xd8, 0x00, 0x00, 0x01, 0xb0, 0x00, 0x00, 0x03, 0x60, 0x00, 0x00, 0x06, 0xc0, 0x00,
+    0x00, 0x0d, 0x80, 0x00, 0x00, 0x1b, 0xfe, 0x00, 0x00, 0x36, 0xfe, 0x00, 0x23, 0x6c, 0x00, 0x00,
+    0x07, 0xd8, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x00, 0x18, 0xa0, 0x00, 0x00, 0x31, 0x20, 0x00, 0x00,
+    0x62, 0x20, 0x00, 0x00, 0xc4, 0x60, 0x00, 0x00, 0x78, 0xc0, 0x00, 0x00, 0x09, 0x80, 0x00, 0x00,
+    0x0b, 0xfe, 0x00, 0x00, 0x0e, 0xfe, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x73, 0x00, 0x03, 0xe0, 0x00,
+    0x00, 0x07, 0xf1, 0xc0, 0x00, 0x0e, 0x39, 0xc0, 0x00, 0x1c, 0x1d, 0xc0, 0x00, 0x39, 0xcf, 0xc0,
+    0x00, 0x73, 0xe7, 0xc0, 0x00, 0xe7, 0xf3, 0xc0, 0x01, 0xcf, 0xf9, 0xc0, 0x03, 0x9f, 0xfc, 0xe0,
+    0x07, 0x3f, 0xfe, 0x70, 0x0e, 0x7f, 0xff, 0x38, 0x1c, 0xff, 0xff, 0x9c, 0x39, 0xff, 0xff, 0xce,
+    0x13, 0xff, 0xff, 0xe4, 0x07, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xf0,
+    0x07, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xf0, 0x07, 0xfc, 0x1f, 0xf0,
+    0x07, 0xfc, 0x1f, 0xf0, 0x07, 0xfc, 0x1f, 0xf0, 0x07, 0xfc, 0x1f, 0xf0, 0x07, 0xfc, 0x1f, 0xf0,
+    0x07, 0xfc, 0x1f, 0xf0, 0x07, 0xfc, 0x1f, 0xf0, 0x07, 0xfc, 0x1f, 0xf0, 0x07, 0xfc, 0x1f, 0xf0,
+    0xf5, 0x00, 0x1f, 0x00, 0x80, 0x01, 0xc0, 0x03, 0xe0, 0x07, 0xf0, 0x0f, 0xf8, 0x1f, 0xfc, 0x1f,
+    0xfc, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03, 0xe0, 0x03,
+    0xe0, 0x03, 0xe0, 0xf5, 0x00, 0x29, 0x03, 0xff, 0xfe, 0x07, 0xff, 0xff, 0x0e, 0x00, 0x03, 0x1c,
+    0x30, 0x63, 0x38, 0x18, 0xc3, 0x70, 0x0d, 0x83, 0xe0, 0x07, 0x03, 0xe0, 0x07, 0x03, 0x70, 0x0d,
+    0x83, 0x38, 0x18, 0xc3, 0x1c, 0x30, 0x63, 0x0e, 0x00, 0x03, 0x07, 0xff, 0xff, 0x03, 0xff, 0xfe,
+    0xef, 0x00, 0xfe, 0x00, 0x19, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18,
+    0x00, 0x18, 0x00, 0x18, 0x06, 0x18, 0x0e, 0x38, 0x1f, 0xf8, 0x1f, 0xf0, 0x0e, 0x00, 0x06, 0xfe,
+    0x00, 0xee, 0x00, 0x2b, 0xe0, 0x00, 0x03, 0xf8, 0x00, 0x07, 0xfc, 0x00, 0x07, 0xbc, 0x00, 0x07,
+    0x1c, 0x00, 0x07, 0xbc, 0x00, 0x03, 0xf8, 0x00, 0x03, 0xf8, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xf0,
+    0x80, 0x00, 0xe0, 0xc0, 0x00, 0xe7, 0xe0, 0x00, 0xe7, 0xe0, 0x00, 0x40, 0xc0, 0x00, 0x40, 0x80,
+    0xf8, 0x00, 0xee, 0x00, 0x2b, 0xe0, 0x00, 0x03, 0xf8, 0x00, 0x07, 0xfc, 0x00, 0x07, 0xbc, 0x00,
+    0x07, 0x1c, 0x00, 0x07, 0xbc, 0x00, 0x03, 0xf8, 0x00, 0x03, 0xf8, 0x00, 0x01, 0xf0, 0x00, 0x01,
+    0xf1, 0x80, 0x00, 0xe3, 0xc0, 0x00, 0xe7, 0xe0, 0x00, 0xe1, 0x80, 0x00, 0x41, 0x80, 0x00, 0x41,
+    0x80, 0xf8, 0x00, 0xef, 0x00, 0x26, 0x01, 0xff, 0x80, 0x01, 0xff, 0x80, 0x0f, 0x00, 0xf0, 0x0f,
+    0x00, 0xf0, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x60, 0x00, 0xc6, 0x60, 0x01, 0x86, 0x60, 0x03,
+    0x06, 0xc0, 0x06, 0x03, 0xc0, 0x0c, 0x03, 0xc0, 0x18, 0x03, 0xc0, 0x30, 0x03, 0xfb, 0xff, 0xf8,
+    0x00, 0xee, 0x00, 0x2a, 0x30, 0x00, 0x00, 0x78, 0x00, 0x00, 0xfc, 0x00, 0x01, 0xfe, 0x00, 0x03,
+    0xff, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30,
+    0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x01, 0xfe, 0x00, 0x01, 0xfe, 0xf7,
+    0x00, 0xf7, 0x00, 0x37, 0x3e, 0x00, 0x00, 0x22, 0x00, 0x00, 0xff, 0x80, 0x01, 0x00, 0x40, 0x01,
+    0x00, 0x40, 0x01, 0x00, 0x40, 0x01, 0x7f, 0x40, 0x01, 0x7f, 0x40, 0x01, 0x7f, 0x40, 0x01, 0x7f,
+    0x40, 0x01, 0x7f, 0x40, 0x01, 0x7f, 0x40, 0x01, 0x7f, 0x40, 0x01, 0x7f, 0x40, 0x01, 0x7f, 0x40,
+    0x01, 0x7f, 0x40, 0x01, 0x7f, 0x40, 0x01, 0x00, 0x40, 0x00, 0xff, 0x80, 0xfb, 0x00, 0xf2, 0x00,
+    0x32, 0x0f, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0x18, 0x00, 0x30, 0x18, 0x7c, 0x30, 0x18, 0xfe, 0x30,
+    0x18, 0x86, 0x30, 0x18, 0x06, 0x30, 0x18, 0x0e, 0x30, 0x18, 0x1c, 0x30, 0x18, 0x38, 0x30, 0x18,
+    0x70, 0x30, 0x18, 0xe0, 0x30, 0x18, 0xfe, 0x30, 0x18, 0xfe, 0x30, 0x18, 0x00, 0x30, 0x1f, 0xff,
+    0xf0, 0x0f, 0xff, 0xe0, 0xfb, 0x00, 0xf2, 0x00, 0x32, 0x0f, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0x18,
+    0x00, 0x30, 0x18, 0x18, 0x30, 0x18, 0x38, 0x30, 0x18, 0x78, 0x30, 0x18, 0x58, 0x30, 0x18, 0x18,
+    0x30, 0x18, 0x18, 0x30, 0x18, 0x18, 0x30, 0x18, 0x18, 0x30, 0x18, 0x18, 0x30, 0x18, 0x18, 0x30,
+    0x18, 0x3c, 0x30, 0x18, 0x00, 0x30, 0x1f, 0xff, 0xf0, 0x0f, 0xff, 0xe0, 0xfb, 0x00, 0xfc, 0x00,
+    0x13, 0x03, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x60, 0x70, 0x70, 0xe0, 0x39, 0xc0,
+    0x1f, 0x80, 0x0f, 0x00, 0x06, 0xfa, 0x00, 0xfd, 0x00, 0x15, 0x38, 0x0e, 0x1c, 0x1c, 0x0e, 0x38,
+    0x07, 0x70, 0x03, 0xe0, 0x01, 0xc0, 0x03, 0xe0, 0x07, 0x70, 0x0e, 0x38, 0x1c, 0x1c, 0x38, 0x0e,
+    0xfb, 0x00, 0x1f, 0x0f, 0xfc, 0x18, 0x06, 0x37, 0xfe, 0x77, 0xfe, 0x67, 0xfe, 0x67, 0xfe, 0x60,
+    0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x78, 0x06, 0x60, 0x06, 0x60,
+    0x06, 0x3f, 0xfc, 0xfd, 0x00, 0x17, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
+    0x01, 0x80, 0x05, 0xa0, 0x27, 0xe4, 0x23, 0xc4, 0x21, 0x84, 0x3f, 0xfc, 0x3f, 0xfc, 0xfd, 0x00,
+    0x1f, 0x07, 0xe0, 0x0e, 0x70, 0x18, 0x18, 0x33, 0xcc, 0x36, 0x6c, 0x36, 0x6c, 0x36, 0x6c, 0x33,
+    0xcc, 0x11, 0x88, 0x18, 0x18, 0x0c, 0x30, 0x0c, 0x30, 0x06, 0x60, 0x03, 0xc0, 0x03, 0xc0, 0x01,
+    0x80, 0x1c, 0x01, 0xf0, 0x01, 0xf0, 0x03, 0xe0, 0x03, 0xc0, 0x07, 0xc0, 0x07, 0xf0, 0x0f, 0xf0,
+    0x0f, 0xe0, 0x0f, 0xc0, 0x03, 0x80, 0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x08, 0xfe,
+    0x00, 0xfa, 0x00, 0x00, 0x7f, 0xfb, 0x00, 0x01, 0x0f, 0xff, 0xfb, 0x00, 0x01, 0xff, 0xff, 0xfc,
+    0x00, 0x02, 0x03, 0xfe, 0x07, 0xfc, 0x00, 0x02, 0x1f, 0xe0, 0x07, 0xfc, 0x00, 0x02, 0x7f, 0xe0,
+    0x07, 0xfd, 0x00, 0x03, 0x01, 0xf8, 0x70, 0x07, 0xfd, 0x00, 0x03, 0x03, 0xe0, 0x38, 0x06, 0xfd,
+    0x00, 0x03, 0x07, 0x80, 0x1c, 0x06, 0xfd, 0x00, 0x03, 0x1e, 0x00, 0x0e, 0x0e, 0xfd, 0x00, 0x03,
+    0x3c, 0x00, 0x07, 0x0e, 0xfd, 0x00, 0x03, 0x78, 0x00, 0x03, 0x8e, 0xfd, 0x00, 0x03, 0xf0, 0x00,
+    0x01, 0xcc, 0xfe, 0x00, 0x04, 0x01, 0xe0, 0x00, 0x00, 0xfc, 0xfe, 0x00, 0x04, 0x03, 0xc0, 0x00,
+    0x00, 0x7c, 0xfe, 0x00, 0x04, 0x07, 0x80, 0x00, 0x00, 0x3c, 0xfe, 0x00, 0x04, 0x0f, 0x03, 0xf0,
+    0x00, 0x38, 0xfe, 0x00, 0x6f, 0xfe, 0x0f, 0xf8, 0x00, 0x38, 0x00, 0x00, 0xff, 0xfc, 0x1f, 0x7c,
+    0x00, 0x30, 0x00, 0x03, 0xff, 0xf8, 0x3c, 0x0e, 0x00, 0x70, 0x00, 0x07, 0xf0, 0xf0, 0x38, 0x07,
+    0x00, 0x70, 0x00, 0x0f, 0x01, 0xe0, 0x30, 0x07, 0x00, 0xe0, 0x00, 0x1e, 0x03, 0xc0, 0x70, 0x07,
+    0x00, 0xe0, 0x00, 0x3c, 0x07, 0x80, 0x70, 0x03, 0x01, 0xc0, 0x00, 0x78, 0x0f, 0x00, 0x70, 0x07,
+    0x01, 0xc0, 0x00, 0xf0, 0x1e, 0x00, 0x30, 0x07, 0x03, 0x80, 0x01, 0xe0, 0x3c, 0x00, 0x38, 0x0e,
+    0x07, 0x00, 0x03, 0xc0, 0x78, 0x00, 0x1c, 0x1e, 0x0e, 0x00, 0x07, 0x80, 0xf0, 0x00, 0x1f, 0xfc,
+    0x1e, 0x00, 0x07, 0x81, 0xe0, 0x00, 0x07, 0xf8, 0x3c, 0x00, 0x0f, 0xff, 0xc0, 0x00, 0x01, 0xc0,
+    0x78, 0x00, 0x07, 0xff, 0x8c, 0xfe, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x0f, 0x0c, 0x00, 0x00, 0x01,
+    0xe0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0x00, 0x03, 0xe0, 0xe0, 0x00, 0x0f, 0xfe, 0x00, 0x04, 0x07, 0xf0, 0xf0, 0x00, 0x1e,
+    0xfe, 0x00, 0x04, 0x1f, 0x38, 0x78, 0x00, 0x3e, 0xfe, 0x00, 0x04, 0x3c, 0x1c, 0x3c, 0x00, 0x7e,
+    0xfe, 0x00, 0x04, 0x38, 0x0e, 0x1e, 0x00, 0xfe, 0xfe, 0x00, 0x04, 0x3c, 0x07, 0x0f, 0x01, 0xec,
+    0xfe, 0x00, 0x04, 0x1e, 0x03, 0x87, 0x83, 0xcc, 0xfe, 0x00, 0x04, 0x0f, 0x01, 0xc3, 0xc7, 0x8c,
+    0xfe, 0x00, 0x04, 0x07, 0x80, 0xe1, 0xef, 0x0c, 0xfe, 0x00, 0x04, 0x03, 0xc0, 0x70, 0xfe, 0x1c,
+    0xfe, 0x00, 0x04, 0x31, 0xe0, 0x38, 0x7c, 0x1c, 0xfe, 0x00, 0x04, 0x70, 0xf0, 0x1c, 0x78, 0x1c,
+    0xfe, 0x00, 0x3b, 0xe0, 0x78, 0x1e, 0xf0, 0x1c, 0x00, 0x00, 0x01, 0xc0, 0x3c, 0x3f, 0xe0, 0x38,
+    0x00, 0x00, 0x03, 0x86, 0x1e, 0x3b, 0xc0, 0x78, 0x00, 0x00, 0x07, 0x0e, 0x0f, 0x71, 0xc0, 0xf0,
+    0x00, 0x00, 0x0e, 0x1c, 0x07, 0xe1, 0xc1, 0xe0, 0x00, 0x00, 0x1c, 0x38, 0x63, 0xe0, 0xc3, 0xc0,
+    0x00, 0x00, 0x38, 0x70, 0xe1, 0xc0, 0xc7, 0x80, 0x00, 0x00, 0x30, 0xe1, 0xc0, 0x00, 0xcf, 0xfe,
+    0x00, 0x04, 0x01, 0xc3, 0x80, 0x00, 0xfe, 0xfe, 0x00, 0x04, 0x03, 0x87, 0x00, 0x00, 0xfc, 0xfe,
+    0x00, 0x04, 0x07, 0x0e, 0x00, 0x00, 0xf8, 0xfe, 0x00, 0x04, 0x0e, 0x1c, 0x00, 0x00, 0xf0, 0xfe,
+    0x00, 0x04, 0x1c, 0x38, 0x00, 0x00, 0x40, 0xfe, 0x00, 0x01, 0x38, 0x70, 0xfb, 0x00, 0x01, 0x70,
+    0x60, 0xfb, 0x00, 0x00, 0xe0, 0xfa, 0x00, 0x00, 0xc0, 0xfa, 0x00, 0x02, 0x00, 0x3f, 0x80, 0xfb,
+    0x00, 0x01, 0xff, 0xf0, 0xfc, 0x00, 0x02, 0x03, 0xff, 0xfc, 0xfc, 0x00, 0x02, 0x07, 0x80, 0x3e,
+    0xfc, 0x00, 0x02, 0x0e, 0x00, 0x0f, 0xfc, 0x00, 0x03, 0x1c, 0x00, 0x07, 0x80, 0xfd, 0x00, 0x03,
+    0x38, 0x00, 0x03, 0x80, 0xfd, 0x00, 0x03, 0x30, 0x00, 0x01, 0xc0, 0xfd, 0x00, 0x03, 0x70, 0x3f,
+    0x80, 0xc0, 0xfd, 0x00, 0x03, 0x60, 0x7f, 0xc0, 0xe0, 0xfd, 0x00, 0x03, 0xe0, 0xf1, 0xe0, 0xe0,
+    0xfd, 0x00, 0x03, 0xe0, 0xe0, 0x70, 0x60, 0xfd, 0x00, 0x03, 0xe0, 0xc0, 0x70, 0x60, 0xfd, 0x00,
+    0x03, 0xe0, 0xc0, 0x70, 0x60, 0xfd, 0x00, 0x03, 0xe0, 0xc0, 0x70, 0x60, 0xfd, 0x00, 0x03, 0xe0,
+    0xe0, 0x70, 0x60, 0xfd, 0x00, 0xfe, 0xe0, 0x00, 0x60, 0xfd, 0x00, 0x03, 0x60, 0x7f, 0xe0, 0xe0,
+    0xfd, 0x00, 0x03, 0x70, 0x3f, 0xc0, 0xe0, 0xfd, 0x00, 0x03, 0x70, 0x1f, 0x01, 0xc0, 0xfd, 0x00,
+    0x03, 0x38, 0x00, 0x01, 0xc0, 0xfd, 0x00, 0x7f, 0x38, 0x00, 0x03, 0x80, 0x00, 0x03, 0xfe, 0x00,
+    0x1c, 0x00, 0x03, 0x80, 0x00, 0x0f, 0xff, 0x80, 0x0e, 0x00, 0x07, 0x00, 0x00, 0x3f, 0x0f, 0xc0,
+    0x0e, 0x00, 0x0e, 0x00, 0x00, 0x78, 0x01, 0xf0, 0x07, 0x00, 0x0e, 0x00, 0x00, 0xf0, 0x00, 0x78,
+    0x07, 0x00, 0x1c, 0x00, 0x01, 0xc0, 0x00, 0x38, 0x03, 0x80, 0x18, 0x00, 0x03, 0xc0, 0x00, 0x1c,
+    0x01, 0xc0, 0x38, 0x00, 0x03, 0x80, 0x70, 0x0e, 0x01, 0xc0, 0x70, 0x00, 0x07, 0x01, 0xfc, 0x0e,
+    0x00, 0xe0, 0x70, 0x00, 0x07, 0x07, 0xfe, 0x06, 0x00, 0xe0, 0xe0, 0x00, 0x06, 0x07, 0x0f, 0x07,
+    0x00, 0x71, 0xc0, 0x00, 0x06, 0x0e, 0x07, 0x07, 0x00, 0x39, 0xc0, 0x00, 0x06, 0x0e, 0x03, 0x07,
+    0x00, 0x3b, 0x80, 0x00, 0x06, 0x0e, 0x03, 0x07, 0x00, 0x1f, 0x80, 0x00, 0x06, 0x0e, 0x03, 0x07,
+    0x00, 0x0f, 0x00, 0x00, 0x06, 0x0e, 0x07, 0x07, 0x37, 0x00, 0x1f, 0x00, 0x00, 0x06, 0x07, 0x0f,
+    0x07, 0x00, 0x3f, 0x80, 0x00, 0x07, 0x07, 0xfe, 0x06, 0x00, 0x39, 0xff, 0xf8, 0x07, 0x01, 0xfc,
+    0x0e, 0x00, 0x39, 0xff, 0xfe, 0x03, 0x80, 0x70, 0x0e, 0x00, 0x3f, 0xff, 0xff, 0x03, 0x80, 0x00,
+    0x1c, 0x00, 0x1f, 0x80, 0x07, 0x81, 0xc0, 0x00, 0x38, 0x00, 0x0f, 0x00, 0x03, 0x80, 0xe0, 0x00,
+    0x38, 0xfe, 0x00, 0x04, 0x01, 0x80, 0xe0, 0x00, 0x70, 0xfe, 0x00, 0x04, 0x01, 0x80, 0x70, 0x00,
+    0x70, 0xfe, 0x00, 0x04, 0x03, 0x80, 0x38, 0x00, 0xe0, 0xfe, 0x00, 0x04, 0x03, 0x80, 0x38, 0x01,
+    0xc0, 0xfe, 0x00, 0x1e, 0x07, 0x00, 0x1c, 0x01, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x0c, 0x03,
+    0x80, 0x00, 0xff, 0xff, 0xfc, 0x00, 0x0e, 0x07, 0x00, 0x01, 0xff, 0xff, 0xe0, 0x00, 0x07, 0x07,
+    0x00, 0x03, 0xc0, 0xfe, 0x00, 0x04, 0x07, 0x0e, 0x00, 0x03, 0x80, 0xfe, 0x00, 0x03, 0x03, 0x9c,
+    0x00, 0x03, 0xfd, 0x00, 0x03, 0x01, 0xdc, 0x00, 0x03, 0xfd, 0x00, 0x03, 0x01, 0xf8, 0x00, 0x03,
+    0xfc, 0x00, 0x03, 0xf8, 0x00, 0x03, 0x80, 0xfd, 0x00, 0x03, 0xf8, 0x00, 0x01, 0xc0, 0xfe, 0x00,
+    0x19, 0x01, 0xfc, 0x00, 0x01, 0xff, 0xff, 0x86, 0x1f, 0xff, 0x9c, 0x00, 0x00, 0x7f, 0xff, 0xc6,
+    0x1f, 0xff, 0x9c, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x0f, 0xff, 0xfc, 0xfb, 0x00, 0x01, 0x01, 0xf8,
+    0xfa, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x3f, 0xfc, 0xff, 0x02, 0x00, 0x00, 0x7f, 0xfc, 0xff, 0x01,
+    0xc0, 0x00, 0xfb, 0xff, 0x02, 0xc0, 0x00, 0xe0, 0xfc, 0x00, 0x02, 0xc0, 0x00, 0xe0, 0xfc, 0x00,
+    0x02, 0xe0, 0x00, 0xe0, 0xfc, 0x00, 0x02, 0xe0, 0x00, 0xe0, 0xfc, 0x00, 0x02, 0xe0, 0x00, 0xe0,
+    0xfc, 0x00, 0x02, 0xe0, 0x7c, 0xe0, 0xfc, 0x00, 0x02, 0xe0, 0xfe, 0xe0, 0xfc, 0x00, 0x12, 0xe1,
+    0xcf, 0xe0, 0x00, 0x01, 0xff, 0x87, 0xf0, 0xe1, 0x87, 0xe0, 0x00, 0x01, 0xff, 0x87, 0xf0, 0xe1,
+    0x87, 0xe0, 0xfc, 0x00, 0x04, 0xe3, 0x87, 0xe0, 0x03, 0x80, 0xfe, 0x00, 0x04, 0xe3, 0xff, 0xe0,
+    0x07, 0x80, 0xfe, 0x00, 0x03, 0xe3, 0xff, 0xe1, 0x8f, 0xfd, 0x00, 0x03, 0xe3, 0x87, 0xe1, 0xde,
+    0xfd, 0x00, 0x03, 0xe3, 0x87, 0xe1, 0xfc, 0xfd, 0x00, 0x12, 0xe3, 0x87, 0xe0, 0xf8, 0x01, 0xff,
+    0xff, 0xf0, 0xe3, 0x87, 0xe0, 0x70, 0x01, 0xff, 0xff, 0xf0, 0xe3, 0x87, 0xe0, 0xfc, 0x00, 0x02,
+    0xe3, 0x87, 0xe0, 0xfc, 0x00, 0x02, 0xe3, 0x87, 0xe0, 0xfc, 0x00, 0x02, 0xe3, 0x87, 0xe0, 0xfc,
+    0x00, 0x02, 0xe3, 0x87, 0xe0, 0xfc, 0x00, 0x02, 0xe3, 0x87, 0xe0, 0xfc, 0x00, 0x02, 0xe3, 0x87,
+    0xe0, 0xfc, 0x00, 0x13, 0xe3, 0x87, 0xe1, 0x81, 0x81, 0xff, 0x87, 0xf0, 0xe3, 0x87, 0xe1, 0xc3,
+    0x81, 0xff, 0x87, 0xf0, 0xe3, 0x87, 0xe0, 0xe7, 0xfd, 0x00, 0x03, 0xe1, 0x87, 0xe0, 0x7e, 0xfd,
+    0x00, 0x03, 0xe1, 0x87, 0xe0, 0x3c, 0xfd, 0x00, 0x03, 0xe0, 0x07, 0xe0, 0x3c, 0xfd, 0x00, 0x03,
+    0xe0, 0x07, 0xe0, 0x7e, 0xfd, 0x00, 0x03, 0xe0, 0x07, 0xe0, 0xe7, 0xfd, 0x00, 0x12, 0xe1, 0x87,
+    0xe1, 0xc3, 0x81, 0xff, 0xff, 0xf0, 0xe1, 0x87, 0xe1, 0x81, 0x81, 0xff, 0xff, 0xf0, 0xe1, 0x07,
+    0xe0, 0xfc, 0x00, 0x02, 0xe0, 0x07, 0xe0, 0xfc, 0x00, 0x02, 0xe0, 0x07, 0xe0, 0xfc, 0x00, 0x02,
+    0xe0, 0x07, 0xe0, 0xfc, 0x00, 0x02, 0xe1, 0x87, 0xe0, 0xfc, 0x00, 0x02, 0xe3, 0x87, 0xe0, 0xfc,
+    0x00, 0x02, 0xe3, 0x87, 0xe0, 0xfc, 0x00, 0x13, 0xe3, 0x87, 0xe1, 0x81, 0x81, 0xff, 0x87, 0xf0,
+    0xe3, 0x87, 0xe1, 0xc3, 0x81, 0xff, 0x87, 0xf0, 0xe3, 0x87, 0xe0, 0xe7, 0xfd, 0x00, 0x03, 0xe3,
+    0x87, 0xe0, 0x7e, 0xfd, 0x00, 0x03, 0xe3, 0x87, 0xe0, 0x3c, 0xfd, 0x00, 0x03, 0xe3, 0x87, 0xe0,
+    0x3c, 0xfd, 0x00, 0x03, 0xe3, 0x87, 0xe0, 0x7e, 0xfd, 0x00, 0x03, 0xe3, 0x87, 0xe0, 0xe7, 0xfd,
+    0x00, 0x12, 0xe3, 0x87, 0xe1, 0xc3, 0x81, 0xff, 0xff, 0xf0, 0xe3, 0x87, 0xe1, 0x81, 0x81, 0xff,
+    0xff, 0xf0, 0xe3, 0x87, 0xe0, 0xfc, 0x00, 0x02, 0xe3, 0xff, 0xe0, 0xfc, 0x00, 0x02, 0xe1, 0xff,
+    0xe0, 0xfc, 0x00, 0x02, 0xe1, 0xce, 0xe0, 0xfc, 0x00, 0x02, 0xe0, 0xce, 0xe0, 0xfc, 0x00, 0x02,
+    0xe0, 0xee, 0xe0, 0xfc, 0x00, 0x02, 0xe0, 0xfc, 0xe0, 0xfc, 0x00, 0x02, 0xc0, 0x7c, 0xf0, 0xfd,
+    0x00, 0x03, 0x01, 0xc0, 0x78, 0x7f, 0xfc, 0xff, 0x02, 0xc0, 0x38, 0x3f, 0xfc, 0xff, 0x01, 0x00,
+    0x30, 0xe9, 0x00, 0x00, 0x07, 0xfb, 0xff, 0x01, 0xe0, 0x0f, 0xfb, 0xff, 0x01, 0xf0, 0x1f, 0xfb,
+    0xff, 0x01, 0xf8, 0x1f, 0xfb, 0xff, 0x01, 0xf8, 0x1f, 0xfb, 0xff, 0x01, 0xf8, 0x1f, 0xfb, 0xff,
+    0x01, 0xf8, 0x1f, 0xfb, 0xff, 0x01, 0xf8, 0x1f, 0xfb, 0xff, 0x01, 0xf8, 0x1f, 0xfb, 0xff, 0x01,
+    0xf8, 0x1f, 0xfb, 0xff, 0x01, 0xf8, 0x1f, 0xfb, 0xff, 0x01, 0xf8, 0x1f, 0xfb, 0xff, 0x01, 0xf8,
+    0x1f, 0xfb, 0xff, 0x01, 0xf8, 0x1f, 0xfb, 0xff, 0x41, 0xf8, 0x1c, 0x00, 0x07, 0x00, 0x00, 0xe0,
+    0x00, 0x38, 0x1c, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x38, 0x1c, 0x00, 0x07, 0x00, 0x00, 0xe0,
+    0x00, 0x38, 0x1c, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x38, 0x1c, 0x00, 0x07, 0x00, 0x00, 0xe0,
+    0x00, 0x38, 0x1c, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x38, 0x1c, 0x00, 0x07, 0x00, 0x00, 0xe0,
+    0x00, 0x38, 0x1c, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x38, 0x1f, 0xfb, 0xff, 0x01, 0xf8, 0x1f,
+    0xfb, 0xff, 0x01, 0xf8, 0x1f, 0xfb, 0xff, 0x41, 0xf8, 0x1c, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00,
+    0x38, 0x1c, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x38, 0x1c, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00,
+    0x38, 0x1c, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x38, 0x1c, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00,
+    0x38, 0x1c, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x38, 0x1c, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00,
+    0x38, 0x1c, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x38, 0x1f, 0xfb, 0xff, 0x01, 0xf8, 0x1f, 0xfb,
+    0xff, 0x01, 0xf8, 0x1f, 0xfb, 0xff, 0x41, 0xf8, 0x1c, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x38,
+    0x1c, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x38, 0x1c, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x38,
+    0x1c, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x38, 0x1c, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x38,
+    0x1c, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x38, 0x1c, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x38,
+    0x1c, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x38, 0x1f, 0xfb, 0xff, 0x01, 0xf8, 0x1f, 0xfb, 0xff,
+    0x01, 0xf8, 0x1f, 0xfb, 0xff, 0x49, 0xf8, 0x1c, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x38, 0x1c,
+    0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x38, 0x1c, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x38, 0x1c,
+    0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x38, 0x1c, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x38, 0x1c,
+    0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x38, 0x1c, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x38, 0x1c,
+    0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x38, 0x1f, 0x80, 0x07, 0x80, 0x01, 0xff, 0xff, 0xf8, 0x0f,
+    0xfb, 0xff, 0x01, 0xf0, 0x07, 0xfb, 0xff, 0x00, 0xe0, 0xe9, 0x00, 0xfe, 0x00, 0x01, 0x3f, 0xfc,
+    0xfc, 0x00, 0x2f, 0x03, 0xff, 0xff, 0xc0, 0x00, 0xf8, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00,
+    0xfc, 0x00, 0x00, 0x7f, 0xc0, 0x03, 0xfe, 0x01, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x3f, 0x00,
+    0xfc, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x0f, 0xc1, 0xf8, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x03, 0xe3,
+    0xf0, 0x00, 0x1f, 0xfd, 0x00, 0x03, 0xff, 0x00, 0x00, 0x3e, 0xfd, 0x00, 0x7f, 0x7e, 0x00, 0x00,
+    0x7c, 0x00, 0x30, 0x00, 0x00, 0x3e, 0x00, 0x00, 0xf0, 0x00, 0xfc, 0x00, 0x00, 0x0f, 0x00, 0x01,
+    0xe0, 0x01, 0xfe, 0x00, 0x00, 0x07, 0x80, 0x01, 0xc0, 0x01, 0xff, 0x00, 0x00, 0x03, 0x80, 0x03,
+    0xc0, 0x03, 0x83, 0x87, 0xfc, 0x03, 0xc0, 0x07, 0x80, 0x03, 0x01, 0xff, 0xff, 0x01, 0xe0, 0x07,
+    0x00, 0x07, 0x00, 0xff, 0xbf, 0x80, 0xe0, 0x0e, 0x00, 0x06, 0x03, 0xf0, 0x03, 0xc0, 0x70, 0x1e,
+    0x00, 0x06, 0x07, 0xf0, 0x01, 0xe0, 0x78, 0x1c, 0x00, 0x06, 0x1f, 0x30, 0x00, 0xe0, 0x38, 0x1c,
+    0x00, 0x06, 0x3c, 0x18, 0x00, 0x70, 0x38, 0x38, 0x00, 0x06, 0x78, 0x18, 0x00, 0x70, 0x1c, 0x38,
+    0x00, 0x06, 0xe0, 0x0c, 0x00, 0x70, 0x1c, 0x70, 0x00, 0x07, 0xc0, 0x0c, 0x00, 0x70, 0x0e, 0x70,
+    0x00, 0x07, 0x80, 0x06, 0x00, 0x30, 0x0e, 0x70, 0x00, 0x07, 0x00, 0x06, 0x00, 0x7f, 0x30, 0x0e,
+    0x70, 0x00, 0x0e, 0x00, 0x06, 0x00, 0x70, 0x0e, 0xe0, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x70, 0x07,
+    0xe0, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x70, 0x07, 0xe0, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x60, 0x07,
+    0xe0, 0x00, 0x3e, 0x00, 0x01, 0x00, 0xe0, 0x07, 0xe0, 0x00, 0x76, 0x07, 0xe1, 0x80, 0xe0, 0x07,
+    0xe0, 0x00, 0x66, 0x06, 0x61, 0x80, 0xc0, 0x07, 0xe0, 0x00, 0xe2, 0x0c, 0x31, 0x81, 0xc0, 0x07,
+    0xe0, 0x00, 0xc3, 0x0d, 0xb1, 0x83, 0x80, 0x07, 0xe0, 0x01, 0xc3, 0x0d, 0xb0, 0x83, 0x80, 0x07,
+    0xe0, 0x01, 0xc3, 0x0e, 0x70, 0xc7, 0x00, 0x07, 0xe0, 0x01, 0x81, 0x07, 0xe0, 0xce, 0x00, 0x07,
+    0xe0, 0x01, 0x81, 0x81, 0x80, 0xce, 0x00, 0x06, 0x70, 0x03, 0x81, 0x80, 0x00, 0xdc, 0x00, 0x0e,
+    0x70, 0x03, 0x81, 0x80, 0x00, 0xf8, 0x00, 0x0e, 0x70, 0x03, 0x80, 0xc0, 0x00, 0xf0, 0x7b, 0x00,
+    0x0e, 0x70, 0x03, 0x80, 0xc0, 0x00, 0xe0, 0x00, 0x0e, 0x38, 0x01, 0x80, 0x40, 0x01, 0xc0, 0x00,
+    0x1c, 0x38, 0x01, 0xc0, 0x60, 0x07, 0xc0, 0x00, 0x1c, 0x1c, 0x01, 0xc0, 0x60, 0x0f, 0xc0, 0x00,
+    0x38, 0x1c, 0x01, 0xe0, 0x30, 0x3e, 0xc0, 0x00, 0x38, 0x1e, 0x00, 0xf0, 0x30, 0xf8, 0xc0, 0x00,
+    0x70, 0x0e, 0x00, 0x7c, 0x1f, 0xf1, 0xc0, 0x00, 0x70, 0x07, 0x00, 0x3f, 0xff, 0xc1, 0x80, 0x00,
+    0xe0, 0x07, 0x80, 0x1f, 0xff, 0x01, 0x80, 0x01, 0xe0, 0x03, 0xc0, 0x03, 0xe7, 0x03, 0x80, 0x03,
+    0xc0, 0x01, 0xc0, 0x00, 0x03, 0x87, 0x00, 0x03, 0x80, 0x01, 0xe0, 0x00, 0x03, 0xff, 0x00, 0x07,
+    0x80, 0x00, 0xf0, 0x00, 0x01, 0xfe, 0x00, 0x0f, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x7c, 0x00, 0x3e,
+    0x00, 0x00, 0x7e, 0x00, 0x00, 0x18, 0x00, 0x7c, 0x00, 0x00, 0xff, 0xfd, 0x00, 0x36, 0xf8, 0x00,
+    0x0f, 0xc7, 0xc0, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x1f, 0x83, 0xf0, 0x00, 0x00, 0x0f, 0xc0, 0x00,
+    0x3f, 0x00, 0xfc, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x3f, 0x00, 0x3f, 0xc0, 0x03, 0xfc, 0x00, 0x00,
+    0x3f, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x1f, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x3f, 0xf8, 0xfe, 0x00, 0xfe, 0x00, 0x01, 0x1f, 0xf8, 0xfb, 0x00, 0x01, 0x3f,
+    0xfc, 0xfb, 0x00, 0x01, 0x7f, 0xfe, 0xfb, 0x00, 0x01, 0x7f, 0xfe, 0xfb, 0x00, 0x01, 0x7f, 0xfe,
+    0xfb, 0x00, 0x01, 0x7f, 0xfe, 0xfd, 0x00, 0x1f, 0x07, 0x00, 0x7f, 0xfe, 0x00, 0xe0, 0x00, 0x00,
+    0x1f, 0x80, 0x7f, 0xfe, 0x01, 0xf8, 0x00, 0x00, 0x3f, 0xe0, 0xff, 0xff, 0x07, 0xfc, 0x00, 0x00,
+    0x7f, 0xf3, 0xff, 0xff, 0xcf, 0xfe, 0x00, 0x00, 0xfb, 0xff, 0x01, 0x00, 0x01, 0xfb, 0xff, 0x01,
+    0x80, 0x01, 0xfb, 0xff, 0x01, 0x80, 0x03, 0xfb, 0xff, 0x01, 0xc0, 0x03, 0xfb, 0xff, 0x01, 0xc0,
+    0x03, 0xfb, 0xff, 0x01, 0xc0, 0x01, 0xfb, 0xff, 0x01, 0x80, 0x00, 0xfb, 0xff, 0x01, 0x00, 0x00,
+    0xfb, 0xff, 0x46, 0x00, 0x00, 0x7f, 0xff, 0xf0, 0x0f, 0xff, 0xfe, 0x00, 0x00, 0x3f, 0xff, 0x80,
+    0x01, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0x7f, 0xfe, 0x00,
+    0x00, 0x7f, 0xfe, 0x00, 0x00, 0x7f, 0xfc, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0xff, 0xf8, 0x00,
+    0x00, 0x1f, 0xff, 0x00, 0x3f, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xfc, 0x7f, 0xff, 0xf0, 0x00,
+    0x00, 0x0f, 0xff, 0xfe, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xfd, 0xff, 0x03, 0xe0, 0x00, 0x00,
+    0x07, 0xfd, 0xff, 0x03, 0xe0, 0x00, 0x00, 0x07, 0xfd, 0xff, 0x03, 0xe0, 0x00, 0x00, 0x07, 0xfd,
+    0xff, 0x03, 0xe0, 0x00, 0x00, 0x07, 0xfd, 0xff, 0x03, 0xe0, 0x00, 0x00, 0x07, 0xfd, 0xff, 0x03,
+    0xe0, 0x00, 0x00, 0x07, 0xfd, 0xff, 0x03, 0xe0, 0x00, 0x00, 0x07, 0xfd, 0xff, 0x03, 0xe0, 0x00,
+    0x00, 0x07, 0xfd, 0xff, 0x46, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x7f, 0xff, 0xf0, 0x00, 0x00,
+    0x0f, 0xff, 0xfe, 0x3f, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xfc, 0x00, 0xff, 0xf8, 0x00, 0x00,
+    0x1f, 0xff, 0x00, 0x00, 0x7f, 0xfc, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x7f, 0xfe, 0x00, 0x00,
+    0x7f, 0xfe, 0x00, 0x00, 0x3f, 0xff, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0x80, 0x01,
+    0xff, 0xfc, 0x00, 0x00, 0x7f, 0xff, 0xf0, 0x0f, 0xff, 0xfe, 0x00, 0x00, 0xfb, 0xff, 0x01, 0x00,
+    0x00, 0xfb, 0xff, 0x01, 0x00, 0x01, 0xfb, 0xff, 0x01, 0x80, 0x03, 0xfb, 0xff, 0x01, 0xc0, 0x03,
+    0xfb, 0xff, 0x01, 0xc0, 0x03, 0xfb, 0xff, 0x01, 0xc0, 0x01, 0xfb, 0xff, 0x01, 0x80, 0x01, 0xfb,
+    0xff, 0x01, 0x80, 0x00, 0xfb, 0xff, 0x1f, 0x00, 0x00, 0x7f, 0xf3, 0xff, 0xff, 0xcf, 0xfe, 0x00,
+    0x00, 0x3f, 0xe0, 0xff, 0xff, 0x07, 0xfc, 0x00, 0x00, 0x1f, 0x80, 0x7f, 0xfe, 0x01, 0xf8, 0x00,
+    0x00, 0x07, 0x00, 0x7f, 0xfe, 0x00, 0xe0, 0xfd, 0x00, 0x01, 0x7f, 0xfe, 0xfb, 0x00, 0x01, 0x7f,
+    0xfe, 0xfb, 0x00, 0x01, 0x7f, 0xfe, 0xfb, 0x00, 0x01, 0x7f, 0xfe, 0xfb, 0x00, 0x01, 0x3f, 0xfc,
+    0xfb, 0x00, 0x01, 0x1f, 0xf8, 0xfe, 0x00, 0xfb, 0x00, 0x01, 0xf8, 0xfc, 0xf5, 0x00, 0x03, 0x3f,
+    0xe3, 0xff, 0xf8, 0xf7, 0x00, 0x05, 0x03, 0xff, 0xc7, 0xff, 0xff, 0x80, 0xf8, 0x00, 0x05, 0x1f,
+    0xff, 0x1f, 0xff, 0xff, 0xe0, 0xf8, 0x00, 0x05, 0x7f, 0xfc, 0x3f, 0xff, 0xff, 0xcc, 0xf9, 0x00,
+    0x02, 0x03, 0xff, 0xf8, 0xfe, 0xff, 0x01, 0xcf, 0x80, 0xfa, 0x00, 0x02, 0x0f, 0xff, 0xe3, 0xfe,
+    0xff, 0x01, 0x9f, 0xe0, 0xfa, 0x00, 0x02, 0x3f, 0xff, 0xc7, 0xfe, 0xff, 0x01, 0x9f, 0xf8, 0xfa,
+    0x00, 0x02, 0xff, 0xff, 0x8f, 0xfe, 0xff, 0x01, 0x3f, 0xfe, 0xfb, 0x00, 0x03, 0x01, 0xff, 0xff,
+    0x3f, 0xfe, 0xff, 0x01, 0x3f, 0xff, 0xfb, 0x00, 0x09, 0x07, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xfe,
+    0x3f, 0xff, 0xc0, 0xfc, 0x00, 0x02, 0x0f, 0xff, 0xf8, 0xfe, 0xff, 0x03, 0xfe, 0x7f, 0xff, 0xe0,
+    0xfc, 0x00, 0x02, 0x3f, 0xff, 0xf1, 0xfe, 0xff, 0x03, 0xfc, 0x7f, 0xff, 0xf8, 0xfc, 0x00, 0x02,
+    0x7f, 0xff, 0xe3, 0xfe, 0xff, 0x03, 0xfc, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x02, 0xff, 0xff, 0xc7,
+    0xfe, 0xff, 0x03, 0xf8, 0xff, 0xff, 0xfe, 0xfd, 0x00, 0x03, 0x01, 0xff, 0xff, 0x8f, 0xfe, 0xff,
+    0x03, 0xf9, 0xff, 0xff, 0xfe, 0xfd, 0x00, 0x03, 0x03, 0xff, 0xff, 0x1f, 0xfe, 0xff, 0x00, 0xf1,
+    0xfe, 0xff, 0xfd, 0x00, 0x03, 0x07, 0xff, 0xfe, 0x3f, 0xfe, 0xff, 0x00, 0xf3, 0xfe, 0xff, 0xfd,
+    0x00, 0x03, 0x0f, 0xff, 0xfc, 0x7f, 0xfe, 0xff, 0x00, 0xe3, 0xfe, 0xff, 0x00, 0x30, 0xfe, 0x00,
+    0x02, 0x1f, 0xff, 0xf8, 0xfd, 0xff, 0x00, 0xe7, 0xfe, 0xff, 0x00, 0x98, 0xfe, 0x00, 0x02, 0x3f,
+    0xff, 0xf9, 0xfd, 0xff, 0x00, 0xcf, 0xfe, 0xff, 0x00, 0x9c, 0xfe, 0x00, 0x02, 0x7f, 0xff, 0xf3,
+    0xfd, 0xff, 0x00, 0xcf, 0xfe, 0xff, 0x00, 0x9c, 0xfe, 0x00, 0x02, 0xff, 0xff, 0xe3, 0xfd, 0xff,
+    0x00, 0x8f, 0xfe, 0xff, 0x06, 0x9e, 0x00, 0x00, 0x01, 0xff, 0xff, 0xe7, 0xfd, 0xff, 0x00, 0x9f,
+    0xfe, 0xff, 0x06, 0x9f, 0x00, 0x00, 0x03, 0xff, 0xff, 0xcf, 0xfd, 0xff, 0x00, 0x1f, 0xfe, 0xff,
+    0x06, 0xcf, 0x80, 0x00, 0x03, 0xff, 0xff, 0x8f, 0xfd, 0xff, 0x00, 0x3f, 0xfe, 0xff, 0x0b, 0xcf,
+    0xc0, 0x00, 0x07, 0xff, 0xff, 0x1f, 0xff, 0xc1, 0xff, 0xfe, 0x3f, 0xfe, 0xff, 0x0b, 0xcf, 0xc0,
+    0x00, 0x0f, 0xff, 0xff, 0x3e, 0x00, 0x00, 0x01, 0xfe, 0x7f, 0xfe, 0xff, 0x0b, 0xcf, 0xe0, 0x00,
+    0x0f, 0xff, 0xfe, 0x20, 0x00, 0xb8, 0x00, 0x0c, 0x7f, 0xfe, 0xff, 0x0a, 0xcf, 0xf0, 0x00, 0x1f,
+    0xff, 0xfe, 0x01, 0xff, 0xff, 0xfc, 0x00, 0xfd, 0xff, 0x06, 0xc7, 0xf0, 0x00, 0x1f, 0xff, 0xfc,
+    0x1f, 0xfe, 0xff, 0x01, 0xe0, 0x1f, 0xfe, 0xff, 0x05, 0xc7, 0xf8, 0x00, 0x3f, 0xff, 0xf0, 0xfd,
+    0xff, 0x01, 0xfc, 0x07, 0xfe, 0xff, 0x05, 0xc7, 0xfc, 0x00, 0x3f, 0xff, 0xc3, 0xfc, 0xff, 0x00,
+    0x80, 0xfe, 0xff, 0x05, 0xe7, 0xfc, 0x00, 0x3f, 0xff, 0x8f, 0xfc, 0xff, 0x09, 0xf0, 0x3f, 0xff,
+    0xff, 0xe7, 0xfe, 0x00, 0x7f, 0xfe, 0x1f, 0xfc, 0xff, 0x09, 0xfc, 0x1f, 0xff, 0xff, 0xe7, 0xfe,
+    0x00, 0x7f, 0xfc, 0x7f, 0xfb, 0xff, 0x07, 0x07, 0xff, 0xff, 0xe7, 0xff, 0x00, 0x7f, 0xf0, 0xfa,
+    0xff, 0x07, 0xc1, 0xff, 0xff, 0xe7, 0xff, 0x00, 0x7f, 0xe3, 0xfa, 0xff, 0x07, 0xf0, 0xff, 0xff,
+    0xe7, 0xff, 0x80, 0x7f, 0xc7, 0xfa, 0xff, 0x07, 0xf8, 0x3f, 0xff, 0xe7, 0xff, 0x80, 0x7f, 0x8f,
+    0xfa, 0xff, 0x07, 0xfe, 0x0f, 0xff, 0xe7, 0xff, 0xc0, 0xff, 0x1f, 0xf9, 0xff, 0x06, 0x07, 0xff,
+    0xe7, 0xff, 0xc0, 0xfe, 0x3f, 0xf9, 0xff, 0x06, 0xc3, 0xff, 0xe7, 0xff, 0xe0, 0xfc, 0x7f, 0xf9,
+    0xff, 0x05, 0xe1, 0xff, 0xe7, 0xff, 0xe0, 0xfc, 0xf8, 0xff, 0x05, 0xf0, 0xff, 0xe7, 0xff, 0xe0,
+    0xf8, 0xf8, 0xff, 0x05, 0xf8, 0x7f, 0xc7, 0xff, 0xf0, 0xf1, 0xf8, 0xff, 0x05, 0xfe, 0x3f, 0xcf,
+    0xff, 0xf0, 0xe3, 0xf7, 0xff, 0x04, 0x1f, 0xcf, 0xff, 0xf0, 0xe7, 0xf7, 0xff, 0x04, 0x8f, 0xcf,
+    0xff, 0xf8, 0xc7, 0xf7, 0xff, 0x04, 0xc7, 0xcf, 0xff, 0xf8, 0xcf, 0xf7, 0xff, 0x04, 0xe3, 0xcf,
+    0xff, 0xf8, 0xdf, 0xf7, 0xff, 0x03, 0xe1, 0xcf, 0xff, 0xfc, 0xf6, 0xff, 0x03, 0xf0, 0x8f, 0xff,
+    0xfc, 0xf6, 0xff, 0x03, 0xf8, 0x1f, 0xff, 0xfc, 0xf6, 0xff, 0x04, 0xfc, 0x1f, 0xff, 0xfc, 0x7f,
+    0xf7, 0xff, 0x04, 0xfc, 0x3f, 0xff, 0xfe, 0x7f, 0xf7, 0xff, 0x04, 0xfe, 0x1f, 0xff, 0xfe, 0x7f,
+    0xf6, 0xff, 0x03, 0x1f, 0xff, 0xfe, 0x7f, 0xf6, 0xff, 0x03, 0x8f, 0xff, 0xfe, 0x7f, 0xf6, 0xff,
+    0x03, 0x87, 0xff, 0xfe, 0x7f, 0xf6, 0xff, 0x03, 0xc7, 0xff, 0xfe, 0x7f, 0xf6, 0xff, 0x03, 0xc3,
+    0xff, 0xfe, 0x7f, 0xf6, 0xff, 0x03, 0xe3, 0xff, 0xff, 0x7f, 0xf6, 0xff, 0x03, 0xf1, 0xff, 0xff,
+    0x6f, 0xf6, 0xff, 0x03, 0xf1, 0xff, 0xff, 0x67, 0xf6, 0xff, 0x03, 0xf8, 0xff, 0xff, 0x67, 0xf6,
+    0xff, 0x03, 0xf8, 0xff, 0xff, 0x63, 0xf6, 0xff, 0x03, 0xfc, 0x7f, 0xff, 0x61, 0xf6, 0xff, 0x03,
+    0xfc, 0x7f, 0xff, 0x60, 0xf6, 0xff, 0x04, 0xfe, 0x3f, 0xff, 0x60, 0x7f, 0xf7, 0xff, 0x04, 0xfe,
+    0x3f, 0xfe, 0x60, 0x7f, 0xf6, 0xff, 0x03, 0x3f, 0xfe, 0x60, 0x3f, 0xf6, 0xff, 0x03, 0x1f, 0xfe,
+    0x60, 0x1f, 0xf6, 0xff, 0x03, 0x1f, 0xfe, 0x60, 0x0f, 0xf6, 0xff, 0x03, 0x9f, 0xfe, 0x60, 0x07,
+    0xf6, 0xff, 0x03, 0x9f, 0xfc, 0x60, 0x03, 0xf6, 0xff, 0x03, 0x8f, 0xfc, 0x70, 0x01, 0xf6, 0xff,
+    0x03, 0xcf, 0xfc, 0x70, 0x00, 0xf6, 0xff, 0x04, 0xcf, 0xfc, 0x70, 0x00, 0x7f, 0xf7, 0xff, 0x04,
+    0xcf, 0xf8, 0x70, 0x00, 0x3f, 0xf7, 0xff, 0x04, 0xcf, 0xf8, 0x70, 0x00, 0x3f, 0xf7, 0xff, 0x04,
+    0xcf, 0xf0, 0x70, 0x00, 0x37, 0xf7, 0xff, 0x04, 0xcf, 0xf0, 0x70, 0x00, 0x33, 0xf7, 0xff, 0x04,
+    0xef, 0xe0, 0x70, 0x00, 0x30, 0xf7, 0xff, 0x05, 0xef, 0xc0, 0x70, 0x00, 0x70, 0x7f, 0xf8, 0xff,
+    0x05, 0xef, 0xc0, 0x70, 0x00, 0x70, 0x3f, 0xf8, 0xff, 0x05, 0xe7, 0x80, 0x70, 0x00, 0x70, 0x0f,
+    0xf8, 0xff, 0x05, 0xcf, 0x00, 0x70, 0x00, 0x70, 0x03, 0xf8, 0xff, 0x05, 0xce, 0x00, 0x30, 0x00,
+    0x70, 0x01, 0xf8, 0xff, 0x06, 0xfc, 0x00, 0x30, 0x00, 0x70, 0x00, 0x7f, 0xf9, 0xff, 0x06, 0xf8,
+    0x00, 0x30, 0x00, 0x70, 0x00, 0x1f, 0xf9, 0xff, 0x06, 0xf8, 0x00, 0x30, 0x00, 0x60, 0x00, 0x0f,
+    0xf9, 0xff, 0x06, 0xf0, 0x00, 0x30, 0x00, 0x60, 0x00, 0x01, 0xf9, 0xff, 0x07, 0xe0, 0x00, 0x30,
+    0x00, 0x60, 0x00, 0x00, 0x7f, 0xfa, 0xff, 0x07, 0xc0, 0x00, 0x30, 0x00, 0xe0, 0x00, 0x00, 0x1f,
+    0xfa, 0xff, 0x07, 0x80, 0x00, 0x30, 0x00, 0xe0, 0x00, 0x00, 0x07, 0xfa, 0xff, 0x04, 0x00, 0x00,
+    0x30, 0x00, 0xe0, 0xfe, 0x00, 0xfb, 0xff, 0x05, 0xfe, 0x00, 0x00, 0x30, 0x00, 0xe0, 0xfe, 0x00,
+    0x00, 0x1f, 0xfc, 0xff, 0x05, 0xfc, 0x00, 0x00, 0x30, 0x00, 0xe0, 0xfe, 0x00, 0x00, 0x03, 0xfc,
+    0xff, 0x05, 0xf8, 0x00, 0x00, 0x30, 0x00, 0xe0, 0xfd, 0x00, 0x00, 0x7f, 0xfd, 0xff, 0x05, 0xf0,
+    0x00, 0x00, 0x30, 0x00, 0xe0, 0xfd, 0x00, 0x00, 0x03, 0xfd, 0xff, 0x05, 0xe0, 0x00, 0x00, 0x30,
+    0x00, 0xe0, 0xfc, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0x05, 0xc0, 0x00, 0x00, 0x30, 0x00, 0xc0, 0xfb,
+    0x00, 0x08, 0xff, 0xff, 0x03, 0x80, 0x00, 0x00, 0x30, 0x00, 0xc0, 0xfb, 0x00, 0x02, 0xe0, 0x00,
+    0x0f, 0xfe, 0x00, 0x02, 0x30, 0x00, 0xc0, 0xfc, 0x00, 0x03, 0x01, 0xc0, 0x00, 0x0f, 0xfe, 0x00,
+    0x02, 0x38, 0x01, 0xc0, 0xfc, 0x00, 0x03, 0x03, 0xc0, 0x00, 0x1e, 0xfe, 0x00, 0x02, 0x38, 0x01,
+    0xc0, 0xfc, 0x00, 0x03, 0x07, 0x80, 0x00, 0x3c, 0xfe, 0x00, 0x02, 0x38, 0x01, 0xc0, 0xfc, 0x00,
+    0x03, 0x07, 0x00, 0x00, 0x78, 0xfe, 0x00, 0x02, 0x38, 0x01, 0xc0, 0xfc, 0x00, 0x03, 0x0e, 0x00,
+    0x00, 0xf0, 0xfe, 0x00, 0x02, 0x38, 0x01, 0xc0, 0xfc, 0x00, 0x03, 0x1e, 0x00, 0x01, 0xe0, 0xfe,
+    0x00, 0x02, 0x38, 0x01, 0xc0, 0xfc, 0x00, 0x03, 0x3c, 0x00, 0x03, 0xc0, 0xfe, 0x00, 0x02, 0x38,
+    0x01, 0xc0, 0xfc, 0x00, 0x03, 0x38, 0x00, 0x07, 0x80, 0xfe, 0x00, 0x02, 0x38, 0x01, 0x80, 0xfc,
+    0x00, 0x02, 0x70, 0x00, 0x0f, 0xfd, 0x00, 0x02, 0x38, 0x03, 0x80, 0xfc, 0x00, 0x02, 0xf0, 0x00,
+    0x1e, 0xfd, 0x00, 0x02, 0x38, 0x03, 0x80, 0xfc, 0x00, 0x02, 0xe0, 0x00, 0x3c, 0xfd, 0x00, 0x02,
+    0x18, 0x03, 0x80, 0xfd, 0x00, 0x03, 0x01, 0xc0, 0x00, 0x78, 0xfd, 0x00, 0x02, 0x18, 0x03, 0x80,
+    0xfd, 0x00, 0x03, 0x03, 0xc0, 0x00, 0xf0, 0xfd, 0x00, 0x02, 0x18, 0x03, 0x80, 0xfd, 0x00, 0x03,
+    0x07, 0x80, 0x00, 0xe0, 0xfd, 0x00, 0x02, 0x18, 0x03, 0x80, 0xfd, 0x00, 0x03, 0x07, 0x00, 0x01,
+    0xc0, 0xfd, 0x00, 0x02, 0x18, 0x03, 0x80, 0xfd, 0x00, 0x03, 0x0e, 0x00, 0x03, 0x80, 0xfd, 0x00,
+    0x02, 0x18, 0x03, 0x80, 0xfd, 0x00, 0x02, 0x1e, 0x00, 0x07, 0xfc, 0x00, 0x02, 0x18, 0x03, 0x80,
+    0xfd, 0x00, 0x02, 0x1c, 0x00, 0x0e, 0xfc, 0x00, 0x09, 0x18, 0x03, 0x00, 0x00, 0x18, 0x00, 0x00,
+    0x38, 0x00, 0x1e, 0xfc, 0x00, 0x09, 0x18, 0x03, 0x00, 0x00, 0x38, 0x00, 0x00, 0x78, 0x00, 0x3c,
+    0xfc, 0x00, 0x09, 0x18, 0x07, 0x00, 0x00, 0x78, 0x00, 0x00, 0xf0, 0x00, 0x78, 0xfc, 0x00, 0x09,
+    0x18, 0x07, 0x00, 0x00, 0x78, 0x00, 0x00, 0xe0, 0x00, 0xf0, 0xfc, 0x00, 0x09, 0x18, 0x07, 0x00,
+    0x00, 0xf8, 0x00, 0x01, 0xc0, 0x01, 0xe0, 0xfc, 0x00, 0x09, 0x18, 0x07, 0x00, 0x00, 0xf0, 0x00,
+    0x03, 0xc0, 0x03, 0xc0, 0xfc, 0x00, 0x09, 0x18, 0x07, 0x00, 0x01, 0xf0, 0x00, 0x07, 0x80, 0x07,
+    0x80, 0xfc, 0x00, 0x08, 0x18, 0x07, 0x00, 0x01, 0xe0, 0x00, 0x07, 0x00, 0x0f, 0xfb, 0x00, 0x08,
+    0x18, 0x07, 0x00, 0x01, 0xe0, 0x00, 0x0e, 0x00, 0x1e, 0xfb, 0x00, 0x08, 0x18, 0x07, 0x01, 0xc3,
+    0xe0, 0x00, 0x1e, 0x00, 0x3c, 0xfb, 0x00, 0x08, 0x18, 0x07, 0x01, 0xc3, 0xc0, 0x00, 0x1c, 0x00,
+    0x38, 0xfb, 0x00, 0x08, 0x18, 0x06, 0x03, 0xc3, 0xc0, 0x00, 0x38, 0x00, 0x70, 0xfb, 0x00, 0x08,
+    0x1c, 0x06, 0x03, 0xc7, 0xc0, 0x00, 0x78, 0x00, 0xe0, 0xfb, 0x00, 0x08, 0x1c, 0x0e, 0x07, 0xc7,
+    0x8e, 0x00, 0x70, 0x01, 0xc0, 0xfb, 0x00, 0x08, 0x1c, 0x0e, 0x07, 0x8f, 0x8e, 0x00, 0xe0, 0x03,
+    0x80, 0xfb, 0x00, 0x07, 0x0c, 0x0e, 0x0f, 0x8f, 0x1e, 0x01, 0xc0, 0x07, 0xfa, 0x00, 0x07, 0x0c,
+    0x0e, 0x0f, 0x8f, 0x1e, 0x03, 0xc0, 0x0f, 0xfa, 0x00, 0x07, 0x0c, 0x0e, 0x1f, 0x1e, 0x3c, 0x03,
+    0x80, 0x1e, 0xfa, 0x00, 0x07, 0x0c, 0x0e, 0x1f, 0x1e, 0x3c, 0x07, 0x00, 0x3c, 0xfa, 0x00, 0x07,
+    0x0c, 0x0c, 0x3e, 0x3e, 0x3c, 0x0e, 0x00, 0x78, 0xfa, 0x00, 0x07, 0x0c, 0x0c, 0x3e, 0x3c, 0x7c,
+    0x1e, 0x00, 0xf0, 0xfa, 0x00, 0x07, 0x0c, 0x0c, 0x7e, 0x7c, 0xf8, 0x1c, 0x01, 0xe0, 0xfa, 0x00,
+    0x07, 0x0c, 0x1c, 0x7c, 0x78, 0xf8, 0x38, 0x01, 0xc0, 0xfa, 0x00, 0x07, 0x0c, 0x1c, 0xfc, 0x78,
+    0xf0, 0x70, 0x03, 0x80, 0xfa, 0x00, 0x06, 0x0c, 0x1c, 0xfc, 0xf9, 0xf0, 0x70, 0x07, 0xf9, 0x00,
+    0x06, 0x0c, 0x1c, 0xf8, 0xf3, 0xe0, 0xe0, 0x0e, 0xf9, 0x00, 0x06, 0x0c, 0x1d, 0xf9, 0xf3, 0xe1,
+    0xc0, 0x1c, 0xf9, 0x00, 0x06, 0x0c, 0x1d, 0xf1, 0xe7, 0xe3, 0xc0, 0x38, 0xf9, 0x00, 0x06, 0x0c,
+    0x1f, 0xf3, 0xe7, 0xc3, 0x80, 0x70, 0xf9, 0x00, 0x06, 0x0c, 0x1f, 0xf3, 0xcf, 0xc7, 0x00, 0xe0,
+    0xf9, 0x00, 0x06, 0x0c, 0x1f, 0xf3, 0xcf, 0x8e, 0x01, 0xc0, 0xf9, 0x00, 0x06, 0x0c, 0x1f, 0xf7,
+    0xdf, 0x9e, 0x03, 0xc0, 0xf9, 0x00, 0x06, 0x0c, 0x1f, 0xf7, 0x9f, 0x9c, 0x07, 0x80, 0xf9, 0x00,
+    0x05, 0x0c, 0x3f, 0xff, 0xbf, 0x38, 0x0f, 0xf8, 0x00, 0x05, 0x0c, 0x3f, 0xff, 0xff, 0x78, 0x1e,
+    0xf8, 0x00, 0x05, 0x0c, 0x3f, 0xff, 0xfe, 0x70, 0x1c, 0xf8, 0x00, 0x05, 0x0c, 0x7f, 0xff, 0xfc,
+    0xe0, 0x38, 0xf8, 0x00, 0x05, 0x0c, 0x7f, 0xff, 0xfd, 0xc0, 0x70, 0xf8, 0x00, 0x05, 0x0c, 0xff,
+    0xff, 0xfb, 0xc0, 0xe0, 0xf8, 0x00, 0x05, 0x0c, 0xff, 0xff, 0xfb, 0x81, 0xc0, 0xf8, 0x00, 0x00,
+    0x0d, 0xfe, 0xff, 0x01, 0x03, 0x80, 0xf8, 0x00, 0x04, 0x0f, 0xe7, 0xff, 0xfe, 0x07, 0xf7, 0x00,
+    0x04, 0x0f, 0xe7, 0xff, 0xfe, 0x0e, 0xf7, 0x00, 0x04, 0x07, 0xc7, 0xff, 0xfc, 0x1c, 0xf7, 0x00,
+    0x04, 0x07, 0xc1, 0xff, 0xfc, 0x38, 0xf7, 0x00, 0x04, 0x07, 0xc0, 0x7f, 0xf8, 0x70, 0xf7, 0x00,
+    0x04, 0x07, 0xc0, 0x3f, 0xf0, 0xe0, 0xf7, 0x00, 0x04, 0x07, 0xc0, 0x01, 0xe1, 0xc0, 0xf7, 0x00,
+    0x04, 0x07, 0xc0, 0x01, 0xe3, 0x80, 0xf7, 0x00, 0x03, 0x07, 0xc0, 0x03, 0xc7, 0xf6, 0x00, 0x03,
+    0x07, 0xc0, 0x07, 0x87, 0xf6, 0x00, 0x03, 0x07, 0xe0, 0x0f, 0x8e, 0xf6, 0x00, 0x03, 0x07, 0xe0,
+    0x1f, 0x9c, 0xf6, 0x00, 0x03, 0x07, 0xf8, 0x7f, 0x38, 0xf6, 0x00, 0x03, 0x07, 0xff, 0xff, 0x70,
+    0xf6, 0x00, 0x03, 0x07, 0xff, 0xfe, 0xe0, 0xf6, 0x00, 0x03, 0x07, 0xff, 0xff, 0xc0, 0xf6, 0x00,
+    0x03, 0x07, 0xff, 0xff, 0x80, 0xf6, 0x00, 0x02, 0x07, 0xf7, 0xff, 0xf5, 0x00, 0x02, 0x07, 0xe7,
+    0xfe, 0xf5, 0x00, 0x02, 0x07, 0xef, 0xfc, 0xf5, 0x00, 0x02, 0x07, 0xef, 0xf8, 0xf5, 0x00, 0x02,
+    0x07, 0xef, 0xf0, 0xf5, 0x00, 0x02, 0x07, 0xcf, 0xf0, 0xf5, 0x00, 0x02, 0x07, 0xdf, 0xe0, 0xf5,
+    0x00, 0x02, 0x07, 0xdf, 0xc0, 0xf5, 0x00, 0x02, 0x07, 0xdf, 0x80, 0xf5, 0x00, 0x01, 0x07, 0xbf,
+    0xf4, 0x00, 0x01, 0x07, 0xbe, 0xf4, 0x00, 0x01, 0x07, 0x3c, 0xf4, 0x00, 0x01, 0x07, 0x78, 0xf4,
+    0x00, 0x01, 0x03, 0x70, 0xf4, 0x00, 0x01, 0x02, 0xe0, 0xf4, 0x00, 0x01, 0x02, 0xc0, 0xf4, 0x00,
+    0x01, 0x03, 0x80, 0xf4, 0x00, 0x00, 0x01, 0xf3, 0x00, 0x00, 0x02, 0xe4, 0x00,
+};
+
+const packed_icon_t iconTable[ICON_COUNT] = {
+    {0, 32, 32},                    // ICON_ROCKET_RECOVERY
+    {123, 32, 32},                  // ICON_HOUSE_RECOVERY
+    {242, 16, 16},                  // ICON_SHIFT_KEYBOARD
+    {275, 24, 24},                  // ICON_BACKSPACE_KEYBOARD
+    {322, 16, 16},                  // ICON_ENTER_KEYBOARD
+    {353, 24, 24},                  // ICON_LIVE_LON
+    {402, 24, 24},                  // ICON_LIVE_LAT
+    {451, 24, 24},                  // ICON_LIVE_SPEED
+    {497, 24, 24},                  // ICON_LIVE_ALTITUDE
+    {545, 24, 24},                  // ICON_LIVE_BATTERY
+    {606, 24, 24},                  // ICON_LIVE_TWO
+    {662, 24, 24},                  // ICON_LIVE_ONE
+    {718, 16, 16},                  // ICON_LIVE_CHECKMARK
+    {743, 16, 16},                  // ICON_LIVE_CROSS
+    {770, 16, 16},                  // ICON_BAR_MEMORY
+    {803, 16, 16},                  // ICON_BAR_DOWNLOAD
+    {832, 16, 16},                  // ICON_BAR_LOCATION
+    {865, 16, 16},                  // ICON_BAR_FLASH
+    {897, 64, 64},                  // ICON_MENU_LIVE
+    {1371, 64, 64},                 // ICON_MENU_RECOVER
+    {1845, 64, 64},                 // ICON_MENU_TESTING
+    {2273, 64, 64},                 // ICON_MENU_DATA
+    {2667, 64, 64},                 // ICON_MENU_SENSORS
+    {3175, 64, 64},                 // ICON_MENU_SETTINGS
+    {3591, 120, 200},               // ICON_CATS_LOGO
+};
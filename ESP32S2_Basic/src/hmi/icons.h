@@ -0,0 +1,44 @@
+#pragma once
+
+// Generated by icon_packer.py from bmp.h, do not edit
+
+#include <Arduino.h>
+
+typedef enum {
+    ICON_ROCKET_RECOVERY,           // 32x32, 128 B packed to 123 B
+    ICON_HOUSE_RECOVERY,            // 32x32, 128 B packed to 119 B
+    ICON_SHIFT_KEYBOARD,            // 16x16, 32 B packed to 33 B
+    ICON_BACKSPACE_KEYBOARD,        // 24x24, 72 B packed to 47 B
+    ICON_ENTER_KEYBOARD,            // 16x16, 32 B packed to 31 B
+    ICON_LIVE_LON,                  // 24x24, 72 B packed to 49 B
+    ICON_LIVE_LAT,                  // 24x24, 72 B packed to 49 B
+    ICON_LIVE_SPEED,                // 24x24, 72 B packed to 46 B
+    ICON_LIVE_ALTITUDE,             // 24x24, 72 B packed to 48 B
+    ICON_LIVE_BATTERY,              // 24x24, 72 B packed to 61 B
+    ICON_LIVE_TWO,                  // 24x24, 72 B packed to 56 B
+    ICON_LIVE_ONE,                  // 24x24, 72 B packed to 56 B
+    ICON_LIVE_CHECKMARK,            // 16x16, 32 B packed to 25 B
+    ICON_LIVE_CROSS,                // 16x16, 32 B packed to 27 B
+    ICON_BAR_MEMORY,                // 16x16, 32 B packed to 33 B
+    ICON_BAR_DOWNLOAD,              // 16x16, 32 B packed to 29 B
+    ICON_BAR_LOCATION,              // 16x16, 32 B packed to 33 B
+    ICON_BAR_FLASH,                 // 16x16, 32 B packed to 32 B
+    ICON_MENU_LIVE,                 // 64x64, 512 B packed to 474 B
+    ICON_MENU_RECOVER,              // 64x64, 512 B packed to 474 B
+    ICON_MENU_TESTING,              // 64x64, 512 B packed to 428 B
+    ICON_MENU_DATA,                 // 64x64, 512 B packed to 394 B
+    ICON_MENU_SENSORS,              // 64x64, 512 B packed to 508 B
+    ICON_MENU_SETTINGS,             // 64x64, 512 B packed to 416 B
+    ICON_CATS_LOGO,                 // 120x200, 3000 B packed to 1958 B
+    ICON_COUNT,
+} icon_e;
+
+typedef struct {
+    uint16_t offset;                // [B]    Start of the PackBits stream in iconData
+    uint8_t width;                  // [px]
+    uint8_t height;                 // [px]
+} packed_icon_t;
+
+// 7160 B of bitmaps packed to 5549 B plus 100 B index
+extern const uint8_t iconData[];
+extern const packed_icon_t iconTable[ICON_COUNT];
@@ -0,0 +1,93 @@
+#include "input.h"
+#include "console.h"
+
+static const uint8_t buttonPins[BUTTON_COUNT] = {3, 4, 2, 5, 1, 7, 6};     // Same order as button_e, low active
+
+bool Input::begin(){
+    queue = xQueueCreate(INPUT_QUEUE_LENGTH, sizeof(input_event_t));
+    timer = xTimerCreate("input", pdMS_TO_TICKS(INPUT_DEBOUNCE_TIME), pdFALSE, this, timerCallback);
+    if(queue == NULL || timer == NULL){
+        console.error.println("[INPUT] Could not create queue or timer");
+        return false;
+    }
+
+    for(uint32_t i = 0; i < BUTTON_COUNT; i++){
+        pinMode(buttonPins[i], INPUT_PULLUP);
+        if(digitalRead(buttonPins[i]) == LOW){
+            state |= (1 << i);
+            pressTime[i] = millis();
+            nextRepeat[i] = pressTime[i] + INPUT_LONG_PRESS_TIME;
+        }
+        attachInterruptArg(buttonPins[i], pinChange, this, CHANGE);
+    }
+    return true;
+}
+
+bool Input::receive(TickType_t timeout){
+    valid = (xQueueReceive(queue, &event, timeout) == pdTRUE);
+    return valid;
+}
+
+/* Every edge restarts the debounce time, the pins are sampled once they settled */
+void IRAM_ATTR Input::pinChange(void* arg){
+    Input* ref = (Input*)arg;
+    BaseType_t woken = pdFALSE;
+    xTimerChangePeriodFromISR(ref->timer, pdMS_TO_TICKS(INPUT_DEBOUNCE_TIME), &woken);
+    if(woken){
+        portYIELD_FROM_ISR();
+    }
+}
+
+void Input::timerCallback(TimerHandle_t handle){
+    Input* ref = (Input*)pvTimerGetTimerID(handle);
+    ref->scan();
+}
+
+void Input::post(uint32_t button, input_event_e type, uint32_t time){
+    input_event_t e = {(uint8_t)button, (uint8_t)type, time};
+    if(xQueueSend(queue, &e, 0) != pdTRUE){
+        droppedEvents++;
+    }
+}
+
+/* Runs in the timer service task */
+void Input::scan(){
+    uint32_t now = millis();
+    int32_t wait = -1;
+
+    for(uint32_t i = 0; i < BUTTON_COUNT; i++){
+        uint32_t mask = (1 << i);
+        bool pressed = (digitalRead(buttonPins[i]) == LOW);
+
+        if(pressed && !(state & mask)){
+            state |= mask;
+            longPressed &= ~mask;
+            pressTime[i] = now;
+            nextRepeat[i] = now + INPUT_LONG_PRESS_TIME;
+            post(i, INPUT_PRESS, micros());
+        } else if(!pressed && (state & mask)){
+            state &= ~mask;
+            post(i, INPUT_RELEASE, micros());
+        } else if(pressed && (int32_t)(now - nextRepeat[i]) >= 0){
+            if(!(longPressed & mask)){
+                longPressed |= mask;
+                post(i, INPUT_LONG_PRESS, micros());
+            }
+            post(i, INPUT_REPEAT, micros());
+            nextRepeat[i] += INPUT_REPEAT_INTERVAL;
+            if((int32_t)(now - nextRepeat[i]) >= 0){
+                nextRepeat[i] = now + INPUT_REPEAT_INTERVAL;        // Timer task was late, do not post a burst
+            }
+        }
+
+        if(state & mask){
+            int32_t remaining = nextRepeat[i] - now;
+            if(wait < 0 || remaining < wait) wait = remaining;
+        }
+    }
+
+    // Keep sampling while a button is held, the timer stays idle otherwise
+    if(wait >= 0){
+        xTimerChangePeriod(timer, max(pdMS_TO_TICKS(wait), (TickType_t) 1), 0);
+    }
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <Arduino.h>
+#include "freertos/timers.h"
+
+#define INPUT_DEBOUNCE_TIME     25      // [ms]   Pin level must be stable this long
+#define INPUT_LONG_PRESS_TIME   500     // [ms]   Hold time until INPUT_LONG_PRESS and the first INPUT_REPEAT
+#define INPUT_REPEAT_INTERVAL   50      // [ms]   Time between two INPUT_REPEAT events
+#define INPUT_QUEUE_LENGTH      16      // [#]
+
+typedef enum {
+    BUTTON_UP = 0,
+    BUTTON_DOWN,
+    BUTTON_LEFT,
+    BUTTON_RIGHT,
+    BUTTON_CENTER,
+    BUTTON_OK,
+    BUTTON_BACK,
+    BUTTON_COUNT,
+} button_e;
+
+typedef enum {
+    INPUT_PRESS = 0,
+    INPUT_RELEASE,
+    INPUT_LONG_PRESS,
+    INPUT_REPEAT,
+} input_event_e;
+
+typedef struct {
+    uint8_t button;                     // button_e
+    uint8_t type;                       // input_event_e
+    uint32_t time;                      // [us]   Posted after debouncing
+} input_event_t;
+
+/*
+ * Interrupt driven buttons. A pin change (re)starts a debounce timer, the
+ * timer callback samples all pins and posts press and release events into
+ * a queue. While a button is held the timer keeps running and adds long
+ * press and repeat events, otherwise nothing runs until the next edge.
+ *
+ * The consumer takes one event at a time with receive(), the was...()
+ * queries then refer to that event.
+ */
+class Input {
+    public:
+        bool begin();
+
+        /* Waits for the next event, false on timeout (no current event then) */
+        bool receive(TickType_t timeout);
+
+        bool hasEvent() const {
+            return valid;
+        }
+
+        const input_event_t& getEvent() const {
+            return event;
+        }
+
+        bool wasPressed(button_e button) const {
+            return valid && event.button == button && event.type == INPUT_PRESS;
+        }
+
+        /* Pressed, or held long enough to repeat */
+        bool wasRepeated(button_e button) const {
+            return valid && event.button == button && (event.type == INPUT_PRESS || event.type == INPUT_REPEAT);
+        }
+
+        bool wasLongPressed(button_e button) const {
+            return valid && event.button == button && event.type == INPUT_LONG_PRESS;
+        }
+
+        bool isPressed(button_e button) const {
+            return state & (1 << button);
+        }
+
+        bool pressedFor(button_e button, uint32_t ms) const {
+            return isPressed(button) && (millis() - pressTime[button]) >= ms;
+        }
+
+        uint32_t getDroppedEvents() const {
+            return droppedEvents;
+        }
+
+    private:
+        QueueHandle_t queue = NULL;
+        TimerHandle_t timer = NULL;
+
+        input_event_t event = {};
+        bool valid = false;
+
+        volatile uint32_t state = 0;
+        uint32_t longPressed = 0;
+        volatile uint32_t pressTime[BUTTON_COUNT] = {};
+        uint32_t nextRepeat[BUTTON_COUNT] = {};
+        volatile uint32_t droppedEvents = 0;
+
+        void scan();
+        void post(uint32_t button, input_event_e type, uint32_t time);
+
+        static void IRAM_ATTR pinChange(void* arg);
+        static void timerCallback(TimerHandle_t handle);
+};
@@ -0,0 +1,65 @@
+#include "keyboard.h"
+
+const char keyboardChars[KEYBOARD_KEYS] = {
+    '1', '2', '3', '4', '5', '6', '7', '8', '9', '0',
+    'Q', 'W', 'E', 'R', 'T', 'Y', 'U', 'I', 'O', 'P',
+       'A', 'S', 'D', 'F', 'G', 'H', 'J', 'K', 'L',
+    ' ', 'Z', 'X', 'C', 'V', 'B', 'N', 'M', ' ' };
+
+void Keyboard::begin(const char* text, uint32_t maxLength){
+    this->maxLength = min(maxLength, (uint32_t) KEYBOARD_TEXT_LENGTH);
+    length = strnlen(text, this->maxLength);
+    memset(this->text, 0, sizeof(this->text));
+    memcpy(this->text, text, length);
+}
+
+keyboard_event_e Keyboard::moveTo(int32_t next){
+    if(next == key) return KEYBOARD_NONE;
+    key = next;
+    return KEYBOARD_MOVED;
+}
+
+/* Rows end at 9, 19, 28 and 37, the backspace button leads to the first row */
+keyboard_event_e Keyboard::moveRight(){
+    if(key == 9 || key == 19 || key == 28 || key == 37) return KEYBOARD_NONE;
+    return moveTo(key + 1);
+}
+
+keyboard_event_e Keyboard::moveLeft(){
+    if(key == -1 || key == 0 || key == 10 || key == 20 || key == 29) return KEYBOARD_NONE;
+    return moveTo(key - 1);
+}
+
+/* The rows below the digits are shifted by half a key, so the step is 10 or 9 */
+keyboard_event_e Keyboard::moveDown(){
+    if(key == KEYBOARD_BACKSPACE) return moveTo(7);
+    if(key < 15) return moveTo(key + 10);
+    if(key < 29) return moveTo(key + 9);
+    return KEYBOARD_NONE;
+}
+
+keyboard_event_e Keyboard::moveUp(){
+    if(key < 10) return moveTo(KEYBOARD_BACKSPACE);
+    if(key < 25) return moveTo(key - 10);
+    return moveTo(key - 9);
+}
+
+keyboard_event_e Keyboard::press(){
+    if(key == KEYBOARD_ENTER) return KEYBOARD_DONE;
+
+    if(key == KEYBOARD_SHIFT){
+        upperCase = !upperCase;
+    } else if(key == KEYBOARD_BACKSPACE){
+        if(length == 0) return KEYBOARD_NONE;
+        text[--length] = 0;
+    } else {
+        if(length >= maxLength) return KEYBOARD_NONE;
+        text[length++] = (!upperCase && key > 9) ? keyboardChars[key] + 32 : keyboardChars[key];
+    }
+    return KEYBOARD_EDITED;
+}
+
+void Keyboard::store(char* setting) const {
+    memset(setting, 0, maxLength + 1);
+    memcpy(setting, text, length);
+}
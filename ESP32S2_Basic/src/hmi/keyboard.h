@@ -0,0 +1,63 @@
+#pragma once
+
+#include <Arduino.h>
+
+#define KEYBOARD_KEYS           38      // [#]    Keys 0 to 37, the backspace button is -1
+#define KEYBOARD_TEXT_LENGTH    8       // [B]    Longest text, without the terminator
+#define KEYBOARD_BACKSPACE      -1
+#define KEYBOARD_SHIFT          29
+#define KEYBOARD_ENTER          37
+
+/* Upper case labels of the keys, letters start at key 10 */
+extern const char keyboardChars[KEYBOARD_KEYS];
+
+typedef enum {
+    KEYBOARD_NONE = 0,                  // Nothing changed
+    KEYBOARD_MOVED,                     // Other key highlighted
+    KEYBOARD_EDITED,                    // Text or case changed
+    KEYBOARD_DONE,                      // Enter pressed, the text is final
+} keyboard_event_e;
+
+/*
+ * Text entry of the settings with the on screen keyboard. Owned by the HMI
+ * task, which moves the highlight with the buttons and copies the text into
+ * the setting when done. The render task only gets the text, the
+ * highlighted key and the case, and draws them.
+ */
+class Keyboard {
+    public:
+        /* Starts editing a copy of text, at most maxLength characters; key and case stay as left */
+        void begin(const char* text, uint32_t maxLength);
+
+        keyboard_event_e moveLeft();
+        keyboard_event_e moveRight();
+        keyboard_event_e moveUp();
+        keyboard_event_e moveDown();
+
+        /* Types, deletes, shifts or finishes, depending on the highlighted key */
+        keyboard_event_e press();
+
+        /* Writes the text into a setting of maxLength characters plus the terminator */
+        void store(char* setting) const;
+
+        const char* getText() const {
+            return text;
+        }
+
+        int32_t getKey() const {
+            return key;
+        }
+
+        bool isUpperCase() const {
+            return upperCase;
+        }
+
+    private:
+        keyboard_event_e moveTo(int32_t next);
+
+        char text[KEYBOARD_TEXT_LENGTH + 1] = {};
+        uint32_t length = 0;
+        uint32_t maxLength = KEYBOARD_TEXT_LENGTH;
+        int32_t key = 0;
+        bool upperCase = true;
+};
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <Arduino.h>
+
+#define LATENCY_BUCKETS         12      // [#]    Bucket 0 below 128 us, then one per power of two, the last one open
+#define LATENCY_FIRST_SHIFT     7       // [#]    log2 of the upper limit of bucket 0
+
+/*
+ * Logarithmic latency histogram. Written by one task, read by the shell,
+ * counters may be torn by a concurrent reset but never overflow a bucket.
+ */
+class LatencyHistogram {
+    public:
+        void add(uint32_t us){
+            uint32_t bucket = 0;
+            if(us >> LATENCY_FIRST_SHIFT){
+                bucket = min((uint32_t)(32 - __builtin_clz(us) - LATENCY_FIRST_SHIFT), (uint32_t)(LATENCY_BUCKETS - 1));
+            }
+            counts[bucket]++;
+            total++;
+            if(us > maximum) maximum = us;
+        }
+
+        void reset(){
+            memset((void*)counts, 0, sizeof(counts));
+            total = 0;
+            maximum = 0;
+        }
+
+        /* Lower limit of the bucket in [us] */
+        static uint32_t lowerLimit(uint32_t bucket){
+            return bucket ? (1 << (bucket + LATENCY_FIRST_SHIFT - 1)) : 0;
+        }
+
+        uint32_t getCount(uint32_t bucket) const {
+            return counts[bucket];
+        }
+
+        uint32_t getTotal() const {
+            return total;
+        }
+
+        uint32_t getMaximum() const {
+            return maximum;
+        }
+
+    private:
+        volatile uint32_t counts[LATENCY_BUCKETS] = {};
+        volatile uint32_t total = 0;
+        volatile uint32_t maximum = 0;
+};
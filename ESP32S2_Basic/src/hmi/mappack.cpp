@@ -0,0 +1,150 @@
+#include "mappack.h"
+#include "console.h"
+
+bool MapPack::begin(const char* path){
+    this->path = path;
+    levelCount = 0;
+
+    map_pack_header_t header = {};
+    map_level_t loaded[MAP_MAX_LEVELS];
+    fsLock();
+    File file = fatfs.open(path, FILE_READ);
+    bool valid = file && file.read(&header, sizeof(header)) == sizeof(header) &&
+                 header.magic == MAP_PACK_MAGIC && header.version == MAP_PACK_VERSION &&
+                 header.tileSize == MAP_TILE_SIZE && header.levelCount > 0 && header.levelCount <= MAP_MAX_LEVELS &&
+                 file.read(loaded, header.levelCount * sizeof(map_level_t)) == (int)(header.levelCount * sizeof(map_level_t));
+    if(file) file.close();
+    fsUnlock();
+
+    if(!valid){
+        console.warning.printf("[MAP] No valid map pack %s\n", path);
+        return false;
+    }
+
+    for(uint32_t i = 0; i < MAP_CACHE_TILES; i++){
+        if(cache[i].bitmap == NULL){
+            cache[i].bitmap = (uint8_t*)heap_caps_malloc(MAP_TILE_BYTES, MALLOC_CAP_SPIRAM);
+        }
+        if(cache[i].bitmap == NULL){
+            console.error.println("[MAP] Could not allocate tile cache");
+            return false;
+        }
+        cache[i].valid = false;
+    }
+
+    // Insertion sort by zoom, the pack lists at most MAP_MAX_LEVELS levels
+    for(uint32_t i = 0; i < header.levelCount; i++){
+        uint32_t j = i;
+        while(j > 0 && levels[j - 1].zoom > loaded[i].zoom){
+            levels[j] = levels[j - 1];
+            j--;
+        }
+        levels[j] = loaded[i];
+    }
+    levelCount = header.levelCount;
+    console.ok.printf("[MAP] %s with %u zoom levels\n", path, levelCount);
+    return true;
+}
+
+const map_level_t* MapPack::findLevel(uint8_t zoom) const {
+    for(uint32_t i = 0; i < levelCount; i++){
+        if(levels[i].zoom == zoom) return &levels[i];
+    }
+    return NULL;
+}
+
+const uint8_t* MapPack::getTile(uint8_t zoom, uint32_t x, uint32_t y){
+    const map_level_t* level = findLevel(zoom);
+    if(level == NULL || x - level->x0 >= level->columns || y - level->y0 >= level->rows){
+        return NULL;
+    }
+
+    for(uint32_t i = 0; i < MAP_CACHE_TILES; i++){
+        map_cache_slot_t* slot = &cache[i];
+        if(slot->valid && slot->zoom == zoom && slot->x == x && slot->y == y){
+            slot->used = ++stamp;
+            hits++;
+            return slot->present ? slot->bitmap : NULL;
+        }
+    }
+
+    misses++;
+    map_cache_slot_t* slot = evict();
+    slot->zoom = zoom;
+    slot->x = x;
+    slot->y = y;
+    slot->used = ++stamp;
+    slot->present = load(level, x, y, slot);
+    slot->valid = true;
+    return slot->present ? slot->bitmap : NULL;
+}
+
+map_cache_slot_t* MapPack::evict(){
+    map_cache_slot_t* oldest = &cache[0];
+    for(uint32_t i = 0; i < MAP_CACHE_TILES; i++){
+        if(!cache[i].valid) return &cache[i];
+        if(cache[i].used < oldest->used) oldest = &cache[i];
+    }
+    return oldest;
+}
+
+/* The index entry is at a fixed position, the file system lock is only held per chunk */
+bool MapPack::load(const map_level_t* level, uint32_t x, uint32_t y, map_cache_slot_t* slot){
+    uint32_t index = (y - level->y0) * level->columns + (x - level->x0);
+    map_tile_entry_t entry = {};
+
+    fsLock();
+    File file = fatfs.open(path, FILE_READ);
+    bool ok = file && file.seekSet(level->indexOffset + index * sizeof(map_tile_entry_t)) &&
+              file.read(&entry, sizeof(entry)) == sizeof(entry) &&
+              entry.length > 0 && file.seekSet(entry.offset);
+    fsUnlock();
+
+    if(ok){
+        decode(file, entry.length, slot->bitmap);
+    }
+
+    fsLock();
+    if(file) file.close();
+    fsUnlock();
+    return ok;
+}
+
+/* PackBits, a header n of 0..127 is followed by n + 1 literal bytes, -127..-1 by one byte repeated 1 - n times */
+void MapPack::decode(File& file, uint32_t length, uint8_t* bitmap){
+    uint8_t chunk[MAP_CHUNK_SIZE];
+    uint32_t out = 0;
+    uint32_t literal = 0;
+    uint32_t repeat = 0;
+
+    while(length > 0 && out < MAP_TILE_BYTES){
+        fsLock();
+        int count = file.read(chunk, min(length, (uint32_t) sizeof(chunk)));
+        fsUnlock();
+        if(count <= 0) break;
+        length -= count;
+
+        // Runs may continue over chunk boundaries
+        for(int i = 0; i < count && out < MAP_TILE_BYTES; i++){
+            uint8_t c = chunk[i];
+            if(literal){
+                bitmap[out++] = c;
+                literal--;
+            } else if(repeat){
+                uint32_t n = min(repeat, (uint32_t) MAP_TILE_BYTES - out);
+                memset(&bitmap[out], c, n);
+                out += n;
+                repeat = 0;
+            } else if((int8_t)c >= 0){
+                literal = c + 1;
+            } else if((int8_t)c != -128){
+                repeat = 1 - (int8_t)c;
+            }
+        }
+    }
+
+    if(out < MAP_TILE_BYTES){
+        memset(&bitmap[out], 0, MAP_TILE_BYTES - out);
+        console.error.println("[MAP] Truncated tile");
+    }
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <Arduino.h>
+#include "utils.h"
+
+#define MAP_PACK_FILE           "/maps/site.pack"
+#define MAP_PACK_MAGIC          0x50414D43    // "CMAP"
+#define MAP_PACK_VERSION        1
+#define MAP_TILE_SIZE           256           // [px]   Web Mercator tiles, as the usual slippy map sources
+#define MAP_TILE_STRIDE         (MAP_TILE_SIZE / 8)                 // [B]
+#define MAP_TILE_BYTES          (MAP_TILE_STRIDE * MAP_TILE_SIZE)   // [B]
+#define MAP_MAX_LEVELS          8             // [#]    Zoom levels per pack
+#define MAP_CACHE_TILES         16            // [#]    Decoded tiles kept in PSRAM, 8 kB each
+#define MAP_CHUNK_SIZE          512           // [B]    Read size when decoding a tile
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t tileSize;                  // [px]
+    uint8_t levelCount;                 // [#]    Level descriptors following the header
+    uint8_t reserved[3];
+} map_pack_header_t;
+
+/* Rectangle of tiles of one zoom level, with one index entry per tile in row order */
+typedef struct {
+    uint8_t zoom;
+    uint8_t reserved[3];
+    uint32_t x0;                        // [#]    Tile column of the first index entry
+    uint32_t y0;                        // [#]    Tile row of the first index entry
+    uint16_t columns;                   // [#]
+    uint16_t rows;                      // [#]
+    uint32_t indexOffset;               // [B]    From the start of the file
+} map_level_t;
+
+typedef struct {
+    uint32_t offset;                    // [B]    PackBits stream of the tile, from the start of the file
+    uint32_t length;                    // [B]    0 if the tile is empty
+} map_tile_entry_t;
+
+typedef struct {
+    uint32_t x, y;                      // [#]    Tile coordinates
+    uint32_t used;                      // [#]    Access stamp for the LRU eviction
+    uint8_t zoom;
+    bool valid;
+    bool present;                       // False for empty tiles, which are cached as well
+    uint8_t* bitmap;                    // MAP_TILE_BYTES in PSRAM, rows in the display bit order
+} map_cache_slot_t;
+
+/*
+ * Offline 1-bpp map tiles, generated by map_packer.py and read from the
+ * flash drive. The pack has one index per zoom level covering a rectangle
+ * of tiles, so the index entry of a tile is found with one seek, without
+ * searching. Tiles are PackBits compressed and decoded while streaming
+ * the file in chunks into a slot of a small LRU cache in PSRAM, so a pan
+ * over already seen tiles touches no file at all.
+ */
+class MapPack {
+    public:
+        bool begin(const char* path = MAP_PACK_FILE);
+
+        bool isOpen() const {
+            return levelCount > 0;
+        }
+
+        uint32_t getLevelCount() const {
+            return levelCount;
+        }
+
+        /* Ordered by increasing zoom */
+        const map_level_t& getLevel(uint32_t index) const {
+            return levels[index];
+        }
+
+        /* Decoded tile, NULL if the pack has no or an empty tile there */
+        const uint8_t* getTile(uint8_t zoom, uint32_t x, uint32_t y);
+
+        uint32_t getHits() const {
+            return hits;
+        }
+
+        uint32_t getMisses() const {
+            return misses;
+        }
+
+    private:
+        const map_level_t* findLevel(uint8_t zoom) const;
+        map_cache_slot_t* evict();
+        bool load(const map_level_t* level, uint32_t x, uint32_t y, map_cache_slot_t* slot);
+        void decode(File& file, uint32_t length, uint8_t* bitmap);
+
+        const char* path = NULL;
+        map_level_t levels[MAP_MAX_LEVELS];
+        uint32_t levelCount = 0;
+
+        map_cache_slot_t cache[MAP_CACHE_TILES] = {};
+        uint32_t stamp = 0;
+        uint32_t hits = 0;
+        uint32_t misses = 0;
+};
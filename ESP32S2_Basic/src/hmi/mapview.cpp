@@ -0,0 +1,186 @@
+#include "mapview.h"
+
+#define MAP_MARKER_RADIUS       6             // [px]   Including the white halo
+
+bool MapView::begin(const char* path){
+    if(!pack.begin(path)) return false;
+
+    const map_level_t& level = pack.getLevel(pack.getLevelCount() / 2);
+    zoom = level.zoom;
+    return true;
+}
+
+void MapView::project(float lat, float lon, uint8_t zoom, int32_t* px, int32_t* py){
+    double size = (double)MAP_TILE_SIZE * (1UL << zoom);
+    double phi = lat * (PI / 180);
+    *px = (int32_t)((lon + 180.0) / 360.0 * size);
+    *py = (int32_t)((1.0 - log(tan(phi) + 1.0 / cos(phi)) / PI) / 2.0 * size);
+}
+
+uint8_t MapView::nextZoom() const {
+    if(!pack.isOpen()){
+        return (zoom >= MAP_DEFAULT_MAX_ZOOM) ? MAP_DEFAULT_MIN_ZOOM : zoom + 1;
+    }
+    for(uint32_t i = 0; i < pack.getLevelCount(); i++){
+        if(pack.getLevel(i).zoom > zoom) return pack.getLevel(i).zoom;
+    }
+    return pack.getLevel(0).zoom;
+}
+
+/* The view center keeps its position on the ground */
+void MapView::setZoom(uint8_t zoom){
+    if(zoom > this->zoom){
+        centerX <<= (zoom - this->zoom);
+        centerY <<= (zoom - this->zoom);
+    } else {
+        centerX >>= (this->zoom - zoom);
+        centerY >>= (this->zoom - zoom);
+    }
+    this->zoom = zoom;
+}
+
+void MapView::control(map_control_e command){
+    switch(command){
+        case MAP_PAN_UP:    centerY -= MAP_PAN_STEP; following = false; break;
+        case MAP_PAN_DOWN:  centerY += MAP_PAN_STEP; following = false; break;
+        case MAP_PAN_LEFT:  centerX -= MAP_PAN_STEP; following = false; break;
+        case MAP_PAN_RIGHT: centerX += MAP_PAN_STEP; following = false; break;
+        case MAP_ZOOM_IN:   setZoom(nextZoom()); break;
+        default: break;
+    }
+}
+
+void MapView::follow(){
+    following = true;
+    centered = false;
+    valid = false;
+}
+
+/* Centers on the mean of the markers if one of them left the inner part of the view */
+void MapView::recenter(int16_t width, const int32_t* px, const int32_t* py, const map_marker_t* markers, uint32_t count){
+    int32_t halfWidth = width / 2;
+    int64_t sumX = 0;
+    int64_t sumY = 0;
+    uint32_t n = 0;
+    bool outside = !centered;
+
+    for(uint32_t i = 0; i < count; i++){
+        if(!markers[i].valid) continue;
+        sumX += px[i];
+        sumY += py[i];
+        n++;
+        if(abs(px[i] - centerX) > halfWidth - MAP_FOLLOW_MARGIN || abs(py[i] - centerY) > h / 2 - MAP_FOLLOW_MARGIN){
+            outside = true;
+        }
+    }
+    if(n == 0 || !outside) return;
+
+    centerX = sumX / n;
+    centerY = sumY / n;
+    centered = true;
+}
+
+bool MapView::update(SharpDisplay& display, const map_marker_t* markers, uint32_t count){
+    int32_t px[MAP_MAX_MARKERS];
+    int32_t py[MAP_MAX_MARKERS];
+    int16_t width = display.width();
+    count = min(count, (uint32_t) MAP_MAX_MARKERS);
+
+    for(uint32_t i = 0; i < count; i++){
+        if(markers[i].valid) project(markers[i].lat, markers[i].lon, zoom, &px[i], &py[i]);
+    }
+    if(following){
+        recenter(width, px, py, markers, count);
+    }
+    if(!centered && pack.isOpen()){
+        // Nothing to follow yet, start in the middle of the pack
+        const map_level_t& level = pack.getLevel(0);
+        int32_t shift = zoom - level.zoom;
+        centerX = ((int32_t)(level.x0 * 2 + level.columns) * MAP_TILE_SIZE / 2) << shift;
+        centerY = ((int32_t)(level.y0 * 2 + level.rows) * MAP_TILE_SIZE / 2) << shift;
+        centered = true;
+    }
+
+    int32_t left = centerX - width / 2;
+    int32_t top = centerY - h / 2;
+    bool changed = !valid || zoom != drawnZoom || centerX != drawnX || centerY != drawnY;
+
+    int16_t sx[MAP_MAX_MARKERS];
+    int16_t sy[MAP_MAX_MARKERS];
+    bool shown[MAP_MAX_MARKERS];
+    for(uint32_t i = 0; i < count; i++){
+        int32_t x = markers[i].valid ? px[i] - left : -1;
+        int32_t yy = markers[i].valid ? py[i] - top : -1;
+        shown[i] = markers[i].valid && x >= MAP_MARKER_RADIUS && x < width - MAP_MARKER_RADIUS &&
+                   yy >= MAP_MARKER_RADIUS && yy < h - MAP_MARKER_RADIUS;
+        sx[i] = shown[i] ? x : 0;
+        sy[i] = shown[i] ? y + yy : 0;
+        if(shown[i] != markerShown[i] || sx[i] != markerX[i] || sy[i] != markerY[i]){
+            changed = true;
+        }
+    }
+    if(!changed) return false;
+
+    display.fillRect(0, y, width, h, background);
+    drawTiles(display);
+    for(uint32_t i = 0; i < count; i++){
+        if(shown[i]) drawMarker(display, sx[i], sy[i], markers[i].type);
+        markerShown[i] = shown[i];
+        markerX[i] = sx[i];
+        markerY[i] = sy[i];
+    }
+
+    display.setFont(NULL);
+    display.setTextColor(color, background);
+    display.setCursor(width - 24, y + h - 9);
+    display.printf("z%u", zoom);
+    if(!pack.isOpen()){
+        display.setCursor(2, y + h - 9);
+        display.print("No map");
+    }
+
+    valid = true;
+    drawnZoom = zoom;
+    drawnX = centerX;
+    drawnY = centerY;
+    return true;
+}
+
+/* Up to 3 x 2 tiles, rows outside the view are cut off here, columns by the panel */
+void MapView::drawTiles(SharpDisplay& display){
+    if(!pack.isOpen()) return;
+
+    int16_t width = display.width();
+    int32_t left = centerX - width / 2;
+    int32_t top = centerY - h / 2;
+
+    for(int32_t ty = top / MAP_TILE_SIZE; ty * MAP_TILE_SIZE < top + h; ty++){
+        for(int32_t tx = left / MAP_TILE_SIZE; tx * MAP_TILE_SIZE < left + width; tx++){
+            if(tx < 0 || ty < 0) continue;
+            const uint8_t* bitmap = pack.getTile(zoom, tx, ty);
+            if(bitmap == NULL) continue;
+
+            int32_t tileX = tx * MAP_TILE_SIZE - left;
+            int32_t tileY = ty * MAP_TILE_SIZE - top;
+            int32_t r0 = max(-tileY, (int32_t) 0);
+            int32_t r1 = min((int32_t) MAP_TILE_SIZE, h - tileY);
+            if(r1 <= r0) continue;
+            display.drawMask(tileX, y + tileY + r0, bitmap + r0 * MAP_TILE_STRIDE, MAP_TILE_SIZE, r1 - r0, MAP_TILE_STRIDE, color);
+        }
+    }
+}
+
+void MapView::drawMarker(SharpDisplay& display, int16_t x, int16_t y, map_marker_e type){
+    if(type == MAP_MARKER_STATION){
+        display.fillRect(x - 6, y - 6, 13, 13, background);
+        display.drawRect(x - 4, y - 4, 9, 9, color);
+        display.fillRect(x - 1, y - 1, 3, 3, color);
+    } else if(type == MAP_MARKER_ROCKET){
+        display.fillCircle(x, y, MAP_MARKER_RADIUS, background);
+        display.fillCircle(x, y, MAP_MARKER_RADIUS - 2, color);
+    } else {
+        display.fillCircle(x, y, MAP_MARKER_RADIUS, background);
+        display.drawCircle(x, y, MAP_MARKER_RADIUS - 2, color);
+        display.drawCircle(x, y, MAP_MARKER_RADIUS - 3, color);
+    }
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <Arduino.h>
+#include "display.h"
+#include "mappack.h"
+
+#define MAP_MAX_MARKERS         4             // [#]
+#define MAP_DEFAULT_MIN_ZOOM    12            // [#]    Zoom levels without a map pack
+#define MAP_DEFAULT_MAX_ZOOM    18            // [#]
+#define MAP_PAN_STEP            64            // [px]
+#define MAP_FOLLOW_MARGIN       24            // [px]   Markers closer to the border recenter the view
+
+typedef enum {
+    MAP_MARKER_STATION = 0,
+    MAP_MARKER_ROCKET,                  // Selected target
+    MAP_MARKER_TARGET,                  // Other targets, drawn as a ring
+} map_marker_e;
+
+typedef enum {
+    MAP_PAN_UP = 0,
+    MAP_PAN_DOWN,
+    MAP_PAN_LEFT,
+    MAP_PAN_RIGHT,
+    MAP_ZOOM_IN,
+} map_control_e;
+
+typedef struct {
+    float lat, lon;                     // [deg]
+    map_marker_e type;
+    bool valid;
+} map_marker_t;
+
+/*
+ * Map of the tiles of a MapPack with the station and rocket markers. The
+ * view follows the markers until it is panned, and only recenters once a
+ * marker gets close to the border, so a moving rocket does not shift the
+ * map with every packet. The view spans the full panel width, the whole
+ * view is redrawn from the tile cache if the view or a marker position on
+ * the screen changed, and not at all otherwise.
+ */
+class MapView {
+    public:
+        MapView(int16_t y, int16_t h, uint16_t color, uint16_t background) : y(y), h(h), color(color), background(background) {}
+
+        bool begin(const char* path = MAP_PACK_FILE);
+
+        /* Pan or zoom, zooming in past the last level starts over at the first one */
+        void control(map_control_e command);
+
+        /* Back to following the markers, e.g. when the page is opened */
+        void follow();
+
+        bool update(SharpDisplay& display, const map_marker_t* markers, uint32_t count);
+
+        void invalidate(){
+            valid = false;
+        }
+
+        /* Web Mercator pixel coordinates at the zoom level */
+        static void project(float lat, float lon, uint8_t zoom, int32_t* px, int32_t* py);
+
+    private:
+        uint8_t nextZoom() const;
+        void setZoom(uint8_t zoom);
+        void recenter(int16_t width, const int32_t* px, const int32_t* py, const map_marker_t* markers, uint32_t count);
+        void drawTiles(SharpDisplay& display);
+        void drawMarker(SharpDisplay& display, int16_t x, int16_t y, map_marker_e type);
+
+        const int16_t y, h;
+        const uint16_t color, background;
+        MapPack pack;
+
+        uint8_t zoom = MAP_DEFAULT_MIN_ZOOM + 4;
+        int32_t centerX = 0;            // [px]   Pixel coordinates of the view center at the zoom level
+        int32_t centerY = 0;
+        bool centered = false;
+        bool following = true;
+
+        bool valid = false;
+        uint8_t drawnZoom = 0;
+        int32_t drawnX = 0;
+        int32_t drawnY = 0;
+        int16_t markerX[MAP_MAX_MARKERS] = {};
+        int16_t markerY[MAP_MAX_MARKERS] = {};
+        bool markerShown[MAP_MAX_MARKERS] = {};
+};
@@ -0,0 +1,389 @@
+#include "renderer.h"
+#include "console.h"
+#include "logging/crashlog.h"
+
+bool Renderer::begin(){
+    window.begin();
+
+    queue = xQueueCreate(RENDER_QUEUE_LENGTH, sizeof(render_request_t));
+    if(queue == NULL){
+        console.error.println("[RENDER] Could not create queue");
+        return false;
+    }
+    xTaskCreate(renderTask, "task_render", 8196, this, RENDER_TASK_PRIORITY, &task);
+
+    profileQueue = xQueueCreate(1, sizeof(log_index_entry_t));
+    if(profileQueue == NULL){
+        console.error.println("[RENDER] Could not create profile queue");
+        return false;
+    }
+    xTaskCreate(profileTask, "task_profile", RENDER_PROFILE_STACK, this, RENDER_TASK_PRIORITY, &profileHandle);
+    return true;
+}
+
+void Renderer::commit(){
+    if(posted && task){
+        posted = false;
+        xTaskNotifyGive(task);
+    }
+}
+
+/* Never blocks the HMI task, a full queue drops the request */
+void Renderer::post(render_command_e command, int32_t index, const char* text, bool flag0, bool flag1){
+    render_request_t request = {};
+    request.command = command;
+    request.flag[0] = flag0;
+    request.flag[1] = flag1;
+    request.index = index;
+    request.eventTime = eventTime;
+    if(text){
+        strlcpy(request.text, text, sizeof(request.text));
+    }
+
+    // Periodic updates of the old page must not be drawn over the new one
+    portENTER_CRITICAL(&lock);
+    dirty &= ~RENDER_DIRTY_PAGE;
+    portEXIT_CRITICAL(&lock);
+
+    if(xQueueSend(queue, &request, 0) != pdTRUE){
+        droppedRequests++;
+        console.error.println("[RENDER] Request queue full");
+    }
+    posted = true;
+}
+
+void Renderer::markDirty(uint32_t bits){
+    dirty |= bits;
+    posted = true;
+}
+
+void Renderer::logo(){
+    post(RENDER_LOGO);
+}
+
+void Renderer::initBar(){
+    post(RENDER_INIT_BAR);
+}
+
+void Renderer::updateBar(float batteryVoltage, bool usb, bool logging, bool location, bool time){
+    portENTER_CRITICAL(&lock);
+    bar.voltage = batteryVoltage;
+    bar.usb = usb;
+    bar.logging = logging;
+    bar.location = location;
+    bar.time = time;
+    markDirty(RENDER_DIRTY_BAR);
+    portEXIT_CRITICAL(&lock);
+}
+
+void Renderer::initMenu(uint32_t index){
+    post(RENDER_INIT_MENU, index);
+}
+
+void Renderer::updateMenu(uint32_t index){
+    post(RENDER_UPDATE_MENU, index);
+}
+
+void Renderer::initLive(){
+    post(RENDER_INIT_LIVE);
+}
+
+/* The snapshot is taken here, reading a value resets the updated flag for the HMI task */
+void Renderer::updateLive(TelemetryInfo* info, uint32_t index){
+    if(index > 1) return;
+
+    info->lq();
+    portENTER_CRITICAL(&lock);
+    liveInfo[index] = *info;
+    markDirty(index ? RENDER_DIRTY_LIVE_INFO2 : RENDER_DIRTY_LIVE_INFO1);
+    portEXIT_CRITICAL(&lock);
+}
+
+void Renderer::updateLive(TelemetryData* data, TelemetryInfo* info, uint32_t index){
+    if(index > 1) return;
+
+    if(!data->testingMode()){
+        altitudeHistory[index].push(data->altitude());
+        velocityHistory[index].push(data->velocity());
+    }
+
+    data->state();
+    info->lq();
+    portENTER_CRITICAL(&lock);
+    liveData[index] = *data;
+    liveInfo[index] = *info;
+    markDirty(index ? (RENDER_DIRTY_LIVE_DATA2 | RENDER_DIRTY_LIVE_INFO2) : (RENDER_DIRTY_LIVE_DATA1 | RENDER_DIRTY_LIVE_INFO1));
+    portEXIT_CRITICAL(&lock);
+}
+
+void Renderer::setLiveView(bool charts){
+    post(RENDER_LIVE_VIEW, 0, NULL, charts);
+}
+
+void Renderer::initRecovery(){
+    post(RENDER_INIT_RECOVERY);
+}
+
+/* Like updateSensors, the render task never calls into the Navigation */
+void Renderer::updateRecovery(Navigation* navigation, uint32_t target){
+    recovery_snapshot_t snapshot;
+    navigation->getRecoverySnapshot(target, &snapshot);
+
+    portENTER_CRITICAL(&lock);
+    recovery = snapshot;
+    markDirty(RENDER_DIRTY_RECOVERY);
+    portEXIT_CRITICAL(&lock);
+}
+
+void Renderer::setRecoveryView(recovery_view_e view){
+    post(RENDER_RECOVERY_VIEW, view);
+}
+
+void Renderer::selectRecoveryTarget(uint32_t index){
+    post(RENDER_RECOVERY_TARGET, index);
+}
+
+void Renderer::controlMap(map_control_e command){
+    post(RENDER_MAP_CONTROL, command);
+}
+
+void Renderer::initTesting(){
+    post(RENDER_INIT_TESTING);
+}
+
+void Renderer::initTestingConfirmed(bool connected, bool testingEnabled){
+    post(RENDER_TESTING_CONFIRMED, 0, NULL, connected, testingEnabled);
+}
+
+void Renderer::initTestingFailed(){
+    post(RENDER_TESTING_FAILED);
+}
+
+void Renderer::initTestingWait(){
+    post(RENDER_TESTING_WAIT);
+}
+
+void Renderer::initTestingReady(){
+    post(RENDER_TESTING_READY);
+}
+
+void Renderer::initTestingLost(){
+    post(RENDER_TESTING_LOST);
+}
+
+void Renderer::updateTesting(uint32_t index){
+    post(RENDER_UPDATE_TESTING, index);
+}
+
+void Renderer::initTestingBox(uint32_t index){
+    post(RENDER_TESTING_BOX, index);
+}
+
+void Renderer::initData(){
+    post(RENDER_INIT_DATA);
+}
+
+void Renderer::updateData(uint32_t row){
+    post(RENDER_UPDATE_DATA, row);
+}
+
+void Renderer::initDataDetail(uint32_t row){
+    post(RENDER_DATA_DETAIL, row);
+}
+
+void Renderer::initSensors(){
+    post(RENDER_INIT_SENSORS);
+}
+
+/* The snapshot is copied twice, the navigation lock is never held while taking the render lock */
+void Renderer::updateSensors(Navigation* navigation){
+    navigation_snapshot_t snapshot;
+    navigation->getSnapshot(&snapshot);
+
+    portENTER_CRITICAL(&lock);
+    sensors = snapshot;
+    markDirty(RENDER_DIRTY_SENSORS);
+    portEXIT_CRITICAL(&lock);
+}
+
+void Renderer::initSettings(uint32_t submenu){
+    post(RENDER_INIT_SETTINGS, submenu);
+}
+
+void Renderer::updateSettings(int32_t index){
+    post(RENDER_UPDATE_SETTINGS, index);
+}
+
+void Renderer::initBox(const char* text){
+    post(RENDER_INIT_BOX, 0, text);
+}
+
+void Renderer::initKeyboard(const Keyboard& keyboard){
+    post(RENDER_INIT_KEYBOARD, keyboard.getKey(), keyboard.getText(), keyboard.isUpperCase());
+}
+
+void Renderer::updateKeyboard(const Keyboard& keyboard){
+    post(RENDER_UPDATE_KEYBOARD, keyboard.getKey(), keyboard.getText(), keyboard.isUpperCase());
+}
+
+void Renderer::draw(render_request_t& request){
+    switch(request.command){
+        case RENDER_LOGO:               window.logo(); break;
+        case RENDER_INIT_BAR:           window.initBar(); break;
+        case RENDER_INIT_MENU:          window.initMenu(request.index); break;
+        case RENDER_UPDATE_MENU:        window.updateMenu(request.index); break;
+        case RENDER_INIT_LIVE:          window.initLive(); drawLiveCharts(); break;
+        case RENDER_LIVE_VIEW:          window.setLiveView(request.flag[0]); drawLiveCharts(); break;
+        case RENDER_INIT_RECOVERY:      window.initRecovery(); break;
+        case RENDER_RECOVERY_VIEW:      window.setRecoveryView((recovery_view_e)request.index); break;
+        case RENDER_RECOVERY_TARGET:    window.selectRecoveryTarget(request.index); break;
+        case RENDER_MAP_CONTROL:        window.controlMap((map_control_e)request.index); break;
+        case RENDER_INIT_TESTING:       window.initTesting(); break;
+        case RENDER_TESTING_CONFIRMED:  window.initTestingConfirmed(request.flag[0], request.flag[1]); break;
+        case RENDER_TESTING_FAILED:     window.initTestingFailed(); break;
+        case RENDER_TESTING_WAIT:       window.initTestingWait(); break;
+        case RENDER_TESTING_READY:      window.initTestingReady(); break;
+        case RENDER_TESTING_LOST:       window.initTestingLost(); break;
+        case RENDER_UPDATE_TESTING:     window.updateTesting(request.index); break;
+        case RENDER_TESTING_BOX:        window.initTestingBox(request.index); break;
+        case RENDER_INIT_DATA:          window.initData(); break;
+        case RENDER_UPDATE_DATA:        window.updateData(request.index); break;
+        case RENDER_DATA_DETAIL:        drawDataDetail(request.index); break;
+        case RENDER_INIT_SENSORS:       window.initSensors(); break;
+        case RENDER_INIT_SETTINGS:      window.initSettings(request.index); break;
+        case RENDER_UPDATE_SETTINGS:    window.updateSettings(request.index); break;
+        case RENDER_INIT_BOX:           window.initBox(request.text); break;
+        case RENDER_INIT_KEYBOARD:      window.initKeyboard(request.text, request.index, request.flag[0]); break;
+        case RENDER_UPDATE_KEYBOARD:    window.updateKeyboard(request.text, request.index, request.flag[0]); break;
+        default: break;
+    }
+}
+
+void Renderer::drawDirty(){
+    render_bar_t barCopy;
+
+    portENTER_CRITICAL(&lock);
+    uint32_t bits = dirty;
+    dirty = 0;
+    for(uint32_t i = 0; i < 2; i++){
+        drawData[i] = liveData[i];
+        drawInfo[i] = liveInfo[i];
+    }
+    barCopy = bar;
+    if(bits & RENDER_DIRTY_RECOVERY){
+        drawRecovery = recovery;
+    }
+    if(bits & RENDER_DIRTY_SENSORS){
+        drawSensors = sensors;
+    }
+    if(bits & RENDER_DIRTY_PROFILE){
+        drawProfile = profile;
+    }
+    portEXIT_CRITICAL(&lock);
+
+    for(uint32_t i = 0; i < 2; i++){
+        uint32_t dataBit = i ? RENDER_DIRTY_LIVE_DATA2 : RENDER_DIRTY_LIVE_DATA1;
+        uint32_t infoBit = i ? RENDER_DIRTY_LIVE_INFO2 : RENDER_DIRTY_LIVE_INFO1;
+        if(bits & dataBit){
+            window.updateLive(&drawData[i], &drawInfo[i], i);
+            window.updateLiveCharts(i, altitudeHistory[i], velocityHistory[i]);
+        } else if(bits & infoBit){
+            window.updateLive(&drawInfo[i], i);
+        }
+    }
+
+    if(bits & RENDER_DIRTY_RECOVERY){
+        window.updateRecovery(drawRecovery);
+    }
+
+    if(bits & RENDER_DIRTY_SENSORS){
+        window.updateSensors(drawSensors);
+    }
+
+    if(bits & RENDER_DIRTY_PROFILE){
+        window.updateDataProfile(drawProfile);
+    }
+
+    if(bits & RENDER_DIRTY_BAR){
+        window.updateBar(barCopy.voltage, barCopy.usb, barCopy.logging, barCopy.location, barCopy.time);
+    }
+}
+
+void Renderer::drawLiveCharts(){
+    for(uint32_t i = 0; i < 2; i++){
+        window.updateLiveCharts(i, altitudeHistory[i], velocityHistory[i]);
+    }
+}
+
+/* A newer log replaces a pending one, a profile that is still being scanned is dropped by the Window */
+void Renderer::drawDataDetail(uint32_t row){
+    log_index_entry_t entry;
+    if(window.initDataDetail(row, &entry) && profileQueue){
+        xQueueOverwrite(profileQueue, &entry);
+    }
+}
+
+void Renderer::addProfileSample(void* context, uint32_t sample, int32_t altitude){
+    data_profile_t* profile = (data_profile_t*)context;
+    if(profile->samples == 0) return;
+
+    uint32_t column = min((uint32_t)((uint64_t) sample * WINDOW_PROFILE_WIDTH / profile->samples), (uint32_t)(WINDOW_PROFILE_WIDTH - 1));
+    profile->minimum[column] = min(profile->minimum[column], altitude);
+    profile->maximum[column] = max(profile->maximum[column], altitude);
+}
+
+/* One column per WINDOW_PROFILE_WIDTH-th of the samples in the index entry */
+void Renderer::scanProfile(const log_index_entry_t& entry){
+    scanned.number = entry.number;
+    scanned.samples = entry.samples;
+    for(uint32_t i = 0; i < WINDOW_PROFILE_WIDTH; i++){
+        scanned.minimum[i] = INT32_MAX;
+        scanned.maximum[i] = INT32_MIN;
+    }
+    log_index_entry_t statistics = {};
+    scanned.valid = logIndex && entry.samples > 0 && logIndex->scan(entry.number, &statistics, addProfileSample, &scanned);
+}
+
+void Renderer::renderTask(void* pvParameter){
+    Renderer* ref = (Renderer*)pvParameter;
+
+    while(true){
+        // Wakes up on new requests, or for frames held back by the frame rate limit and the VCOM toggle
+        TickType_t timeout = pdMS_TO_TICKS(ref->window.hasPendingFrame() ? (1000 / WINDOW_MAX_FRAME_RATE) : WINDOW_VCOM_INTERVAL);
+        ulTaskNotifyTake(pdTRUE, timeout);
+        crashLog.heartbeat(HEARTBEAT_RENDER);
+        ref->cpuLock.acquire();
+
+        uint32_t firstEvent = 0;
+        render_request_t request;
+        while(xQueueReceive(ref->queue, &request, 0) == pdTRUE){
+            ref->draw(request);
+            if(request.eventTime && !firstEvent){
+                firstEvent = request.eventTime;
+            }
+        }
+        ref->drawDirty();
+
+        // Frames are sent immediately if a button event caused a change
+        if(ref->window.flush(firstEvent != 0) && firstEvent){
+            ref->frameLatency.add(micros() - firstEvent);
+        }
+        ref->cpuLock.release();
+    }
+}
+
+void Renderer::profileTask(void* pvParameter){
+    Renderer* ref = (Renderer*)pvParameter;
+    log_index_entry_t entry;
+
+    while(true){
+        if(xQueueReceive(ref->profileQueue, &entry, portMAX_DELAY) != pdTRUE) continue;
+        ref->scanProfile(entry);
+
+        portENTER_CRITICAL(&ref->lock);
+        ref->profile = ref->scanned;
+        ref->dirty |= RENDER_DIRTY_PROFILE;
+        portEXIT_CRITICAL(&ref->lock);
+        xTaskNotifyGive(ref->task);
+    }
+}
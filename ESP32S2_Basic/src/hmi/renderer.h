@@ -0,0 +1,216 @@
+#pragma once
+
+#include <Arduino.h>
+#include "window.h"
+#include "latency.h"
+#include "power.h"
+
+#define RENDER_QUEUE_LENGTH     32      // [#]
+#define RENDER_TEXT_LENGTH      24      // [B]    Box and keyboard text, including the terminator
+#define RENDER_TASK_PRIORITY    1       // [#]    Below the HMI task, display transfers never delay button handling
+#define RENDER_PROFILE_STACK    4096    // [B]    Profile task, the log is read in LOG_INDEX_CHUNK_SIZE chunks on its stack
+
+typedef enum {
+    RENDER_LOGO = 0,
+    RENDER_INIT_BAR,
+    RENDER_INIT_MENU,
+    RENDER_UPDATE_MENU,
+    RENDER_INIT_LIVE,
+    RENDER_LIVE_VIEW,
+    RENDER_INIT_RECOVERY,
+    RENDER_RECOVERY_VIEW,
+    RENDER_RECOVERY_TARGET,
+    RENDER_MAP_CONTROL,
+    RENDER_INIT_TESTING,
+    RENDER_TESTING_CONFIRMED,
+    RENDER_TESTING_FAILED,
+    RENDER_TESTING_WAIT,
+    RENDER_TESTING_READY,
+    RENDER_TESTING_LOST,
+    RENDER_UPDATE_TESTING,
+    RENDER_TESTING_BOX,
+    RENDER_INIT_DATA,
+    RENDER_UPDATE_DATA,
+    RENDER_DATA_DETAIL,
+    RENDER_INIT_SENSORS,
+    RENDER_INIT_SETTINGS,
+    RENDER_UPDATE_SETTINGS,
+    RENDER_INIT_BOX,
+    RENDER_INIT_KEYBOARD,
+    RENDER_UPDATE_KEYBOARD,
+} render_command_e;
+
+/* Periodic updates, set by the HMI task and taken by the render task with the latest data */
+typedef enum {
+    RENDER_DIRTY_LIVE_DATA1 = (1 << 0),
+    RENDER_DIRTY_LIVE_INFO1 = (1 << 1),
+    RENDER_DIRTY_LIVE_DATA2 = (1 << 2),
+    RENDER_DIRTY_LIVE_INFO2 = (1 << 3),
+    RENDER_DIRTY_RECOVERY   = (1 << 4),
+    RENDER_DIRTY_BAR        = (1 << 5),
+    RENDER_DIRTY_SENSORS    = (1 << 6),
+    RENDER_DIRTY_PROFILE    = (1 << 7),     // Set by the profile task
+} render_dirty_e;
+
+#define RENDER_DIRTY_PAGE       (RENDER_DIRTY_LIVE_DATA1 | RENDER_DIRTY_LIVE_INFO1 | RENDER_DIRTY_LIVE_DATA2 | RENDER_DIRTY_LIVE_INFO2 | RENDER_DIRTY_RECOVERY | RENDER_DIRTY_SENSORS | RENDER_DIRTY_PROFILE)
+
+typedef struct {
+    uint8_t command;                    // render_command_e
+    bool flag[2];                       // Arguments of initTestingConfirmed, setLiveView and the keyboard case
+    int32_t index;                      // Menu, testing, settings, key or target index, submenu, text length, recovery view or map command
+    uint32_t eventTime;                 // [us]   Button event that caused the request, 0 if none
+    char text[RENDER_TEXT_LENGTH];
+} render_request_t;
+
+typedef struct {
+    float voltage;
+    bool usb;
+    bool logging;
+    bool location;
+    bool time;
+} render_bar_t;
+
+/*
+ * Front end of the Window for the HMI task. Page changes and button driven
+ * updates are queued as render requests and drawn in order, periodic
+ * updates only mark the page dirty and hand over a snapshot of their data,
+ * so a slow render task skips intermediate values instead of falling
+ * behind. A page change drops the pending periodic updates of the old page.
+ *
+ * The render task owns the Window and the display. It wakes up on commit()
+ * and sends the frame immediately if a request came from a button event,
+ * otherwise at the frame rate limit of the Window.
+ *
+ * The altitude profile of the Data detail page streams a whole log, so it
+ * is scanned by a profile task and handed over like the periodic updates,
+ * the render task keeps drawing and sending frames meanwhile.
+ */
+class Renderer {
+    public:
+        bool begin();
+
+        /* Requests of the following calls carry this button event time, 0 for none */
+        void setEventTime(uint32_t us){
+            eventTime = us;
+        }
+
+        /* Wakes up the render task if anything was requested since the last commit */
+        void commit();
+
+        void logo();
+        void initBar();
+        void updateBar(float batteryVoltage, bool usb, bool logging, bool location, bool time);
+
+        void initMenu(uint32_t index);
+        void updateMenu(uint32_t index);
+
+        void initLive();
+        void updateLive(TelemetryInfo* info, uint32_t index);
+        void updateLive(TelemetryData* data, TelemetryInfo* info, uint32_t index);
+        void setLiveView(bool charts);
+
+        void initRecovery();
+        void updateRecovery(Navigation* navigation, uint32_t target);
+        void setRecoveryView(recovery_view_e view);
+        void selectRecoveryTarget(uint32_t index);
+        void controlMap(map_control_e command);
+
+        void initTesting();
+        void initTestingConfirmed(bool connected, bool testingEnabled);
+        void initTestingFailed();
+        void initTestingWait();
+        void initTestingReady();
+        void initTestingLost();
+        void updateTesting(uint32_t index);
+        void initTestingBox(uint32_t index);
+
+        /* Before begin() */
+        void setLogIndex(LogIndex* index){
+            logIndex = index;
+            window.setLogIndex(index);
+        }
+
+        void initData();
+        void updateData(uint32_t row);
+        void initDataDetail(uint32_t row);
+
+        void initSensors();
+        void updateSensors(Navigation* navigation);
+
+        void initSettings(uint32_t submenu);
+        void updateSettings(int32_t index);
+
+        void initBox(const char* text);
+
+        /* The text is edited by the HMI task, only its state is drawn */
+        void initKeyboard(const Keyboard& keyboard);
+        void updateKeyboard(const Keyboard& keyboard);
+
+        const Window& getWindow() const {
+            return window;
+        }
+
+        Window& getWindow() {
+            return window;
+        }
+
+        /* Button event to the start of the frame transfer showing its result */
+        LatencyHistogram& getFrameLatency() {
+            return frameLatency;
+        }
+
+        uint32_t getDroppedRequests() const {
+            return droppedRequests;
+        }
+
+    private:
+        void post(render_command_e command, int32_t index = 0, const char* text = NULL, bool flag0 = false, bool flag1 = false);
+        void markDirty(uint32_t bits);
+        void draw(render_request_t& request);
+        void drawDirty();
+        void drawLiveCharts();
+        void drawDataDetail(uint32_t row);
+        void scanProfile(const log_index_entry_t& entry);
+
+        static void addProfileSample(void* context, uint32_t sample, int32_t altitude);
+        static void renderTask(void* pvParameter);
+        static void profileTask(void* pvParameter);
+
+        Window window;
+        QueueHandle_t queue = NULL;
+        TaskHandle_t task = NULL;
+
+        uint32_t eventTime = 0;
+        bool posted = false;
+        volatile uint32_t droppedRequests = 0;
+
+        // Written by the HMI task and taken by the render task under the lock
+        portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+        uint32_t dirty = 0;
+        TelemetryData liveData[2];
+        TelemetryInfo liveInfo[2];
+        render_bar_t bar = {};
+        recovery_snapshot_t recovery;
+        navigation_snapshot_t sensors = {};
+        data_profile_t profile;
+
+        // Every packet is pushed by the HMI task, so the charts see all samples even if frames are coalesced
+        SampleRing altitudeHistory[2];
+        SampleRing velocityHistory[2];
+
+        // Render task copies
+        TelemetryData drawData[2];
+        TelemetryInfo drawInfo[2];
+        recovery_snapshot_t drawRecovery;
+        navigation_snapshot_t drawSensors;
+        data_profile_t drawProfile;
+
+        // Profile task, takes the latest log to scan from the queue
+        LogIndex* logIndex = NULL;
+        QueueHandle_t profileQueue = NULL;
+        TaskHandle_t profileHandle = NULL;
+        data_profile_t scanned;
+
+        LatencyHistogram frameLatency;
+        PowerLock cpuLock = PowerLock("render");
+};
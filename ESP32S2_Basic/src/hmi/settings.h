@@ -24,6 +24,14 @@ typedef union {
 } settings_limits_u;
 
 
+/* New value of a setting, the member is given by its type */
+typedef union {
+    char text[sizeof(systemConfig_t::linkPhrase1)];
+    bool toggle;
+    int16_t number;
+} settings_value_u;
+
+
 typedef struct{
 
     const char* name;
@@ -40,6 +48,7 @@ typedef enum {
     TABLE_MODE = 0,
     TABLE_UNIT,
     TABLE_LOGGING,
+    TABLE_POWER,
 } lookup_table_index_e;
 
 const char* const mode_map[2] = {
@@ -54,6 +63,10 @@ const char* const logging_map[2] = {
     "DOWN", "NEVER",
 };
 
+const char* const power_map[2] = {
+    "FULL", "ECO",
+};
+
 typedef struct {
   const char *const *values;
   const uint8_t value_count;
@@ -66,6 +79,7 @@ const lookup_table_entry_t lookup_tables[] = {
     LOOKUP_TABLE_ENTRY(mode_map),
     LOOKUP_TABLE_ENTRY(unit_map),
     LOOKUP_TABLE_ENTRY(logging_map),
+    LOOKUP_TABLE_ENTRY(power_map),
 };
 
 const char* const settingPageName[2] = {
@@ -75,6 +89,7 @@ const char* const settingPageName[2] = {
 const device_settings_t settingsTable[][4] = {{
     {"Time Zone", "Set the time offset", "", NUMBER, {.minmax = {.min = -12, .max = 12}}, &systemConfig.config.timeZoneOffset},
     {"Stop Logging", "Down: Stop the log at touchdown", "Never: Never stop logging after liftoff", TOGGLE, {.lookup = TABLE_LOGGING}, &systemConfig.config.neverStopLogging},
+    {"Power", "Full: CPU fixed at 240 MHz", "Eco: 80 to 240 MHz, sleep when idle", TOGGLE, {.lookup = TABLE_POWER}, &systemConfig.config.powerMode},
 },
 {
     {"Mode", "Single: Use both receiver to track one rocket" ,"Dual: Use both receivers individually", TOGGLE, {.lookup = TABLE_MODE}, &systemConfig.config.receiverMode},
@@ -84,4 +99,4 @@ const device_settings_t settingsTable[][4] = {{
 },
 };
 
-const uint16_t settingsTableValueCount[2] = {2, 4};
+const uint16_t settingsTableValueCount[2] = {3, 4};
@@ -0,0 +1,92 @@
+#include "stripchart.h"
+
+StripChart::StripChart(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, uint16_t background) :
+    x(x + STRIPCHART_MARGIN), y(y), w(min((int16_t)(w - STRIPCHART_MARGIN), (int16_t) STRIPCHART_SAMPLES)), h(h),
+    color(color), background(background),
+    upper(x, y, STRIPCHART_MARGIN - 2, 8, y, NULL, color, background),
+    lower(x, y + h - 8, STRIPCHART_MARGIN - 2, 8, y + h - 8, NULL, color, background) {}
+
+/* Smallest 1-2-5 step that fits the range into STRIPCHART_DIVISIONS steps from a multiple of the step */
+void StripChart::scale(int32_t minimum, int32_t maximum, int32_t* low, int32_t* high) const {
+    static const uint8_t mantissa[] = {1, 2, 5};
+    int32_t decade = 1;
+    for(uint32_t i = 0; ; i = (i + 1) % 3){
+        int32_t step = mantissa[i] * decade;
+        int32_t start = minimum / step * step;
+        if(start > minimum) start -= step;          // Floor for negative values
+        if(start + step * STRIPCHART_DIVISIONS >= maximum){
+            *low = start;
+            *high = start + step * STRIPCHART_DIVISIONS;
+            return;
+        }
+        if(i == 2) decade *= 10;
+    }
+}
+
+int16_t StripChart::toY(int32_t value) const {
+    return y + h - 1 - (int32_t)((int64_t)(value - low) * (h - 1) / (high - low));
+}
+
+/* Column of one sample, a vertical line from the previous sample keeps the trace connected */
+void StripChart::drawColumn(SharpDisplay& display, const SampleRing& ring, uint32_t head, uint32_t sequence){
+    int16_t column = x + w - (int16_t)(head - sequence);
+    int16_t y1 = toY(ring.get(sequence));
+    int16_t y0 = (sequence > 0) ? toY(ring.get(sequence - 1)) : y1;     // The ring holds more than the plot width
+
+    if(low < 0 && high > 0 && (sequence % STRIPCHART_DOT_SPACING) == 0){
+        display.drawPixel(column, toY(0), color);
+    }
+    display.drawFastVLine(column, min(y0, y1), abs(y1 - y0) + 1, color);
+}
+
+bool StripChart::update(SharpDisplay& display, const SampleRing& ring){
+    uint32_t head = ring.getHead();
+    if(valid && head == drawn) return false;
+
+    uint32_t visible = min(head, (uint32_t) w);
+    uint32_t first = head - visible;
+    if(visible == 0){
+        if(!valid){
+            valid = true;
+            drawn = head;
+            display.fillRect(x, y, w, h, background);
+            upper.set(display, "");
+            lower.set(display, "");
+        }
+        return false;
+    }
+
+    int32_t minimum = ring.get(first);
+    int32_t maximum = minimum;
+    for(uint32_t i = first + 1; i < head; i++){
+        int32_t value = ring.get(i);
+        if(value < minimum) minimum = value;
+        if(value > maximum) maximum = value;
+    }
+
+    int32_t newLow, newHigh;
+    scale(minimum, maximum, &newLow, &newHigh);
+    bool fits = (minimum >= low && maximum <= high);
+    bool tooLarge = (newHigh - newLow) * 2 <= (high - low);
+    bool rescale = !valid || !fits || tooLarge || (head - drawn) >= (uint32_t) w;
+
+    if(rescale){
+        low = newLow;
+        high = newHigh;
+        display.fillRect(x, y, w, h, background);
+        for(uint32_t i = first; i < head; i++){
+            drawColumn(display, ring, head, i);
+        }
+        upper.printf(display, "%d", (int) high);
+        lower.printf(display, "%d", (int) low);
+    } else {
+        display.scrollLeft(x, y, w, h, head - drawn, background);
+        for(uint32_t i = max(drawn, first); i < head; i++){
+            drawColumn(display, ring, head, i);
+        }
+    }
+
+    valid = true;
+    drawn = head;
+    return true;
+}
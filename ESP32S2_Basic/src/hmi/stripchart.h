@@ -0,0 +1,70 @@
+#pragma once
+
+#include <Arduino.h>
+#include "display.h"
+#include "widget.h"
+
+#define STRIPCHART_SAMPLES      256     // [#]    Ring buffer length, power of two and at least the plot width
+#define STRIPCHART_MARGIN       32      // [px]   Scale labels left of the plot
+#define STRIPCHART_DIVISIONS    4       // [#]    Scale steps over the plot height
+#define STRIPCHART_DOT_SPACING  4       // [px]   Dotted zero line
+
+/*
+ * Fixed ring of the last STRIPCHART_SAMPLES values. One task pushes, another
+ * one reads everything up to getHead(), which counts all pushed samples.
+ */
+class SampleRing {
+    public:
+        void push(int32_t value){
+            samples[head & (STRIPCHART_SAMPLES - 1)] = value;
+            head = head + 1;
+        }
+
+        uint32_t getHead() const {
+            return head;
+        }
+
+        /* Sample number sequence, valid for getHead() - STRIPCHART_SAMPLES <= sequence < getHead() */
+        int32_t get(uint32_t sequence) const {
+            return samples[sequence & (STRIPCHART_SAMPLES - 1)];
+        }
+
+    private:
+        int32_t samples[STRIPCHART_SAMPLES] = {};
+        volatile uint32_t head = 0;
+};
+
+/*
+ * Strip chart of a SampleRing, one column per sample with the newest one on
+ * the right. New samples scroll the plot in the frame buffer and only their
+ * columns are drawn. The scale snaps to 1-2-5 steps and grows as soon as a
+ * visible sample leaves it, but only shrinks once the data uses less than
+ * half of it. Only a scale change redraws the whole plot.
+ */
+class StripChart {
+    public:
+        StripChart(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, uint16_t background);
+
+        bool update(SharpDisplay& display, const SampleRing& ring);
+
+        /* Forces a full redraw on the next update, e.g. after the screen has been cleared */
+        void invalidate(){
+            valid = false;
+            upper.invalidate();
+            lower.invalidate();
+        }
+
+    private:
+        void scale(int32_t minimum, int32_t maximum, int32_t* low, int32_t* high) const;
+        int16_t toY(int32_t value) const;
+        void drawColumn(SharpDisplay& display, const SampleRing& ring, uint32_t head, uint32_t sequence);
+
+        const int16_t x, y, w, h;
+        const uint16_t color, background;
+        TextField upper, lower;
+
+        bool valid = false;
+        uint32_t drawn = 0;
+        int32_t low = 0;
+        int32_t high = 0;
+};
@@ -0,0 +1,132 @@
+#include "trackview.h"
+
+void TrackView::toScreen(const track_point_t& point, int16_t* sx, int16_t* sy) const {
+    *sx = x + w / 2 + (int64_t)(point.x - center.x) * TRACK_VIEW_BAR / bar;
+    *sy = y + h / 2 - (int64_t)(point.y - center.y) * TRACK_VIEW_BAR / bar;
+}
+
+bool TrackView::fits(const track_point_t& point) const {
+    int64_t dx = abs(point.x - center.x);
+    int64_t dy = abs(point.y - center.y);
+    return dx * TRACK_VIEW_BAR <= (int64_t)(w / 2 - TRACK_VIEW_MARGIN) * bar &&
+           dy * TRACK_VIEW_BAR <= (int64_t)(h / 2 - TRACK_VIEW_MARGIN) * bar;
+}
+
+/* Smallest 1-2-5 scale bar that fits all points around the center */
+void TrackView::rescale(const track_snapshot_t& track){
+    static const uint8_t mantissa[] = {1, 2, 5};
+    for(int32_t decade = 1; ; decade *= 10){
+        for(uint32_t i = 0; i < 3; i++){
+            bar = mantissa[i] * decade;
+            if(bar < TRACK_VIEW_MIN_BAR) continue;
+
+            bool all = true;
+            for(uint32_t j = 0; j < track.count && all; j++){
+                all = fits(track.points[j]);
+            }
+            if(all) return;
+        }
+    }
+}
+
+bool TrackView::update(SharpDisplay& display, const track_snapshot_t& track, float stationLat, float stationLon){
+    bool located = stationLat != 0 && stationLon != 0;
+
+    if(track.count == 0){
+        if(valid && generation == track.generation) return false;
+
+        display.fillRect(x, y, w, h, background);
+        display.setFont(NULL);
+        display.setTextColor(color, background);
+        display.setCursor(x + w / 2 - 24, y + h / 2 - 4);
+        display.print("No track");
+        valid = true;
+        generation = track.generation;
+        drawnHead = {0, 0};
+        return true;
+    }
+
+    track_point_t station = {0, 0};
+    if(located){
+        station.x = lroundf((stationLon - track.originLon) * track.metersPerLon);
+        station.y = lroundf((stationLat - track.originLat) * track.metersPerLat);
+    }
+
+    const track_point_t& newest = track.points[track.count - 1];
+    bool full = !valid || generation != track.generation || !fits(newest);
+    if(!full){
+        int16_t sx, sy;
+        toScreen(station, &sx, &sy);
+        full = abs(sx - stationX) > TRACK_VIEW_STATION_MOVE || abs(sy - stationY) > TRACK_VIEW_STATION_MOVE;
+    }
+
+    if(full){
+        center = station;
+        rescale(track);
+        redraw(display, track);
+        if(located) drawStation(display, stationX, stationY);
+        valid = true;
+        generation = track.generation;
+        return true;
+    }
+
+    if(newest.x == drawnHead.x && newest.y == drawnHead.y) return false;
+
+    // Only the new segment, the older ones are already in the frame buffer
+    int16_t sx, sy;
+    toScreen(newest, &sx, &sy);
+    display.drawLine(headX, headY, sx, sy, color);
+    headX = sx;
+    headY = sy;
+    drawnHead = newest;
+    return true;
+}
+
+void TrackView::redraw(SharpDisplay& display, const track_snapshot_t& track){
+    display.fillRect(x, y, w, h, background);
+
+    int16_t x0, y0;
+    toScreen(track.points[0], &x0, &y0);
+    for(uint32_t i = 1; i < track.count; i++){
+        int16_t x1, y1;
+        toScreen(track.points[i], &x1, &y1);
+        display.drawLine(x0, y0, x1, y1, color);
+        x0 = x1;
+        y0 = y1;
+    }
+    headX = x0;
+    headY = y0;
+    drawnHead = track.points[track.count - 1];
+    toScreen(center, &stationX, &stationY);
+
+    int16_t launchX, launchY;
+    toScreen(track.points[0], &launchX, &launchY);
+    drawLaunch(display, launchX, launchY);
+
+    // Scale bar in the lower left and the north mark in the upper right corner
+    int16_t barY = y + h - 6;
+    display.drawFastHLine(x + 6, barY, TRACK_VIEW_BAR, color);
+    display.drawFastVLine(x + 6, barY - 3, 4, color);
+    display.drawFastVLine(x + 6 + TRACK_VIEW_BAR - 1, barY - 3, 4, color);
+    display.setFont(NULL);
+    display.setTextColor(color, background);
+    display.setCursor(x + 6, barY - 13);
+    if(bar >= 1000 && bar % 1000 == 0){
+        display.printf("%d km", bar / 1000);
+    } else {
+        display.printf("%d m", bar);
+    }
+    display.setCursor(x + w - 12, y + 4);
+    display.print("N");
+    display.drawFastVLine(x + w - 10, y + 14, 8, color);
+}
+
+void TrackView::drawStation(SharpDisplay& display, int16_t sx, int16_t sy){
+    display.fillRect(sx - 6, sy - 6, 13, 13, background);
+    display.drawRect(sx - 4, sy - 4, 9, 9, color);
+    display.fillRect(sx - 1, sy - 1, 3, 3, color);
+}
+
+void TrackView::drawLaunch(SharpDisplay& display, int16_t sx, int16_t sy){
+    display.fillTriangle(sx, sy - 5, sx - 4, sy + 3, sx + 4, sy + 3, color);
+}
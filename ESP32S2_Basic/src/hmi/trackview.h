@@ -0,0 +1,53 @@
+#pragma once
+
+#include <Arduino.h>
+#include "display.h"
+#include "groundtrack.h"
+
+#define TRACK_VIEW_BAR          50      // [px]   Scale bar, its length in m snaps to 1-2-5 steps
+#define TRACK_VIEW_MIN_BAR      20      // [m]
+#define TRACK_VIEW_MARGIN       10      // [px]   Points closer to the border rescale the view
+#define TRACK_VIEW_STATION_MOVE 4       // [px]   Station movement that recenters the view
+
+/*
+ * Ground track of a rocket around the station, north up. The view is
+ * centered on the station and scaled to fit the whole track. New positions
+ * only draw the segment from the last drawn position, so the simplification
+ * of older points never touches the screen. The whole view is redrawn from
+ * the simplified track if the newest position leaves the scale, the track
+ * starts over or the station moved.
+ */
+class TrackView {
+    public:
+        TrackView(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, uint16_t background) :
+            x(x), y(y), w(w), h(h), color(color), background(background) {}
+
+        /* stationLat and stationLon are 0 if the station is not located, the view is centered on the launch point then */
+        bool update(SharpDisplay& display, const track_snapshot_t& track, float stationLat, float stationLon);
+
+        /* Forces a full redraw on the next update, e.g. after the screen has been cleared */
+        void invalidate(){
+            valid = false;
+        }
+
+    private:
+        bool fits(const track_point_t& point) const;
+        void toScreen(const track_point_t& point, int16_t* sx, int16_t* sy) const;
+        void rescale(const track_snapshot_t& track);
+        void redraw(SharpDisplay& display, const track_snapshot_t& track);
+        void drawStation(SharpDisplay& display, int16_t sx, int16_t sy);
+        void drawLaunch(SharpDisplay& display, int16_t sx, int16_t sy);
+
+        const int16_t x, y, w, h;
+        const uint16_t color, background;
+
+        bool valid = false;
+        uint32_t generation = 0;
+        track_point_t center = {0, 0};  // [m]    Station in the frame of the track
+        int32_t bar = TRACK_VIEW_MIN_BAR;   // [m]    Length of the scale bar
+        track_point_t drawnHead = {0, 0};
+        int16_t headX = 0;
+        int16_t headY = 0;
+        int16_t stationX = 0;
+        int16_t stationY = 0;
+};
@@ -0,0 +1,40 @@
+#include "widget.h"
+
+bool TextField::set(SharpDisplay& display, const char* newText){
+    if(valid && strncmp(text, newText, WIDGET_TEXT_LENGTH - 1) == 0) return false;
+
+    strncpy(text, newText, WIDGET_TEXT_LENGTH - 1);
+    valid = true;
+
+    display.fillRect(x, y, w, h, background);
+    display.setFont(font);
+    display.setTextSize(1);
+    display.setTextColor(color);
+
+    int16_t cursor = x;
+    if(align == ALIGN_CENTER){
+        cursor = x + w / 2 - display.textWidth(text) / 2;
+    }
+    display.setCursor(cursor, baseline);
+    display.print(text);
+    return true;
+}
+
+bool TextField::printf(SharpDisplay& display, const char* format, ...){
+    char buffer[WIDGET_TEXT_LENGTH];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    return set(display, buffer);
+}
+
+bool IconField::set(SharpDisplay& display, icon_e newIcon){
+    if(valid && icon == newIcon) return false;
+
+    icon = newIcon;
+    valid = true;
+    display.fillRect(x, y, w, h, background);
+    display.drawIcon(x, y, icon, color);
+    return true;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include "display.h"
+
+#define WIDGET_TEXT_LENGTH 24
+
+typedef enum {
+    ALIGN_LEFT = 0,
+    ALIGN_CENTER = 1,
+} widget_align_e;
+
+/*
+ * Text with a fixed bounding box. The last rendered text is cached, a new
+ * value only clears the own box and is drawn once, and only if the text
+ * actually changed. The box must cover the ascent and descent of the font.
+ */
+class TextField {
+    public:
+        TextField(int16_t x, int16_t y, int16_t w, int16_t h, int16_t baseline, const GFXfont* font,
+                  uint16_t color, uint16_t background, widget_align_e align = ALIGN_LEFT) :
+            x(x), y(y), w(w), h(h), baseline(baseline), font(font), color(color), background(background), align(align) {}
+
+        bool set(SharpDisplay& display, const char* text);
+        bool printf(SharpDisplay& display, const char* format, ...) __attribute__ ((format (printf, 3, 4)));
+
+        /* Forces a redraw on the next set, e.g. after the screen has been cleared */
+        void invalidate(){
+            valid = false;
+        }
+
+    private:
+        const int16_t x, y, w, h;
+        const int16_t baseline;
+        const GFXfont* font;
+        const uint16_t color, background;
+        const widget_align_e align;
+
+        bool valid = false;
+        char text[WIDGET_TEXT_LENGTH] = {};
+};
+
+/*
+ * Icon with a fixed box, redrawn only if a different icon is set.
+ * ICON_COUNT leaves the box empty.
+ */
+class IconField {
+    public:
+        IconField(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, uint16_t background) :
+            x(x), y(y), w(w), h(h), color(color), background(background) {}
+
+        bool set(SharpDisplay& display, icon_e icon);
+
+        void invalidate(){
+            valid = false;
+        }
+
+    private:
+        const int16_t x, y, w, h;
+        const uint16_t color, background;
+
+        bool valid = false;
+        icon_e icon = ICON_COUNT;
+};
@@ -1,4 +1,4 @@
-#include "bmp.h"
+#include "icons.h"
 #include "window.h"
 #include <TimeLib.h>
 #include <Fonts/FreeSansBold9pt7b.h>
@@ -7,38 +7,72 @@
 #include <Fonts/FreeSans12pt7b.h>
 #include <Fonts/FreeSans18pt7b.h>
 
+static GlyphCache glyphs9pt(&FreeSans9pt7b);
+static GlyphCache glyphs12pt(&FreeSans12pt7b);
+
 
 void Window::begin(){
-    display.begin();
+#ifdef SHARPMEM_DMA_SUPPORTED
+    if(!display.beginDMA())
+#endif
+    {
+        display.begin();            // Fall back to the blocking bit-banged SPI
+    }
+#if WINDOW_SHADOW_FRAME
+    display.setShadowFrame(true);
+#endif
     display.clearDisplay();
     display.setRotation(0);
+
+    if(glyphs9pt.begin()) display.addGlyphCache(&glyphs9pt);
+    if(glyphs12pt.begin()) display.addGlyphCache(&glyphs12pt);
+
+    mapView.begin();
+}
+
+/* Sends the frame if something changed, at most WINDOW_MAX_FRAME_RATE times per second unless forced */
+bool Window::flush(bool force){
+    uint32_t now = millis();
+    bool sent = false;
+    bool due = (now - lastFlush) >= (1000 / WINDOW_MAX_FRAME_RATE);
+    bool vcom = (now - lastFlush) >= WINDOW_VCOM_INTERVAL;       // The panel needs a periodic VCOM toggle even without changes
+
+    if(((force || due) && display.needsRefresh()) || vcom){
+        lastFlush = now;
+        display.refreshAsync();
+        frameCount++;
+        spiTime += display.getRefreshTime();        // Previous frame, refreshAsync waits for it to complete
+        spiBytes += display.getRefreshBytes();
+        sent = true;
+    }
+
+    if(now - statsStart >= 1000){
+        statsStart = now;
+        frameRate = frameCount;
+        spiTimePerSecond = spiTime;
+        spiBytesPerSecond = spiBytes;
+        frameCount = spiTime = spiBytes = 0;
+    }
+    return sent;
 }
 
 void Window::logo(){
-    display.drawBitmap(140,20, cats_logo, 120, 200, BLACK);
-    display.refresh();
+    display.drawIcon(140, 20, ICON_CATS_LOGO, BLACK);
 }
 
 void Window::drawCentreString(const char *buf, int x, int y){
-    int16_t x1, y1;
-    uint16_t w, h;
-    display.getTextBounds(buf, 0, y, &x1, &y1, &w, &h); //calc width of new string
-    display.setCursor(x - w / 2, y);
+    display.setCursor(x - display.textWidth(buf) / 2, y);
     display.print(buf);
 }
 
 void Window::drawCentreString(String& buf, int x, int y) {
-    int16_t x1, y1;
-    uint16_t w, h;
-    display.getTextBounds(buf, 0, y, &x1, &y1, &w, &h); //calc width of new string
-    display.setCursor(x - w / 2, y);
-    display.print(buf);
+    drawCentreString(buf.c_str(), x, y);
 }
 
 void Window::initBar(){
     // Memory
     display.setFont(NULL);
-    display.drawBitmap(5,1, bar_memory, 16, 16, BLACK);
+    display.drawIcon(5, 1, ICON_BAR_MEMORY, BLACK);
     display.setTextColor(BLACK);
     display.setTextSize(2);
     display.setCursor((5+16+5),2);
@@ -64,15 +98,15 @@ void Window::updateBar(float batteryVoltage, bool usb, bool logging, bool locati
 
     // Logging
     if(logging != oldLoggingStatus){
-        display.drawBitmap(65,1, bar_download, 16, 16, !logging);
+        display.drawIcon(65, 1, ICON_BAR_DOWNLOAD, !logging);
     }
     if(logging){
-        display.drawBitmap(65,1, bar_download, 16, 16, blinkStatus);
+        display.drawIcon(65, 1, ICON_BAR_DOWNLOAD, blinkStatus);
     }
 
     //Location
     if(location != oldLocationStatus){
-        display.drawBitmap(329,1, bar_location, 16, 16, !location);
+        display.drawIcon(329, 1, ICON_BAR_LOCATION, !location);
     }
     
 
@@ -109,7 +143,7 @@ void Window::updateBar(float batteryVoltage, bool usb, bool logging, bool locati
         display.fillRect(380,5,6,8,WHITE);
         display.fillRect(387,5,6,8,WHITE);
 
-        display.drawBitmap(376,1, bar_flash, 16, 16, !usb);
+        display.drawIcon(376, 1, ICON_BAR_FLASH, !usb);
     } 
 
     // Battery
@@ -137,7 +171,6 @@ void Window::updateBar(float batteryVoltage, bool usb, bool logging, bool locati
 
     blinkStatus = !blinkStatus;
     
-    display.refresh();
 }
 
 void Window::initMenu(uint32_t index){
@@ -155,27 +188,26 @@ void Window::initMenu(uint32_t index){
     drawCentreString("Sensors", 200, 233);
     drawCentreString("Settings", 325, 233);
 
-    display.drawBitmap(43,38, menu_live, 64, 64, BLACK);
+    display.drawIcon(43, 38, ICON_MENU_LIVE, BLACK);
     display.drawRoundRect(35,30,80,80,9,BLACK);
 
-    display.drawBitmap(43,143, menu_data, 64, 64, BLACK);
+    display.drawIcon(43, 143, ICON_MENU_DATA, BLACK);
     display.drawRoundRect(35,135,80,80,9,BLACK);
   
-    display.drawBitmap(168,38, menu_recover, 64, 64, BLACK);
+    display.drawIcon(168, 38, ICON_MENU_RECOVER, BLACK);
     display.drawRoundRect(160,30,80,80,10,BLACK);
 
-    display.drawBitmap(168,143, menu_sensors, 64, 64, BLACK);
+    display.drawIcon(168, 143, ICON_MENU_SENSORS, BLACK);
     display.drawRoundRect(160,135,80,80,10,BLACK);
   
-    display.drawBitmap(293,38, menu_testing, 64, 64, BLACK);
+    display.drawIcon(293, 38, ICON_MENU_TESTING, BLACK);
     display.drawRoundRect(285,30,80,80,10,BLACK);
 
-    display.drawBitmap(293,143, menu_settings, 64, 64, BLACK);
+    display.drawIcon(293, 143, ICON_MENU_SETTINGS, BLACK);
     display.drawRoundRect(285,135,80,80,10,BLACK);
     updateMenu(index);
 
   
-    display.refresh();
 }
 
 void Window::updateMenu(uint32_t index){
@@ -192,11 +224,81 @@ void Window::updateMenu(uint32_t index){
     yPos = (index / 3) * 105 + 31;
     display.drawRoundRect(xPos,yPos,78,78,9,BLACK);
 
-    display.refresh();
 
     oldHighlight = index;
 }
 
+LiveFields::LiveFields(int16_t xOffset) :
+    state(xOffset + 2, 25, 196, 20, 42, &FreeSans12pt7b, BLACK, WHITE, ALIGN_CENTER),
+    altitude(xOffset + 35, 53, 163, 20, 70, &FreeSans12pt7b, BLACK, WHITE),
+    velocity(xOffset + 35, 78, 163, 20, 95, &FreeSans12pt7b, BLACK, WHITE),
+    lat(xOffset + 35, 103, 163, 20, 120, &FreeSans12pt7b, BLACK, WHITE),
+    lon(xOffset + 35, 128, 163, 20, 145, &FreeSans12pt7b, BLACK, WHITE),
+    voltage(xOffset + 35, 153, 85, 20, 170, &FreeSans12pt7b, BLACK, WHITE),
+    error(xOffset + 35, 178, 163, 22, 192, &FreeSans9pt7b, BLACK, WHITE),
+    age(xOffset + 50, 205, 50, 15, 217, &FreeSans9pt7b, WHITE, BLACK),
+    snr(xOffset + 145, 205, 54, 15, 217, &FreeSans9pt7b, WHITE, BLACK),
+    lq(xOffset + 50, 225, 50, 15, 237, &FreeSans9pt7b, WHITE, BLACK),
+    rssi(xOffset + 145, 225, 54, 15, 237, &FreeSans9pt7b, WHITE, BLACK),
+    pyro1(xOffset + 142, 156, 16, 16, BLACK, WHITE),
+    pyro2(xOffset + 180, 156, 16, 16, BLACK, WHITE),
+    altitudeChart(xOffset + 1, 52, 198, 72, BLACK, WHITE),
+    velocityChart(xOffset + 1, 127, 198, 72, BLACK, WHITE) {}
+
+RecoveryFields::RecoveryFields() :
+    rocketLat(70, 33, 120, 20, 50, &FreeSans12pt7b, BLACK, WHITE),
+    rocketLon(70, 58, 120, 20, 75, &FreeSans12pt7b, BLACK, WHITE),
+    homeLat(70, 93, 120, 20, 110, &FreeSans12pt7b, BLACK, WHITE),
+    homeLon(70, 118, 120, 20, 135, &FreeSans12pt7b, BLACK, WHITE),
+    distance(70, 153, 120, 20, 170, &FreeSans12pt7b, BLACK, WHITE),
+    targets{TextField(5, 186, 210, 19, 200, &FreeSans9pt7b, BLACK, WHITE), TextField(5, 208, 210, 19, 222, &FreeSans9pt7b, BLACK, WHITE)},
+    compass(300, 125, 80, &FreeSans9pt7b, BLACK, WHITE) {}
+
+#define SENSOR_FIELD(x, baseline) TextField(x, (baseline) - 14, 85, 19, baseline, &FreeSans9pt7b, BLACK, WHITE)
+
+SensorFields::SensorFields() :
+    acceleration{SENSOR_FIELD(120, 92), SENSOR_FIELD(215, 92), SENSOR_FIELD(310, 92)},
+    gyroscope{SENSOR_FIELD(120, 114), SENSOR_FIELD(215, 114), SENSOR_FIELD(310, 114)},
+    magnetometer{SENSOR_FIELD(120, 136), SENSOR_FIELD(215, 136), SENSOR_FIELD(310, 136)},
+    attitude{SENSOR_FIELD(120, 158), SENSOR_FIELD(215, 158), SENSOR_FIELD(310, 158)},
+    rate(SENSOR_FIELD(120, 188)),
+    imuErrors(SENSOR_FIELD(120, 210)),
+    compassErrors(SENSOR_FIELD(120, 232)),
+    field(SENSOR_FIELD(310, 188)),
+    spread(SENSOR_FIELD(310, 210)),
+    quality(SENSOR_FIELD(310, 232)) {}
+
+void Window::drawLiveIcons(uint32_t index){
+    int xOffset = index * 200;
+
+    display.drawIcon(xOffset + 5, 50, ICON_LIVE_ALTITUDE, BLACK);
+    display.drawIcon(xOffset + 5, 75, ICON_LIVE_SPEED, BLACK);
+    display.drawIcon(xOffset + 5, 100, ICON_LIVE_LAT, BLACK);
+    display.drawIcon(xOffset + 5, 125, ICON_LIVE_LON, BLACK);
+    display.drawIcon(xOffset + 3, 150, ICON_LIVE_BATTERY, BLACK);
+
+    display.drawIcon(xOffset + 120, 149, ICON_LIVE_ONE, BLACK);
+    display.drawIcon(xOffset + 158, 149, ICON_LIVE_TWO, BLACK);
+}
+
+/* Value view with icons or the strip charts, the fields redraw on the next update */
+void Window::drawLiveBody(uint32_t index){
+    int xOffset = index * 200;
+    LiveFields& fields = live[index];
+
+    display.fillRect(xOffset+1, 50, 198, 151, WHITE);
+    if(liveCharts){
+        display.drawIcon(xOffset + 5, 76, ICON_LIVE_ALTITUDE, BLACK);
+        display.drawIcon(xOffset + 5, 151, ICON_LIVE_SPEED, BLACK);
+        display.drawFastHLine(xOffset + 1, 125, 198, BLACK);
+        fields.altitudeChart.invalidate();
+        fields.velocityChart.invalidate();
+    } else {
+        drawLiveIcons(index);
+        fields.invalidateData();
+    }
+}
+
 void Window::initLive(){
     display.fillRect(0,19,400,222, WHITE);
 
@@ -206,23 +308,8 @@ void Window::initLive(){
 
     display.drawLine(0,49,400,49, BLACK);
 
-    display.drawBitmap(5, 50, live_altitude, 24, 24, BLACK);
-    display.drawBitmap(5, 75, live_speed, 24, 24, BLACK);
-    display.drawBitmap(5, 100, live_lat, 24, 24, BLACK);
-    display.drawBitmap(5, 125, live_lon, 24, 24, BLACK);
-    display.drawBitmap(3, 150, live_battery, 24, 24, BLACK);
-
-    display.drawBitmap(120, 149, live_one, 24, 24, BLACK);
-    display.drawBitmap(158, 149, live_two, 24, 24, BLACK);
-
-    display.drawBitmap(320, 149, live_one, 24, 24, BLACK);
-    display.drawBitmap(358, 149, live_two, 24, 24, BLACK);
-
-    display.drawBitmap(205, 50, live_altitude, 24, 24, BLACK);
-    display.drawBitmap(205, 75, live_speed, 24, 24, BLACK);
-    display.drawBitmap(205, 100, live_lat, 24, 24, BLACK);
-    display.drawBitmap(205, 125, live_lon, 24, 24, BLACK);
-    display.drawBitmap(203, 150, live_battery, 24, 24, BLACK);
+    drawLiveBody(0);
+    drawLiveBody(1);
 
 
     display.setFont(&FreeSans9pt7b);
@@ -230,8 +317,12 @@ void Window::initLive(){
     display.fillRect(0,202,399,240,BLACK);
     display.setTextColor(WHITE);
 
-    connected[0] = false;
-    connected[1] = false;
+    for(uint32_t i = 0; i < 2; i++){
+        connected[i] = false;
+        testingShown[i] = false;
+        live[i].invalidateData();
+        live[i].invalidateInfo();
+    }
 
     display.setCursor(245, 227);
     display.print("Disconnected");
@@ -241,43 +332,63 @@ void Window::initLive(){
 
     display.setTextColor(BLACK);
     display.setFont(NULL);
-    display.refresh();
 }
 
 void Window::updateLive(TelemetryInfo* info, uint32_t index){
     if(index > 1) return;
 
+    uint32_t start = micros();
+
     // Read some random data to reset the updated flag
     info->lq();
 
-    updateLiveInfo(&infoData[index], index, BLACK);
-
     memcpy(&infoData[index], info, sizeof(infoData[0]));
     dataAge[index] = millis() - lastTeleData[index];
-    updateLiveInfo(&infoData[index], index, WHITE);
+    updateLiveInfo(&infoData[index], index);
+
+    liveRenderTime = micros() - start;
 }
 
 void Window::updateLive(TelemetryData* data, TelemetryInfo* info, uint32_t index){
     if(index > 1) return;
 
+    uint32_t start = micros();
+
     lastTeleData[index] = millis();
 
     // Read some random data to reset the updated flag
     data->state();
     info->lq();
 
-    updateLiveData(&teleData[index], index, WHITE);
-    updateLiveInfo(&infoData[index], index, BLACK);
-
-    //display.fillRect(10,19,190,200, WHITE);
-
     memcpy(&teleData[index], data, sizeof(teleData[0]));
     memcpy(&infoData[index], info, sizeof(infoData[0]));
     
     dataAge[index] = 0;
 
-    updateLiveData(&teleData[index], index, BLACK);
-    updateLiveInfo(&infoData[index], index, WHITE);
+    updateLiveData(&teleData[index], index);
+    updateLiveInfo(&infoData[index], index);
+
+    liveRenderTime = micros() - start;
+}
+
+void Window::setLiveView(bool charts){
+    if(charts == liveCharts) return;
+    liveCharts = charts;
+
+    for(uint32_t i = 0; i < 2; i++){
+        if(testingShown[i]) continue;
+        drawLiveBody(i);
+        if(!liveCharts && lastTeleData[i]){
+            updateLiveData(&teleData[i], i);        // Last values instead of empty fields until the next packet
+        }
+    }
+}
+
+void Window::updateLiveCharts(uint32_t index, const SampleRing& altitude, const SampleRing& velocity){
+    if(index > 1 || !liveCharts || testingShown[index]) return;
+
+    live[index].altitudeChart.update(display, altitude);
+    live[index].velocityChart.update(display, velocity);
 }
 
 const char* const stateName [] = {
@@ -288,204 +399,198 @@ const char* const errorName [] = {
     "No Config", "Log Full", "Filter Error", "Overheating", "Continuity Error" 
 };
 
-void Window::updateLiveData(TelemetryData* data, uint32_t index, uint32_t color){
+void Window::updateLiveData(TelemetryData* data, uint32_t index){
 
     int xOffset = index * 200;
-
-    display.setFont(&FreeSans12pt7b);
-    display.setTextSize(1);
-    display.setTextColor(color);
+    LiveFields& fields = live[index];
 
     if(data->testingMode()) {
-        drawCentreString("TESTING", xOffset+100, 42);
-        display.fillRect(xOffset+1, 50, 198, 151, WHITE);
-        display.setCursor(xOffset + 20,80);
-        display.print("DO NOT FLY!");
+        fields.state.set(display, "TESTING");
+        if(!testingShown[index]){
+            testingShown[index] = true;
+            display.fillRect(xOffset+1, 50, 198, 151, WHITE);
+            display.setFont(&FreeSans12pt7b);
+            display.setTextSize(1);
+            display.setTextColor(BLACK);
+            display.setCursor(xOffset + 20,80);
+            display.print("DO NOT FLY!");
+            display.setFont(NULL);
+        }
         return;
-    } else {
-        drawCentreString(stateName[data->state()], xOffset+100, 42);
     }
 
-    display.setCursor(xOffset + 35,70);
-    display.print(data->altitude());
-    display.print(" m");
-
-    display.setCursor(xOffset + 35,95);
-    display.print(data->velocity());
-    display.print(" m/s");
-
-    display.setCursor(xOffset + 35,120);
-    display.print(data->lat(), 4);
-    display.print(" N");
-
-    display.setCursor(xOffset + 35,145);
-    display.print(data->lon(), 4);
-    display.print(" E");
-
-    display.setCursor(xOffset + 35,170);
-    display.print(data->voltage());
-    display.print(" V");
-
-    if(data->pyroContinuity() & 0x01){
-        display.drawBitmap(xOffset + 142, 156, live_checkmark, 16, 16, color);
-    } else {
-        display.drawBitmap(xOffset + 142, 156, live_cross, 16, 16, color);
+    if(testingShown[index]){
+        testingShown[index] = false;
+        drawLiveBody(index);
     }
 
-    if(data->pyroContinuity() & 0x02){
-        display.drawBitmap(xOffset + 180, 156, live_checkmark, 16, 16, color);
-    } else {
-        display.drawBitmap(xOffset + 180, 156, live_cross, 16, 16, color);
+    fields.state.set(display, stateName[data->state()]);
+    if(liveCharts){
+        display.setFont(NULL);
+        return;
     }
-    
-    display.setFont(&FreeSans9pt7b);
-    display.setCursor(xOffset + 35,192);
-    
+    fields.altitude.printf(display, "%d m", (int) data->altitude());
+    fields.velocity.printf(display, "%d m/s", data->velocity());
+    fields.lat.printf(display, "%.4f N", data->lat());
+    fields.lon.printf(display, "%.4f E", data->lon());
+    fields.voltage.printf(display, "%.2f V", data->voltage());
+
+    fields.pyro1.set(display, (data->pyroContinuity() & 0x01) ? ICON_LIVE_CHECKMARK : ICON_LIVE_CROSS);
+    fields.pyro2.set(display, (data->pyroContinuity() & 0x02) ? ICON_LIVE_CHECKMARK : ICON_LIVE_CROSS);
 
+    const char* error = "";
     if(data->errors() & 0x04) {
-        display.print(errorName[2]);
+        error = errorName[2];
     } else if (data->errors() & 0x10) {
-        display.print(errorName[4]);
+        error = errorName[4];
     } else if (data->errors() & 0x02) {
-        display.print(errorName[1]);
+        error = errorName[1];
     } else if (data->errors() & 0x01) {
-        display.print(errorName[0]);
+        error = errorName[0];
     } else if (data->errors() & 0x08) {
-        display.print(errorName[3]);
+        error = errorName[3];
     }
+    fields.error.set(display, error);
 
-    display.setFont(&FreeSans9pt7b);
-    display.setTextSize(1);
-    display.setTextColor(!color);
+    display.setFont(NULL);
 }
 
-void Window::updateLiveInfo(TelemetryInfo* info, uint32_t index, uint32_t color){
+void Window::updateLiveInfo(TelemetryInfo* info, uint32_t index){
 
     int xOffset = index * 200;
+    LiveFields& fields = live[index];
 
     display.setFont(&FreeSans9pt7b);
     display.setTextSize(1);
-    display.setTextColor(color);
+    display.setTextColor(WHITE);
 
     if(dataAge[index] > 4900){
-        if(color == WHITE){
+        if(connected[index]){
             connected[index] = false;
             display.fillRect(xOffset+0,202,199,240,BLACK);
             display.setCursor(xOffset+45, 227);
             display.print("Disconnected");
-            info->lq();
         }
     } else {
         if(connected[index] == false){
-            if(color == WHITE){
-                display.fillRect(xOffset+0,202,199,240,BLACK);
-                connected[index] = true;
-                display.setCursor(xOffset+5,217);
-                display.print("AGE");
-                display.setCursor(xOffset+100,217);
-                display.print("SNR");
-                display.setCursor(xOffset+5, 237);
-                display.print("LQ");
-                display.setCursor(xOffset+100, 237);
-                display.print("RSSI");
-            }
+            display.fillRect(xOffset+0,202,199,240,BLACK);
+            connected[index] = true;
+            display.setCursor(xOffset+5,217);
+            display.print("AGE");
+            display.setCursor(xOffset+100,217);
+            display.print("SNR");
+            display.setCursor(xOffset+5, 237);
+            display.print("LQ");
+            display.setCursor(xOffset+100, 237);
+            display.print("RSSI");
+            fields.invalidateInfo();
         }
-        display.setCursor(xOffset+50,217);
-        display.print((float)dataAge[index]/1000.0f,1);
-        display.setCursor(xOffset+145,217);
-        display.print(info->snr());
-        display.setCursor(xOffset+50, 237);
-        display.print(info->lq());
-        display.setCursor(xOffset+145, 237);
-        display.print(info->rssi());
+        fields.age.printf(display, "%.1f", (float)dataAge[index]/1000.0f);
+        fields.snr.printf(display, "%d", info->snr());
+        fields.lq.printf(display, "%d", info->lq());
+        fields.rssi.printf(display, "%d", info->rssi());
     }
 
-    
+    display.setTextColor(BLACK);
+    display.setFont(NULL);
 }
 
 void Window::initRecovery(){
     display.fillRect(0,19,400,222, WHITE);
-    
-    display.drawCircle(300, 125, 80, BLACK);
 
-    display.drawBitmap(5,40,rocket_recovery,32,32,BLACK);
-
-    display.drawBitmap(40, 30, live_lat, 24, 24, BLACK);
-    display.drawBitmap(40, 55, live_lon, 24, 24, BLACK);
-
-    display.drawBitmap(5, 100,house_recovery,32,32,BLACK);
-    display.drawBitmap(40, 90, live_lat, 24, 24, BLACK);
-    display.drawBitmap(40, 115, live_lon, 24, 24, BLACK);
-
-    display.refresh();
-}
-
-void Window::updateRecovery(Navigation* navigation){
-    display.fillRect(60,19,400,222, WHITE);
-    
-    float angle = navigation->getNorth();
+    if(recoveryView == RECOVERY_MAP){
+        mapView.follow();
+        return;
+    }
+    if(recoveryView == RECOVERY_TRACK){
+        trackView.invalidate();
+        return;
+    }
     
-    display.setFont(&FreeSans12pt7b);
-    display.setTextSize(1);
+    display.drawIcon(5, 40, ICON_ROCKET_RECOVERY, BLACK);
 
-    display.setCursor(70, 50);
-    display.print(navigation->getPointB().lat, 4);
+    display.drawIcon(40, 30, ICON_LIVE_LAT, BLACK);
+    display.drawIcon(40, 55, ICON_LIVE_LON, BLACK);
 
-    display.setCursor(70, 75);
-    display.print(navigation->getPointB().lon, 4);
+    display.drawIcon(5, 100, ICON_HOUSE_RECOVERY, BLACK);
+    display.drawIcon(40, 90, ICON_LIVE_LAT, BLACK);
+    display.drawIcon(40, 115, ICON_LIVE_LON, BLACK);
 
-    
-    display.setCursor(70, 110);
-    display.print(navigation->getPointA().lat, 4);
-
-    display.setCursor(70, 135);
-    display.print(navigation->getPointA().lon, 4);
-
-    display.setCursor(70, 170);
-    display.print(navigation->getDistance());
-    display.print("m");
+    recovery.invalidate();
+}
 
+void Window::updateRecovery(const recovery_snapshot_t& snapshot){
+    const navigation_target_t* targets = snapshot.targets;
+    uint32_t count = snapshot.count;
+    uint32_t selected = snapshot.selected;
+    const navigation_target_t& rocket = targets[selected];
+    const EarthPoint3D& home = snapshot.station;
 
-    display.setFont(&FreeSans9pt7b);
+    if(recoveryView == RECOVERY_TRACK){
+        trackView.update(display, snapshot.track, home.lat, home.lon);
+        return;
+    }
 
-    float radius = 90;
-    float correctionFactor = 0.06;
-    
-    int x = radius * cos(angle - PI/2);
-    int y = radius * sin(angle - PI/2) + 125;
-    drawCentreString("N", x+300, y + correctionFactor*y);
+    if(recoveryView == RECOVERY_MAP){
+        map_marker_t markers[NAVIGATION_MAX_TARGETS + 1];
+        markers[0] = {home.lat, home.lon, MAP_MARKER_STATION, home.lat && home.lon};
+        for(uint32_t i = 0; i < count; i++){
+            map_marker_e type = (i == selected) ? MAP_MARKER_ROCKET : MAP_MARKER_TARGET;
+            markers[i + 1] = {targets[i].lat, targets[i].lon, type, targets[i].valid};
+        }
+        mapView.update(display, markers, count + 1);
+        return;
+    }
 
-    x = radius * cos(angle);
-    y = radius * sin(angle) +125;
-    drawCentreString("E", x+300, y + correctionFactor*y);
+    if(rocket.valid){
+        recovery.rocketLat.printf(display, "%.4f", rocket.lat);
+        recovery.rocketLon.printf(display, "%.4f", rocket.lon);
+    } else {
+        recovery.rocketLat.set(display, "");
+        recovery.rocketLon.set(display, "");
+    }
+    recovery.homeLat.printf(display, "%.4f", home.lat);
+    recovery.homeLon.printf(display, "%.4f", home.lon);
+    if(rocket.solved){
+        recovery.distance.printf(display, "%.2fm", rocket.distance);
+    } else {
+        recovery.distance.set(display, "");
+    }
 
-    x = radius * cos(angle + PI/2);
-    y = radius * sin(angle + PI/2) +125;
-    drawCentreString("S", x+300, y + correctionFactor*y);
+    // One line per target, the selected one is marked
+    for(uint32_t i = 0; i < NAVIGATION_MAX_TARGETS; i++){
+        char mark = (i == selected) ? '>' : ' ';
+        if(i >= count){
+            recovery.targets[i].set(display, "");
+        } else if(!targets[i].solved){
+            recovery.targets[i].printf(display, "%c%u No fix", mark, i + 1);
+        } else {
+            int azimuth = lroundf(targets[i].azimuth * (180 / PI) + 360) % 360;
+            int elevation = lroundf(targets[i].elevation * (180 / PI));
+            recovery.targets[i].printf(display, "%c%u %.0fm Az %d El %d", mark, i + 1, targets[i].distance, azimuth, elevation);
+        }
+    }
 
-    x = radius * cos(angle + PI);
-    y = radius * sin(angle + PI) +125;
-    drawCentreString("W", x+300, y + correctionFactor*y);
+    compass_marker_e marker = COMPASS_NONE;
+    if(rocket.solved){
+        marker = (rocket.distance > 20) ? COMPASS_ARROW : COMPASS_CIRCLE;
+    }
+    recovery.compass.update(display, snapshot.north, rocket.azimuth, marker);
+}
 
-    angle = navigation->getAzimuth() + angle - PI/2;
+void Window::setRecoveryView(recovery_view_e view){
+    if(view == recoveryView) return;
+    recoveryView = view;
+    initRecovery();
+}
 
-    x = 70 * cos(angle) + 300;
-    y = 70 * sin(angle) + 125;
-    int x1 = 30 * cos(angle + 0.2) + 300;
-    int y1 = 30 * sin(angle + 0.2) + 125;
-    int x2 = 30 * cos(angle - 0.2) + 300;
-    int y2 = 30 * sin(angle - 0.2) + 125;
+void Window::selectRecoveryTarget(uint32_t){       // The target comes with the next snapshot
+    mapView.invalidate();
+    trackView.invalidate();
+}
 
-    display.drawCircle(300, 125, 80, BLACK);
-    
-    if(navigation->getDistance() > 20){
-        display.fillTriangle(x,y,x1,y1,x2,y2,BLACK);
-    } else {
-        display.drawCircle(300,125,6,BLACK);
-    }
-    
-    
-    display.refresh();
+void Window::controlMap(map_control_e command){
+    mapView.control(command);
 }
 
 void Window::initBox(const char* text){
@@ -506,10 +611,9 @@ void Window::initBox(const char* text){
     display.setCursor(255, 160);
     display.print("OK (A)");
 
-    display.refresh();
 }
 
-void Window::initTestingBox(uint32_t index){
+void Window::initTestingBox(uint32_t){          // The same box for every event
     display.fillRect(60,60,280,120, WHITE);
     display.drawRect(60,60,280,120, BLACK);
 
@@ -527,7 +631,6 @@ void Window::initTestingBox(uint32_t index){
     display.setCursor(255, 160);
     display.print("OK (A)");
 
-    display.refresh();
 }
 
 void Window::initTesting(){
@@ -562,7 +665,6 @@ void Window::initTesting(){
     display.setCursor(290, 225);
     display.print("Continue (A)");
 
-    display.refresh();
 }
 
 void Window::initTestingConfirmed(bool connected, bool testingEnabled) {
@@ -609,7 +711,6 @@ void Window::initTestingConfirmed(bool connected, bool testingEnabled) {
         display.print("Cancel (B)");
     }
 
-    display.refresh();
 }
 void Window::initTestingFailed() {
     display.fillRect(0,19,400,222, WHITE);
@@ -626,7 +727,6 @@ void Window::initTestingFailed() {
     display.setCursor(6, 225);
     display.print("Cancel (B)");
 
-    display.refresh();
 }
 
 void Window::initTestingLost() {
@@ -646,7 +746,6 @@ void Window::initTestingLost() {
     display.setCursor(6, 225);
     display.print("Cancel (B)");
 
-    display.refresh();
 }
 
 void Window::initTestingWait() {
@@ -662,7 +761,6 @@ void Window::initTestingWait() {
     display.setCursor(6, 225);
     display.print("Cancel (B)");
 
-    display.refresh();
 }
 
 
@@ -727,19 +825,255 @@ void Window::updateTesting(uint32_t index) {
     drawCentreString(eventName[index], xOffset, yOffset);
 
     oldIndex = index;
-    display.refresh();
 }
 
 void Window::initData(){
     display.fillRect(0,19,400,222, WHITE);
 
-    display.refresh();
+    display.setFont(&FreeSans12pt7b);
+    display.setTextSize(1);
+    display.setTextColor(WHITE);
+    display.fillRect(0,19,400,30, BLACK);
+    drawCentreString("Flights", 200, 42);
+    display.setTextColor(BLACK);
+
+    dataPage = -1;
+    dataSelected = -1;
+    detailNumber = -1;
+}
+
+/* Rows are listed newest first, row 0 is the last slot of the index */
+void Window::updateData(uint32_t row){
+    uint32_t count = logIndex ? logIndex->getCount() : 0;
+    if(count == 0){
+        display.setFont(&FreeSans9pt7b);
+        display.setTextColor(BLACK);
+        drawCentreString("No flights recorded", 200, 140);
+        return;
+    }
+    row = min(row, count - 1);
+
+    int32_t page = row / WINDOW_DATA_ROWS;
+    if(page != dataPage){
+        uint32_t firstRow = page * WINDOW_DATA_ROWS;
+        uint32_t rows = min((uint32_t) WINDOW_DATA_ROWS, count - firstRow);
+        dataRowCount = logIndex->read(count - firstRow - rows, dataRows, rows);
+        dataPage = page;
+        dataSelected = -1;
+
+        display.fillRect(0,50,400,190, WHITE);
+        for(uint32_t i = 0; i < dataRowCount; i++){
+            drawDataRow(i, BLACK);
+        }
+
+        char pages[22];                 // Two uint32_t and the slash
+        display.setFont(&FreeSans9pt7b);
+        display.setTextColor(WHITE);
+        display.fillRect(330,20,70,28, BLACK);
+        snprintf(pages, sizeof(pages), "%u/%u", (uint32_t) page + 1, (count + WINDOW_DATA_ROWS - 1) / WINDOW_DATA_ROWS);
+        display.setCursor(340, 40);
+        display.print(pages);
+    }
+
+    uint32_t position = row % WINDOW_DATA_ROWS;
+    if(dataSelected >= 0 && (uint32_t) dataSelected != position){
+        drawDataRow(dataSelected, BLACK);
+    }
+    if(position < dataRowCount){
+        drawDataRow(position, WHITE);
+    }
+    dataSelected = position;
+    display.setFont(NULL);
+}
+
+void Window::drawDataRow(uint32_t position, bool color){
+    const log_index_entry_t& entry = dataRows[dataRowCount - 1 - position];
+    int16_t y = 50 + position * WINDOW_DATA_ROW_HEIGHT;
+    char text[24];
+
+    display.fillRect(0, y, 400, WINDOW_DATA_ROW_HEIGHT, !color);
+    display.setFont(&FreeSans9pt7b);
+    display.setTextColor(color);
+    y += 19;
+
+    snprintf(text, sizeof(text), "#%03u", entry.number);
+    display.setCursor(6, y);
+    display.print(text);
+
+    if(entry.date){
+        snprintf(text, sizeof(text), "%02d.%02d.%02d %02d:%02d", day(entry.date), month(entry.date), year(entry.date) % 100,
+                 hour(entry.date), minute(entry.date));
+    } else {
+        strcpy(text, "--");
+    }
+    display.setCursor(60, y);
+    display.print(text);
+
+    if(entry.duration){
+        snprintf(text, sizeof(text), "%u:%02u", entry.duration / 60, entry.duration % 60);
+    } else {
+        strcpy(text, "--");
+    }
+    display.setCursor(182, y);
+    display.print(text);
+
+    snprintf(text, sizeof(text), "%d m", entry.maxAltitude);
+    display.setCursor(245, y);
+    display.print(text);
+
+    snprintf(text, sizeof(text), "%u kB", (entry.size + 1023) / 1024);
+    display.setCursor(325, y);
+    display.print(text);
+}
+
+bool Window::readDataEntry(uint32_t row, log_index_entry_t* entry){
+    uint32_t count = logIndex ? logIndex->getCount() : 0;
+    if(row >= count) return false;
+    return logIndex->read(count - 1 - row, entry, 1) == 1;
+}
+
+/*
+ * Summary from the index, the min/max altitude profile needs a pass through
+ * the CSV file and is drawn by updateDataProfile() once it has been scanned.
+ */
+bool Window::initDataDetail(uint32_t row, log_index_entry_t* entry){
+    if(!readDataEntry(row, entry)) return false;
+
+    char text[32];
+    display.fillRect(0,19,400,222, WHITE);
+    display.setFont(&FreeSans12pt7b);
+    display.setTextSize(1);
+    display.setTextColor(WHITE);
+    display.fillRect(0,19,400,30, BLACK);
+    snprintf(text, sizeof(text), "Flight #%03u", entry->number);
+    drawCentreString(text, 200, 42);
+
+    display.setFont(&FreeSans9pt7b);
+    display.setTextColor(BLACK);
+    if(entry->date){
+        snprintf(text, sizeof(text), "%02d.%02d.%04d", day(entry->date), month(entry->date), year(entry->date));
+        display.setCursor(6, 75);
+        display.print(text);
+        snprintf(text, sizeof(text), "%02d:%02d:%02d", hour(entry->date), minute(entry->date), second(entry->date));
+        display.setCursor(6, 97);
+        display.print(text);
+    }
+    snprintf(text, sizeof(text), "%u:%02u min", entry->duration / 60, entry->duration % 60);
+    display.setCursor(6, 130);
+    display.print(entry->duration ? text : "--");
+    snprintf(text, sizeof(text), "%d m max", entry->maxAltitude);
+    display.setCursor(6, 152);
+    display.print(text);
+    snprintf(text, sizeof(text), "%u samples", entry->samples);
+    display.setCursor(6, 174);
+    display.print(text);
+    snprintf(text, sizeof(text), "%u kB", (entry->size + 1023) / 1024);
+    display.setCursor(6, 196);
+    display.print(text);
+
+    const int16_t px = 155, py = 57;
+    display.drawRect(px - 1, py - 1, WINDOW_PROFILE_WIDTH + 2, WINDOW_PROFILE_HEIGHT + 2, BLACK);
+    drawCentreString(entry->samples ? "Loading" : "No data", px + WINDOW_PROFILE_WIDTH / 2, py + WINDOW_PROFILE_HEIGHT / 2);
+    display.setFont(NULL);
+
+    detailNumber = entry->samples ? entry->number : -1;
+    return entry->samples > 0;
 }
 
-void Window::initSesnors(){
+/* Profiles of a log that is no longer shown are dropped */
+void Window::updateDataProfile(const data_profile_t& profile){
+    if(detailNumber != profile.number) return;
+    detailNumber = -1;
+
+    const int16_t px = 155, py = 57;
+    display.fillRect(px, py, WINDOW_PROFILE_WIDTH, WINDOW_PROFILE_HEIGHT, WHITE);
+    if(!profile.valid){
+        display.setFont(&FreeSans9pt7b);
+        display.setTextColor(BLACK);
+        drawCentreString("No data", px + WINDOW_PROFILE_WIDTH / 2, py + WINDOW_PROFILE_HEIGHT / 2);
+        display.setFont(NULL);
+        return;
+    }
+
+    int32_t low = 0, high = 1;
+    for(uint32_t i = 0; i < WINDOW_PROFILE_WIDTH; i++){
+        if(profile.minimum[i] > profile.maximum[i]) continue;
+        low = min(low, profile.minimum[i]);
+        high = max(high, profile.maximum[i]);
+    }
+
+    for(uint32_t i = 0; i < WINDOW_PROFILE_WIDTH; i++){
+        if(profile.minimum[i] > profile.maximum[i]) continue;
+        int16_t top = py + (WINDOW_PROFILE_HEIGHT - 1) - (int64_t)(profile.maximum[i] - low) * (WINDOW_PROFILE_HEIGHT - 1) / (high - low);
+        int16_t bottom = py + (WINDOW_PROFILE_HEIGHT - 1) - (int64_t)(profile.minimum[i] - low) * (WINDOW_PROFILE_HEIGHT - 1) / (high - low);
+        display.drawFastVLine(px + i, top, bottom - top + 1, BLACK);
+    }
+}
+
+void Window::initSensors(){
     display.fillRect(0,19,400,222, WHITE);
 
-    display.refresh();
+    display.setFont(&FreeSans12pt7b);
+    display.setTextSize(1);
+    display.setTextColor(WHITE);
+    display.fillRect(0,19,400,30, BLACK);
+    drawCentreString("Sensors", 200, 42);
+
+    display.setFont(&FreeSans9pt7b);
+    display.setTextColor(BLACK);
+    const char* columns[] = {"X / Roll", "Y / Pitch", "Z / Yaw"};
+    for(uint32_t i = 0; i < 3; i++){
+        display.setCursor(120 + i * 95, 68);
+        display.print(columns[i]);
+    }
+    display.drawLine(0, 73, 400, 73, BLACK);
+
+    const char* rows[] = {"Acc [g]", "Gyro [dps]", "Mag", "Att [deg]"};
+    for(uint32_t i = 0; i < 4; i++){
+        display.setCursor(8, 92 + i * 22);
+        display.print(rows[i]);
+    }
+    display.drawLine(0, 168, 400, 168, BLACK);
+
+    const char* status[] = {"Rate", "IMU errors", "Mag errors", "Field", "Spread", "Calibration"};
+    for(uint32_t i = 0; i < 6; i++){
+        display.setCursor((i < 3) ? 8 : 215, 188 + (i % 3) * 22);
+        display.print(status[i]);
+    }
+    display.setFont(NULL);
+
+    sensors.invalidate();
+}
+
+/* Called at a fixed rate, the fields only redraw values whose text changed */
+void Window::updateSensors(const navigation_snapshot_t& snapshot){
+    float acceleration[3] = {snapshot.ax, snapshot.ay, snapshot.az};
+    float gyroscope[3] = {snapshot.gx, snapshot.gy, snapshot.gz};
+    float magnetometer[3] = {snapshot.mx, snapshot.my, snapshot.mz};
+    float attitude[3] = {snapshot.roll, snapshot.pitch, snapshot.yaw};
+
+    for(uint32_t i = 0; i < 3; i++){
+        sensors.acceleration[i].printf(display, "%.2f", acceleration[i]);
+        sensors.gyroscope[i].printf(display, "%.1f", gyroscope[i]);
+        sensors.magnetometer[i].printf(display, "%.0f", magnetometer[i]);
+        sensors.attitude[i].printf(display, "%.1f", attitude[i] * (180 / PI));
+    }
+
+    sensors.rate.printf(display, "%u Hz", snapshot.rate);
+    sensors.imuErrors.printf(display, "%u", snapshot.imuErrors);
+    sensors.compassErrors.printf(display, "%u", snapshot.compassErrors);
+    sensors.field.printf(display, "%.0f", snapshot.field);
+    sensors.spread.printf(display, "%.1f %%", snapshot.fieldSpread);
+
+    const char* quality = "poor";
+    if(snapshot.calibrating){
+        quality = "running";
+    } else if(snapshot.fieldSpread < WINDOW_CALIBRATION_GOOD){
+        quality = "good";
+    } else if(snapshot.fieldSpread < WINDOW_CALIBRATION_FAIR){
+        quality = "fair";
+    }
+    sensors.quality.set(display, quality);
 }
 
 void Window::initSettings(uint32_t submenu){
@@ -770,7 +1104,6 @@ void Window::initSettings(uint32_t submenu){
     subMenuSettingIndex = submenu;
 
     display.drawLine(0,177,400,177, BLACK);
-    display.refresh();
 }
 
 void Window::addSettingEntry(uint32_t settingIndex, const device_settings_t* setting, bool color){
@@ -839,7 +1172,6 @@ void Window::updateSettings(int32_t index){
     }
     
     oldSettingsIndex = index;
-    display.refresh();
 }
 
 void Window::highlightSetting(uint32_t index, bool color){
@@ -859,7 +1191,7 @@ void Window::highlightSetting(uint32_t index, bool color){
 
 }
 
-int keybXY[38][2] = {  {  20, 125}, //'1'
+int keybXY[KEYBOARD_KEYS][2] = {  {  20, 125}, //'1'
                        {  60, 125}, //'2'
                        { 100, 125}, //'3'
                        { 140, 125}, //'4'
@@ -899,63 +1231,47 @@ int keybXY[38][2] = {  {  20, 125}, //'1'
                        { 340, 215}, //'ENTER'
                        };
 
-char keybChar[38] = { '1', '2', '3', '4', '5', '6', '7', '8', '9', '0',
-                      'Q', 'W', 'E', 'R', 'T', 'Y', 'U', 'I', 'O', 'P',
-                         'A', 'S', 'D', 'F', 'G', 'H', 'J', 'K', 'L',
-                      ' ', 'Z', 'X', 'C', 'V', 'B', 'N', 'M', ' ' };
-
-void Window::initKeyboard(char* text, uint32_t maxLength){  
-    if(maxLength != 0) keyboardTextMaxLength = maxLength; 
+void Window::initKeyboard(const char* text, int32_t keyHighlight, bool upperCase){
+    this->upperCase = upperCase;
+    oldKey = keyHighlight;
+    strlcpy(keyboardText, text, sizeof(keyboardText));
     display.fillRect(0,19,400,222, WHITE);
     
     display.setFont(&FreeSans12pt7b);
     display.setTextSize(1);
-    display.setTextColor(BLACK);
-    
-    display.setCursor(140,80);
-    display.print(text);
+    updateKeyboardText(keyboardText, BLACK);
 
     display.setFont();
     display.setTextSize(2);
 
-    for(int i = 0; i < 38; i++){
+    for(int i = 0; i < KEYBOARD_KEYS; i++){
         if(i == oldKey){
             highlightKeyboardKey(i, BLACK);
-        } else if (i != 29 && i != 37){
-            if(!upperCase && i > 9) display.drawChar(keybXY[i][0], keybXY[i][1], keybChar[i]+32, BLACK, WHITE, 2);
-            else display.drawChar(keybXY[i][0], keybXY[i][1], keybChar[i], BLACK, WHITE, 2);
+        } else if (i != KEYBOARD_SHIFT && i != KEYBOARD_ENTER){
+            if(!upperCase && i > 9) display.drawChar(keybXY[i][0], keybXY[i][1], keyboardChars[i]+32, BLACK, WHITE, 2);
+            else display.drawChar(keybXY[i][0], keybXY[i][1], keyboardChars[i], BLACK, WHITE, 2);
         }
     }
-    if (oldKey != 29) display.drawBitmap(keybXY[29][0]-4, keybXY[29][1]-1, shift_keyboard, 16, 16, BLACK);
-    if (oldKey != 37) display.drawBitmap(keybXY[37][0]-4, keybXY[37][1]-1, enter_keyboard, 16, 16, BLACK);
-    if (oldKey != -1) display.drawBitmap(280, 60, backspace_keyboard, 24, 24, BLACK);
-    else highlightKeyboardKey(-1, BLACK);
+    if (oldKey != KEYBOARD_SHIFT) display.drawIcon(keybXY[KEYBOARD_SHIFT][0]-4, keybXY[KEYBOARD_SHIFT][1]-1, ICON_SHIFT_KEYBOARD, BLACK);
+    if (oldKey != KEYBOARD_ENTER) display.drawIcon(keybXY[KEYBOARD_ENTER][0]-4, keybXY[KEYBOARD_ENTER][1]-1, ICON_ENTER_KEYBOARD, BLACK);
+    if (oldKey != KEYBOARD_BACKSPACE) display.drawIcon(280, 60, ICON_BACKSPACE_KEYBOARD, BLACK);
+    else highlightKeyboardKey(KEYBOARD_BACKSPACE, BLACK);
 
-    display.refresh();
 }
 
-void Window::updateKeyboard(char* text, int32_t keyHighlight, bool keyPressed){
-    
-    display.setFont(&FreeSans12pt7b);
-    display.setTextSize(1);
-    display.setTextColor(BLACK);
+/* Draws the state of the Keyboard of the HMI task, only the parts that differ from the shown one */
+void Window::updateKeyboard(const char* text, int32_t keyHighlight, bool upperCase){
+    if(upperCase != this->upperCase){
+        initKeyboard(text, keyHighlight, upperCase);
+        return;
+    }
 
-    if(keyPressed){
-        if(keyHighlight == 29){ // SHIFT
-            upperCase = !upperCase;
-            initKeyboard(text);
-        } else if (keyHighlight == -1){ // BACKSPACE
-            updateKeyboardText(text, WHITE);
-            if(strlen(text) > 0) text[strlen(text)-1] = 0;
-            updateKeyboardText(text, BLACK);
-        } else { // KEY
-            if(strlen(text) < keyboardTextMaxLength){
-                updateKeyboardText(text, WHITE);
-                if(keyHighlight > 9) text[strlen(text)] = keybChar[keyHighlight] + !upperCase*32;
-                else text[strlen(text)] = keybChar[keyHighlight];
-                updateKeyboardText(text, BLACK);
-            }
-        }
+    if(strcmp(text, keyboardText) != 0){
+        display.setFont(&FreeSans12pt7b);
+        display.setTextSize(1);
+        updateKeyboardText(keyboardText, WHITE);
+        strlcpy(keyboardText, text, sizeof(keyboardText));
+        updateKeyboardText(keyboardText, BLACK);
     }
 
     display.setFont();
@@ -966,30 +1282,29 @@ void Window::updateKeyboard(char* text, int32_t keyHighlight, bool keyPressed){
     highlightKeyboardKey(keyHighlight, BLACK);
     
     oldKey = keyHighlight;
-    display.refresh();
 } 
 
 void Window::highlightKeyboardKey(int32_t key, bool color){
     
 
-    if(key == -1){
+    if(key == KEYBOARD_BACKSPACE){
         display.fillCircle(291, 71, 16, color);
-        display.drawBitmap(280, 60, backspace_keyboard, 24, 24, !color);
+        display.drawIcon(280, 60, ICON_BACKSPACE_KEYBOARD, !color);
     } else {
         display.fillCircle(keybXY[key][0]+4, keybXY[key][1]+7, 16, color);
     }
     
-    if(key == 29){
-        display.drawBitmap(keybXY[29][0]-4, keybXY[29][1]-1, shift_keyboard, 16, 16, !color);       
-    } else if(key == 37){
-        display.drawBitmap(keybXY[37][0]-4, keybXY[37][1]-1, enter_keyboard, 16, 16, !color);
-    } else {
-        if(!upperCase && key > 9) display.drawChar(keybXY[key][0], keybXY[key][1], keybChar[key]+32, !color, color, 2);
-        else display.drawChar(keybXY[key][0], keybXY[key][1], keybChar[key], !color, color, 2);
+    if(key == KEYBOARD_SHIFT){
+        display.drawIcon(keybXY[KEYBOARD_SHIFT][0]-4, keybXY[KEYBOARD_SHIFT][1]-1, ICON_SHIFT_KEYBOARD, !color);       
+    } else if(key == KEYBOARD_ENTER){
+        display.drawIcon(keybXY[KEYBOARD_ENTER][0]-4, keybXY[KEYBOARD_ENTER][1]-1, ICON_ENTER_KEYBOARD, !color);
+    } else if(key != KEYBOARD_BACKSPACE){
+        if(!upperCase && key > 9) display.drawChar(keybXY[key][0], keybXY[key][1], keyboardChars[key]+32, !color, color, 2);
+        else display.drawChar(keybXY[key][0], keybXY[key][1], keyboardChars[key], !color, color, 2);
     }
 }
 
-void Window::updateKeyboardText(char* text, bool color){
+void Window::updateKeyboardText(const char* text, bool color){
     display.setTextColor(color);
     display.setCursor(140,80);
     display.print(text);
@@ -1,9 +1,17 @@
 #include <Adafruit_GFX.h>
 #include <Adafruit_SharpMem.h>
+#include "display.h"
 
 #include "telemetry/telemetryData.h"
 #include "navigation.h"
 #include "settings.h"
+#include "widget.h"
+#include "compass.h"
+#include "keyboard.h"
+#include "stripchart.h"
+#include "mapview.h"
+#include "trackview.h"
+#include "logging/logindex.h"
 
 #define BLACK 0
 #define WHITE 1
@@ -12,6 +20,34 @@
 #define SHARP_MOSI 35
 #define SHARP_SS   34
 
+#define WINDOW_MAX_FRAME_RATE   25      // [Hz]
+#define WINDOW_VCOM_INTERVAL    1000    // [ms]   Maximum time between two frames
+#define WINDOW_SHADOW_FRAME     1       // [bool] Skip lines equal to the last sent frame, costs 12 kB PSRAM
+#define WINDOW_DATA_ROWS        7       // [#]    Logs per page of the Data page
+#define WINDOW_DATA_ROW_HEIGHT  27      // [px]
+#define WINDOW_PROFILE_WIDTH    238     // [px]   Altitude profile of the selected log
+#define WINDOW_PROFILE_HEIGHT   173     // [px]
+#define WINDOW_MAP_TOP          19      // [px]   Map and track view of the Recovery page, below the status bar
+#define WINDOW_MAP_HEIGHT       221     // [px]
+#define WINDOW_CALIBRATION_GOOD 5       // [%]    Field spread of a good magnetometer calibration
+#define WINDOW_CALIBRATION_FAIR 15      // [%]
+
+/* Min/max altitude per column of the Data detail profile, scanned outside of the render task */
+typedef struct {
+    uint16_t number;                        // [#]    log_<number>.csv
+    bool valid;                             // False if the log has no samples or could not be read
+    uint32_t samples;                       // [#]
+    int32_t minimum[WINDOW_PROFILE_WIDTH];  // [m]
+    int32_t maximum[WINDOW_PROFILE_WIDTH];  // [m]
+} data_profile_t;
+
+typedef enum {
+    RECOVERY_COMPASS = 0,
+    RECOVERY_MAP,
+    RECOVERY_TRACK,
+    RECOVERY_VIEW_COUNT,
+} recovery_view_e;
+
 typedef struct {
   time_t time;
   uint32_t storage;
@@ -21,6 +57,59 @@ typedef struct {
 } topBarData;
 
 
+/* Value fields or strip charts of one half of the Live page */
+struct LiveFields {
+    LiveFields(int16_t xOffset);
+
+    void invalidateData(){
+        state.invalidate(); altitude.invalidate(); velocity.invalidate(); lat.invalidate(); lon.invalidate();
+        voltage.invalidate(); error.invalidate(); pyro1.invalidate(); pyro2.invalidate();
+    }
+
+    void invalidateInfo(){
+        age.invalidate(); snr.invalidate(); lq.invalidate(); rssi.invalidate();
+    }
+
+    TextField state, altitude, velocity, lat, lon, voltage, error;
+    TextField age, snr, lq, rssi;
+    IconField pyro1, pyro2;
+    StripChart altitudeChart, velocityChart;
+};
+
+/* Value fields and compass of the Recovery page, the position, distance and compass show the selected target */
+struct RecoveryFields {
+    RecoveryFields();
+
+    void invalidate(){
+        rocketLat.invalidate(); rocketLon.invalidate(); homeLat.invalidate(); homeLon.invalidate();
+        distance.invalidate(); compass.invalidate();
+        for(uint32_t i = 0; i < NAVIGATION_MAX_TARGETS; i++){
+            targets[i].invalidate();
+        }
+    }
+
+    TextField rocketLat, rocketLon, homeLat, homeLon, distance;
+    TextField targets[NAVIGATION_MAX_TARGETS];
+    Compass compass;
+};
+
+/* Value fields of the Sensors page */
+struct SensorFields {
+    SensorFields();
+
+    void invalidate(){
+        for(uint32_t i = 0; i < 3; i++){
+            acceleration[i].invalidate(); gyroscope[i].invalidate(); magnetometer[i].invalidate(); attitude[i].invalidate();
+        }
+        rate.invalidate(); imuErrors.invalidate(); compassErrors.invalidate();
+        field.invalidate(); spread.invalidate(); quality.invalidate();
+    }
+
+    TextField acceleration[3], gyroscope[3], magnetometer[3], attitude[3];
+    TextField rate, imuErrors, compassErrors;
+    TextField field, spread, quality;
+};
+
 class Window{
   public:
     Window() : display(SHARP_SCK, SHARP_MOSI, SHARP_SS, 400, 240) {}
@@ -36,9 +125,14 @@ class Window{
     void initLive();
     void updateLive(TelemetryInfo* info, uint32_t index);
     void updateLive(TelemetryData* data, TelemetryInfo* info, uint32_t index);
+    void setLiveView(bool charts);
+    void updateLiveCharts(uint32_t index, const SampleRing& altitude, const SampleRing& velocity);
 
     void initRecovery();
-    void updateRecovery(Navigation* navigation);
+    void updateRecovery(const recovery_snapshot_t& snapshot);
+    void setRecoveryView(recovery_view_e view);
+    void selectRecoveryTarget(uint32_t index);
+    void controlMap(map_control_e command);
 
     void initTesting();
     void initTestingConfirmed(bool connected, bool testingEnabled);
@@ -49,34 +143,95 @@ class Window{
     void updateTesting(uint32_t index);
     void initTestingBox(uint32_t index);
 
+    void setLogIndex(LogIndex* index){
+      logIndex = index;
+    }
+
     void initData();
+    void updateData(uint32_t row);
+    /* Summary of the log, true if its profile has to be scanned for updateDataProfile() */
+    bool initDataDetail(uint32_t row, log_index_entry_t* entry);
+    void updateDataProfile(const data_profile_t& profile);
 
-    void initSesnors();
+    void initSensors();
+    void updateSensors(const navigation_snapshot_t& sensors);
     
     void initSettings(uint32_t submenu);
     void updateSettings(int32_t index);
 
     void initBox(const char* text);
 
-    void initKeyboard(char* text, uint32_t maxLength = 0);
-    void updateKeyboard(char* text, int32_t keyHighlight, bool keyPressed = false);
+    void initKeyboard(const char* text, int32_t keyHighlight, bool upperCase);
+    void updateKeyboard(const char* text, int32_t keyHighlight, bool upperCase);
+
+    /* Returns true if a frame transfer was started */
+    bool flush(bool force = false);
+
+    /* True if drawn lines were not sent yet, e.g. because of the frame rate limit */
+    bool hasPendingFrame() const {
+      return display.needsRefresh();
+    }
+
+    uint32_t getLiveRenderTime() const {
+      return liveRenderTime;
+    }
+
+    uint32_t getFrameRate() const {
+      return frameRate;
+    }
+
+    uint32_t getSpiTimePerSecond() const {
+      return spiTimePerSecond;
+    }
+
+    uint32_t getSpiBytesPerSecond() const {
+      return spiBytesPerSecond;
+    }
+
+    const SharpDisplay& getDisplay() const {
+      return display;
+    }
 
-    void refresh() {
-      display.refresh();
+    void resetDisplayStats() {
+      display.resetStats();
     }
 
   private:
-    void updateLiveData(TelemetryData* data, uint32_t index, uint32_t color);
-    void updateLiveInfo(TelemetryInfo* info, uint32_t index, uint32_t color);
+    void drawLiveIcons(uint32_t index);
+    void drawLiveBody(uint32_t index);
+    void updateLiveData(TelemetryData* data, uint32_t index);
+    void updateLiveInfo(TelemetryInfo* info, uint32_t index);
     void drawCentreString(const char *buf, int x, int y);
     void drawCentreString(String& buf, int x, int y);
 
     void addSettingEntry(uint32_t settingIndex, const device_settings_t* setting, bool color = BLACK);
     void highlightSetting(uint32_t index, bool color);
     
+    void drawDataRow(uint32_t position, bool color);
+    bool readDataEntry(uint32_t row, log_index_entry_t* entry);
+
     void highlightKeyboardKey(int32_t key, bool color);
-    void updateKeyboardText(char* text, bool color);
-    Adafruit_SharpMem display; 
+    void updateKeyboardText(const char* text, bool color);
+    SharpDisplay display; 
+
+    uint32_t lastFlush = 0;
+    uint32_t statsStart = 0;
+    uint32_t frameCount = 0;
+    uint32_t spiTime = 0;
+    uint32_t spiBytes = 0;
+    uint32_t frameRate = 0;
+    uint32_t spiTimePerSecond = 0;
+    uint32_t spiBytesPerSecond = 0;
+
+    LiveFields live[2] = {LiveFields(0), LiveFields(200)};
+    bool testingShown[2];
+    bool liveCharts = false;
+    RecoveryFields recovery;
+    MapView mapView = MapView(WINDOW_MAP_TOP, WINDOW_MAP_HEIGHT, BLACK, WHITE);
+    TrackView trackView = TrackView(0, WINDOW_MAP_TOP, 400, WINDOW_MAP_HEIGHT, BLACK, WHITE);
+    recovery_view_e recoveryView = RECOVERY_COMPASS;
+    SensorFields sensors;
+    uint32_t liveRenderTime = 0;
 
     bool connected[2];
     uint32_t lastTeleData[2];
@@ -85,12 +240,20 @@ class Window{
     TelemetryData teleData[2];
     TelemetryInfo infoData[2];
 
+    // Data page, only the rows of the shown page are read from the index
+    LogIndex* logIndex = NULL;
+    log_index_entry_t dataRows[WINDOW_DATA_ROWS];
+    uint32_t dataRowCount = 0;
+    int32_t dataPage = -1;
+    int32_t dataSelected = -1;
+    int32_t detailNumber = -1;          // Log shown on the detail page, -1 if not shown
+
     int32_t oldSettingsIndex;
     uint32_t subMenuSettingIndex;
     
     bool upperCase = true;
     int32_t oldKey = 0;
-    uint32_t keyboardTextMaxLength = 0;
+    char keyboardText[KEYBOARD_TEXT_LENGTH + 1] = {};     // As shown
 
     const char* eventName[9] = {"Ready", "Liftoff", "Burnout", "Apogee", "Main", "Touchdown", "Custom 1", "Custom 2"};
 
@@ -0,0 +1,193 @@
+#include "crashlog.h"
+#include "console.h"
+#include "esp_system.h"
+
+#define CRASHLOG_MAGIC              0x43415453    // "CATS"
+
+typedef struct {
+    uint32_t magic;
+    uint32_t last;
+    uint32_t time[HEARTBEAT_COUNT];
+} heartbeat_record_t;
+
+RTC_NOINIT_ATTR static heartbeat_record_t heartbeats;     // Survives software resets, panics and watchdog resets
+
+static const char* const resetReasonName[] = {
+    "UNKNOWN", "POWERON", "EXT", "SW", "PANIC", "INT_WDT", "TASK_WDT", "WDT", "DEEPSLEEP", "BROWNOUT", "SDIO",
+};
+
+static const char* const heartbeatName[HEARTBEAT_COUNT] = {
+    "main", "hmi", "link1", "link2", "navigation", "render",
+};
+
+bool CrashLog::begin(){
+    buffer = xStreamBufferCreate(CRASHLOG_BUFFER_SIZE, 1);
+    writeLock = xSemaphoreCreateMutex();
+    if(buffer == NULL || writeLock == NULL){
+        console.error.println("[CRASHLOG] Could not create buffer");
+        return false;
+    }
+
+    fsLock();
+    if(!fatfs.exists(CRASHLOG_DIRECTORY) && !fatfs.mkdir(CRASHLOG_DIRECTORY)){
+        fsUnlock();
+        console.error.println("[CRASHLOG] Could not create directory");
+        return false;
+    }
+
+    // Continue in the newest file, store() moves on to the oldest one if it is full
+    char name[32];
+    bool found = false;
+    current = 0;
+    sequence = 0;
+    for(uint32_t i = 0; i < CRASHLOG_FILE_COUNT; i++){
+        fileName(name, i);
+        File file = fatfs.open(name, FILE_READ);
+        char header[32] = {};
+        unsigned number;
+        if(file && file.read(header, sizeof(header) - 1) > 0 && sscanf(header, CRASHLOG_HEADER, &number) == 1){
+            if(!found || number > sequence){
+                current = i;
+                sequence = number;
+                found = true;
+            }
+        }
+        file.close();
+    }
+
+    // Files written before the header was introduced, the first one that is not full
+    for(uint32_t i = 0; i < CRASHLOG_FILE_COUNT && !found; i++){
+        fileName(name, i);
+        File file = fatfs.open(name, FILE_READ);
+        uint32_t size = file ? file.fileSize() : 0;
+        file.close();
+        if(size < CRASHLOG_FILE_SIZE){
+            current = i;
+            found = true;
+        }
+    }
+    fsUnlock();
+
+    initialized = true;
+    xTaskCreate(logTask, "task_crashlog", 3072, this, 0, NULL);
+    logBoot();
+    return true;
+}
+
+void CrashLog::heartbeat(heartbeat_slot_e slot){
+    heartbeats.time[slot] = millis();
+    heartbeats.last = slot;
+}
+
+void CrashLog::logBoot(){
+    uint32_t reason = esp_reset_reason();
+    printf("---- Boot, reset reason %s\n", reason < sizeof(resetReasonName) / sizeof(resetReasonName[0]) ? resetReasonName[reason] : "?");
+
+    if(heartbeats.magic == CRASHLOG_MAGIC && heartbeats.last < HEARTBEAT_COUNT){
+        printf("Last heartbeat %s at %u ms\n", heartbeatName[heartbeats.last], heartbeats.time[heartbeats.last]);
+        for(uint32_t i = 0; i < HEARTBEAT_COUNT; i++){
+            printf("  %-10s %u ms\n", heartbeatName[i], heartbeats.time[i]);
+        }
+    }
+
+    memset(&heartbeats, 0, sizeof(heartbeats));
+    heartbeats.magic = CRASHLOG_MAGIC;
+}
+
+/* Never blocks on a full buffer, the data is dropped instead */
+void CrashLog::push(const void* data, size_t length){
+    size_t sent = xStreamBufferSend(buffer, data, length, 0);
+    droppedBytes += length - sent;
+}
+
+size_t CrashLog::write(const uint8_t* data, size_t size){
+    if(!initialized) return 0;
+    if(xSemaphoreTake(writeLock, portMAX_DELAY) != pdTRUE) return 0;
+
+    size_t start = 0;
+    for(size_t i = 0; i < size; i++){
+        if(lineStart){
+            char stamp[16];
+            int length = snprintf(stamp, sizeof(stamp), "[%lu] ", millis());
+            push(stamp, length);
+            lineStart = false;
+        }
+        if(data[i] == '\n'){
+            push(&data[start], i + 1 - start);
+            start = i + 1;
+            lineStart = true;
+        }
+    }
+    if(start < size){
+        push(&data[start], size - start);
+    }
+
+    xSemaphoreGive(writeLock);
+    return size;
+}
+
+void CrashLog::fileName(char* name, uint32_t index){
+    snprintf(name, 32, CRASHLOG_DIRECTORY "/crash_%u.log", index);
+}
+
+void CrashLog::writeHeader(File& file){
+    char header[32];
+    int length = snprintf(header, sizeof(header), CRASHLOG_HEADER, (unsigned) ++sequence);
+    file.write((const uint8_t*) header, length);
+}
+
+void CrashLog::store(const uint8_t* data, uint32_t length){
+    if(bootBytes + length > CRASHLOG_BOOT_BUDGET){
+        droppedBytes += length;
+        return;
+    }
+
+    char name[32];
+    fsLock();
+    fileName(name, current);
+    File file = fatfs.open(name, FILE_WRITE);
+    if(file){
+        if(file.fileSize() == 0){
+            writeHeader(file);
+        }
+        uint32_t size = file.fileSize();
+        uint32_t space = (size < CRASHLOG_FILE_SIZE) ? CRASHLOG_FILE_SIZE - size : 0;
+        uint32_t part = min(length, space);
+        file.write(data, part);
+        if(part < length){
+            file.close();
+            current = (current + 1) % CRASHLOG_FILE_COUNT;
+            fileName(name, current);
+            file = fatfs.open(name, O_WRONLY | O_CREAT | O_TRUNC);
+            if(file){
+                writeHeader(file);
+                file.write(&data[part], length - part);
+            }
+        }
+        file.close();
+        bootBytes += length;
+    } else {
+        droppedBytes += length;
+    }
+    fsUnlock();
+}
+
+void CrashLog::logTask(void* pvParameter){
+    CrashLog* ref = (CrashLog*)pvParameter;
+
+    uint32_t fill = 0;
+    TickType_t lastStore = xTaskGetTickCount();
+
+    while(ref->initialized){
+        fill += xStreamBufferReceive(ref->buffer, &ref->sector[fill], CRASHLOG_SECTOR_SIZE - fill, pdMS_TO_TICKS(CRASHLOG_FLUSH_INTERVAL));
+
+        if(fill == CRASHLOG_SECTOR_SIZE || (fill > 0 && (xTaskGetTickCount() - lastStore) >= pdMS_TO_TICKS(CRASHLOG_FLUSH_INTERVAL))){
+            ref->store(ref->sector, fill);
+            fill = 0;
+            lastStore = xTaskGetTickCount();
+        }
+    }
+    vTaskDelete(NULL);
+}
+
+CrashLog crashLog;
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <Arduino.h>
+#include "freertos/stream_buffer.h"
+#include "utils.h"
+
+#define CRASHLOG_DIRECTORY          "/crash"
+#define CRASHLOG_FILE_COUNT         4             // [#]    Number of files in the rotation
+#define CRASHLOG_FILE_SIZE          32768         // [B]    Size at which the next file is started
+#define CRASHLOG_BOOT_BUDGET        65536         // [B]    Maximum number of bytes written per boot
+#define CRASHLOG_SECTOR_SIZE        512           // [B]    Data is collected and written in batches of one sector
+#define CRASHLOG_FLUSH_INTERVAL     10000         // [ms]   Incomplete batches are written after this time
+#define CRASHLOG_BUFFER_SIZE        2048          // [B]    Stream buffer between the writers and the log task
+#define CRASHLOG_HEADER             "---- Crash log %u\n"    // First line of every file, numbered in the order the files were started
+
+typedef enum {
+    HEARTBEAT_MAIN = 0,
+    HEARTBEAT_HMI,
+    HEARTBEAT_LINK1,
+    HEARTBEAT_LINK2,
+    HEARTBEAT_NAVIGATION,
+    HEARTBEAT_RENDER,
+    HEARTBEAT_COUNT,
+} heartbeat_slot_e;
+
+/*
+ * Persistent rolling log on the flash drive. Console output is handed over
+ * through a stream buffer and written in sector sized batches by a low
+ * priority task into CRASHLOG_FILE_COUNT rotating files. At most
+ * CRASHLOG_BOOT_BUDGET bytes are written per boot, so the flash wear is
+ * bounded. On boot the reset reason and the last heartbeat of every task
+ * (kept in RTC memory over the reset) are logged.
+ */
+class CrashLog : public Print {
+    public:
+        bool begin();
+
+        void heartbeat(heartbeat_slot_e slot);
+
+        using Print::write;
+
+        size_t write(uint8_t c){
+            return write(&c, 1);
+        }
+
+        size_t write(const uint8_t* buffer, size_t size);
+
+        uint32_t getWrittenBytes() const {
+            return bootBytes;
+        }
+
+        uint32_t getDroppedBytes() const {
+            return droppedBytes;
+        }
+
+    private:
+        bool initialized = false;
+        bool lineStart = true;
+
+        StreamBufferHandle_t buffer = NULL;
+        SemaphoreHandle_t writeLock = NULL;
+
+        uint32_t current = 0;
+        uint32_t sequence = 0;          // Number of the newest file
+        volatile uint32_t bootBytes = 0;
+        volatile uint32_t droppedBytes = 0;
+
+        uint8_t sector[CRASHLOG_SECTOR_SIZE];
+
+        void push(const void* data, size_t length);
+        void logBoot();
+        void store(const uint8_t* data, uint32_t length);
+        static void fileName(char* name, uint32_t index);
+        void writeHeader(File& file);
+        static void logTask(void* pvParameter);
+};
+
+extern CrashLog crashLog;
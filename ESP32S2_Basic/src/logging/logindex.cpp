@@ -0,0 +1,219 @@
+#include "logindex.h"
+#include "console.h"
+
+void LogIndex::path(char* buffer, size_t size) const {
+    snprintf(buffer, size, "%s/" LOG_INDEX_FILE, directory);
+}
+
+/* The index is only trusted if its entry count and last entry match the CSV files */
+bool LogIndex::begin(){
+    char name[40];
+    path(name, sizeof(name));
+
+    uint32_t logs = 0;
+    list(NULL, &logs, &highest);
+
+    log_index_header_t header = {};
+    log_index_entry_t last = {};
+    fsLock();
+    File file = fatfs.open(name, FILE_READ);
+    bool found = file;
+    bool valid = found && file.read(&header, sizeof(header)) == sizeof(header) &&
+                 header.magic == LOG_INDEX_MAGIC && header.version == LOG_INDEX_VERSION &&
+                 header.entrySize == sizeof(log_index_entry_t) &&
+                 file.fileSize() >= sizeof(header) + header.count * sizeof(log_index_entry_t) &&
+                 header.count == logs;
+    if(valid && logs > 0){
+        valid = file.seekSet(sizeof(header) + (header.count - 1) * sizeof(log_index_entry_t)) &&
+                file.read(&last, sizeof(last)) == sizeof(last) && last.number == highest;
+    }
+    if(file) file.close();
+    fsUnlock();
+
+    if(!valid && found){
+        console.warning.printf("[INDEX] Index does not match the %u logs in the directory\n", logs);
+    }
+    count = valid ? header.count : 0;
+    return valid;
+}
+
+bool LogIndex::writeHeader(File& file){
+    log_index_header_t header = {LOG_INDEX_MAGIC, LOG_INDEX_VERSION, sizeof(log_index_entry_t), count};
+    return file.seekSet(0) && file.write(&header, sizeof(header)) == sizeof(header);
+}
+
+/* One pass over the directory, present gets a bit per log number if not NULL */
+bool LogIndex::list(uint8_t* present, uint32_t* logs, int32_t* last){
+    char name[40];
+    *logs = 0;
+    *last = -1;
+
+    fsLock();
+    File dir = fatfs.open(directory);
+    if(!dir || !dir.isDir()){
+        fsUnlock();
+        return false;
+    }
+    File entry;
+    while(entry.openNext(&dir, O_RDONLY)){
+        int number;
+        entry.getName(name, sizeof(name));
+        if(!entry.isDir() && sscanf(name, "log_%d.csv", &number) == 1 && number >= 0 && number < LOG_INDEX_MAX_LOGS){
+            if(present) present[number / 8] |= (1 << (number % 8));
+            *last = max(*last, (int32_t) number);
+            (*logs)++;
+        }
+        entry.close();
+    }
+    dir.close();
+    fsUnlock();
+    return true;
+}
+
+/* One pass over the directory for the numbers, then the logs in ascending order */
+bool LogIndex::rebuild(){
+    char name[40];
+    static uint8_t present[(LOG_INDEX_MAX_LOGS + 7) / 8];
+    memset(present, 0, sizeof(present));
+
+    uint32_t logs = 0;
+    if(!list(present, &logs, &highest)){
+        console.error.println("[INDEX] Log directory missing");
+        return false;
+    }
+
+    fsLock();
+    path(name, sizeof(name));
+    fatfs.remove(name);
+    File file = fatfs.open(name, O_RDWR | O_CREAT);
+    count = 0;
+    bool ok = file && writeHeader(file);
+    if(file) file.close();
+    fsUnlock();
+    if(!ok){
+        console.error.println("[INDEX] Could not create index");
+        return false;
+    }
+
+    for(uint32_t number = 0; number < LOG_INDEX_MAX_LOGS; number++){
+        if(!(present[number / 8] & (1 << (number % 8)))) continue;
+        log_index_entry_t log = {};
+        if(scan(number, &log)){
+            append(log);
+        }
+    }
+    console.ok.printf("[INDEX] Rebuilt with %u logs\n", count);
+    return true;
+}
+
+uint32_t LogIndex::read(uint32_t first, log_index_entry_t* entries, uint32_t n){
+    char name[40];
+    path(name, sizeof(name));
+    if(first >= count) return 0;
+    n = min(n, count - first);
+
+    fsLock();
+    File file = fatfs.open(name, FILE_READ);
+    int length = 0;
+    if(file && file.seekSet(sizeof(log_index_header_t) + first * sizeof(log_index_entry_t))){
+        length = file.read(entries, n * sizeof(log_index_entry_t));
+    }
+    if(file) file.close();
+    fsUnlock();
+    return max(length, 0) / sizeof(log_index_entry_t);
+}
+
+int32_t LogIndex::append(const log_index_entry_t& entry){
+    char name[40];
+    path(name, sizeof(name));
+
+    fsLock();
+    File file = fatfs.open(name, O_RDWR | O_CREAT);
+    int32_t slot = count;
+    bool ok = file && file.seekSet(sizeof(log_index_header_t) + slot * sizeof(log_index_entry_t)) &&
+              file.write(&entry, sizeof(entry)) == sizeof(entry);
+    if(ok){
+        count = slot + 1;
+        highest = max(highest, (int32_t) entry.number);
+        ok = writeHeader(file);             // Count after the entry, a reset in between only loses the new entry
+    }
+    if(file) file.close();
+    fsUnlock();
+    return ok ? slot : -1;
+}
+
+bool LogIndex::update(uint32_t slot, const log_index_entry_t& entry){
+    char name[40];
+    path(name, sizeof(name));
+    if(slot >= count) return false;
+
+    fsLock();
+    File file = fatfs.open(name, O_RDWR);
+    bool ok = file && file.seekSet(sizeof(log_index_header_t) + slot * sizeof(log_index_entry_t)) &&
+              file.write(&entry, sizeof(entry)) == sizeof(entry);
+    if(file) file.close();
+    fsUnlock();
+    return ok;
+}
+
+/* The file system lock is only held per chunk, the recorder keeps writing meanwhile */
+bool LogIndex::scan(uint32_t number, log_index_entry_t* entry, log_sample_fn fn, void* context){
+    char name[40];
+    uint8_t chunk[LOG_INDEX_CHUNK_SIZE];
+    snprintf(name, sizeof(name), "%s/log_%03u.csv", directory, number);
+
+    fsLock();
+    File file = fatfs.open(name, FILE_READ);
+    if(!file){
+        fsUnlock();
+        return false;
+    }
+    entry->number = number;
+    entry->size = file.fileSize();
+    fsUnlock();
+
+    uint32_t line = 0;
+    uint32_t column = 0;
+    int32_t value = 0;
+    bool negative = false;
+    int32_t altitude = 0;
+    bool first = true;
+
+    entry->samples = 0;
+    while(true){
+        fsLock();
+        int length = file.read(chunk, sizeof(chunk));
+        fsUnlock();
+        if(length <= 0) break;
+
+        for(int i = 0; i < length; i++){
+            char c = chunk[i];
+            if(c == '\n'){
+                if(line > 0 && column > LOG_INDEX_ALTITUDE_COLUMN){       // Line 0 is the CSV header
+                    if(first || altitude > entry->maxAltitude) entry->maxAltitude = altitude;
+                    first = false;
+                    if(fn) fn(context, entry->samples, altitude);
+                    entry->samples++;
+                }
+                line++;
+                column = 0;
+                value = 0;
+                negative = false;
+            } else if(c == ','){
+                if(column == LOG_INDEX_ALTITUDE_COLUMN) altitude = negative ? -value : value;
+                column++;
+                value = 0;
+                negative = false;
+            } else if(c == '-'){
+                negative = true;
+            } else if(c >= '0' && c <= '9'){
+                value = value * 10 + (c - '0');
+            }
+        }
+    }
+
+    fsLock();
+    file.close();
+    fsUnlock();
+    return true;
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <Arduino.h>
+#include "utils.h"
+
+#define LOG_INDEX_FILE          "index.bin"
+#define LOG_INDEX_MAGIC         0x58444E49    // "INDX"
+#define LOG_INDEX_VERSION       1
+#define LOG_INDEX_MAX_LOGS      1000          // [#]    log_000.csv to log_999.csv
+#define LOG_INDEX_CHUNK_SIZE    512           // [B]    Read size when scanning a log
+#define LOG_INDEX_ALTITUDE_COLUMN 5           // [#]    Column of the altitude in the CSV files
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t entrySize;                 // [B]
+    uint32_t count;                     // [#]    Entries following the header
+} log_index_header_t;
+
+typedef struct {
+    uint16_t number;                    // [#]    log_<number>.csv
+    uint16_t reserved;
+    uint32_t date;                      // [s]    Unix time of the first record, 0 if unknown
+    uint32_t duration;                  // [s]    0 if unknown
+    uint32_t samples;                   // [#]
+    int32_t maxAltitude;                // [m]
+    uint32_t size;                      // [B]
+} log_index_entry_t;
+
+/* Called for every record of a log by LogIndex::scan() */
+typedef void (*log_sample_fn)(void* context, uint32_t sample, int32_t altitude);
+
+/*
+ * Metadata of the flight logs in a file of fixed size records next to the
+ * logs, ordered by log number. The recorder appends an entry per log and
+ * rewrites it in place while recording, readers seek to the rows they show,
+ * so listing the logs costs the same with 5 or 500 files. A missing or
+ * invalid index, or one that does not match the logs in the directory, e.g.
+ * after files were copied or deleted over USB, is rebuilt once by scanning
+ * the CSV files.
+ */
+class LogIndex {
+    public:
+        LogIndex(const char* directory) : directory(directory) {}
+
+        /* False if the index has to be rebuilt, checks the count and the highest log number against the directory */
+        bool begin();
+        bool rebuild();
+
+        uint32_t getCount() const {
+            return count;
+        }
+
+        /* Highest log number in the directory at begin(), -1 without logs */
+        int32_t getHighest() const {
+            return highest;
+        }
+
+        /* Reads up to n entries starting at slot first, returns the number read */
+        uint32_t read(uint32_t first, log_index_entry_t* entries, uint32_t n);
+
+        /* Returns the slot of the new entry, -1 on failure */
+        int32_t append(const log_index_entry_t& entry);
+        bool update(uint32_t slot, const log_index_entry_t& entry);
+
+        /* Streams log_<number>.csv in chunks, fills the entry statistics and calls fn for every record */
+        bool scan(uint32_t number, log_index_entry_t* entry, log_sample_fn fn = NULL, void* context = NULL);
+
+    private:
+        void path(char* buffer, size_t size) const;
+        bool writeHeader(File& file);
+        bool list(uint8_t* present, uint32_t* logs, int32_t* last);
+
+        const char* directory;
+        volatile uint32_t count = 0;
+        int32_t highest = -1;
+};
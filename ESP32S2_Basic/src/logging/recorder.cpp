@@ -1,25 +1,40 @@
 
 #include "recorder.h"
+#include <TimeLib.h>
 
 bool Recorder::begin(){
 
     
     int32_t number = 0;
 
+    fsLock();
     if(!fatfs.chdir(directory)){
         console.error.print("[REC] Open directory failed"); console.error.println(directory);
         fatfs.mkdir(&directory[1]);
         console.log.println("[REC] Crating directory");
         if(!fatfs.chdir(directory)){
             console.error.println("[REC] Open directory failed");
+            fsUnlock();
             return false;
         }
     }
 
+    fsUnlock();
+
+    rebuildIndex = !index.begin();
+
+    // After the newest log, so the index stays ordered by number, gaps are only filled once the numbers run out
+    number = index.getHighest() + 1;
+    if(number >= LOG_INDEX_MAX_LOGS){
+        number = 0;
+    }
+    fsLock();
     do{
+        fileNumber = number;
         snprintf(fileName, 30, "log_%03d.csv", number);
         number++;
     } while(fatfs.exists(fileName));
+    fsUnlock();
 
     queue = xQueueCreate(10, sizeof(packedRXMessage));
     xTaskCreate(recordTask, "task_recorder", 4096, this, 1, NULL);
@@ -37,6 +52,20 @@ void Recorder::createFile() {
     }
     fileCreated = true;
     file.println("ts,state,errors,lat,lon,altitude,velocity,battery,pyro1,pyro2");
+
+    startTime = millis();
+    entry = {};
+    entry.number = fileNumber;
+    entry.date = (timeStatus() != timeNotSet) ? now() : 0;
+    entrySlot = index.append(entry);
+}
+
+void Recorder::updateEntry(const packedRXMessage& element){
+    if(entry.samples == 0 || element.altitude > entry.maxAltitude){
+        entry.maxAltitude = element.altitude;
+    }
+    entry.samples++;
+    entry.duration = (millis() - startTime) / 1000;
 }
 
 void Recorder::recordTask(void* pvParameter){
@@ -44,20 +73,33 @@ void Recorder::recordTask(void* pvParameter){
     char line [128];
     uint32_t count = 0;
     packedRXMessage element;
+
+    // Logs of an older firmware are indexed once, the Data page lists nothing until then
+    if(ref->rebuildIndex){
+        ref->index.rebuild();
+    }
+
     while(ref->initialized){
         if(xQueueReceive(ref->queue, &element, portMAX_DELAY) == pdPASS){
+            fsLock();
             if(!ref->fileCreated) {
                 ref->createFile();
             }
             snprintf(line, 128, "%d,%d,%d,%d,%d,%d,%d,%d,%d,%d", element.timestamp, element.state, element.errors,
             element.lat, element.lon, element.altitude, element.velocity, element.voltage, (bool)(element.pyro_continuity&0x01), (bool)(element.pyro_continuity & 0x02));
             ref->file.println(line);
+            ref->updateEntry(element);
             count++;
 
-            if(count == 10){
+            if(count == RECORDER_SYNC_INTERVAL){
                 count = 0;
                 ref->file.sync();
+                ref->entry.size = ref->file.fileSize();
+                if(ref->entrySlot >= 0){
+                    ref->index.update(ref->entrySlot, ref->entry);
+                }
             }
+            fsUnlock();
         }
     }
     vTaskDelete(NULL);
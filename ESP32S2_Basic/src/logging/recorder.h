@@ -3,12 +3,19 @@
 #include <Arduino.h>
 #include "telemetry/telemetryData.h"
 #include "utils.h"
+#include "logindex.h"
+
+#define RECORDER_SYNC_INTERVAL  10            // [#]    Records between file syncs and index updates
 
 class Recorder {
     public:
-        Recorder(const char* directory) : directory(directory) {}
+        Recorder(const char* directory) : directory(directory), index(directory) {}
         bool begin();
 
+        LogIndex& getIndex() {
+            return index;
+        }
+
         void enable(){
             enabled = true;
         }
@@ -31,11 +38,19 @@ class Recorder {
         const char* directory;
 
         char fileName [30] = {};
+        uint32_t fileNumber = 0;
+
+        LogIndex index;
+        bool rebuildIndex = false;
+        log_index_entry_t entry = {};
+        int32_t entrySlot = -1;
+        uint32_t startTime = 0;
 
         QueueHandle_t queue;
         File file;
 
         void createFile();
+        void updateEntry(const packedRXMessage& element);
 
         static void recordTask (void* pvParameter);
 };
\ No newline at end of file
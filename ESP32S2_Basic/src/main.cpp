@@ -34,18 +34,23 @@
 #include "console.h"
 #include "utils.h"
 #include "telemetry/telemetry.h"
+#include "telemetry/stream.h"
 #include "hmi/hmi.h"
 #include "logging/recorder.h"
+#include "logging/crashlog.h"
 #include "navigation.h"
+#include "power.h"
+#include "shell.h"
 
 
 Utils utils;
 Hmi hmi("/logs");
 
-Telemetry link1(Serial, 8, 9);
-Telemetry link2(Serial1, 11, 12);
+Telemetry link1(Serial, 8, 9, 0);
+Telemetry link2(Serial1, 11, 12, 1);
 
 Navigation navigation;
+Shell shell;
 
 void setup()
 {
@@ -59,20 +64,32 @@ void setup()
     console.error.println("[MAIN] Could not initialize utilities");
   }
 
+  if(crashLog.begin())
+  {
+    console.persistTo(&crashLog, Console::LEVEL_WARNING);
+  }
+
   systemConfig.load();
 
+  power.begin((power_mode_e)systemConfig.config.powerMode);
+
+  telemetryStream.begin();
+
   link1.begin();
   link2.begin();
 
   navigation.setPointA(47.236777221226646, 8.819492881367166);
-  navigation.setPointB(47.236777221226646, 8.819492881367166);
 
   hmi.begin();
+
+  shell.begin();
 }
 
 bool ini = false;
+uint32_t lastPacket[NAVIGATION_MAX_TARGETS] = {};
 void loop()
 { 
+  crashLog.heartbeat(HEARTBEAT_MAIN);
 
   if(millis() > 5000 && !ini)
   {
@@ -89,8 +106,22 @@ void loop()
     navigation.setPointA(link2.location.lat(), link2.location.lon());
   }
 
-  if(link1.data.lat() != 0 && link1.data.lon() != 0){
-    navigation.setPointB(link1.data.lat(), link1.data.lon());
+  // In DUAL mode every receiver tracks its own rocket, the altitude is above the launch site
+  Telemetry* links[NAVIGATION_MAX_TARGETS] = {&link1, &link2};
+  uint32_t targets = (systemConfig.config.receiverMode == DUAL) ? 2 : 1;
+  navigation.setTargetCount(targets);
+  for(uint32_t i = 0; i < targets; i++){
+    float lat, lon;
+    int32_t alt;
+    if(links[i]->data.getPosition(&lat, &lon, &alt)){
+      navigation.setTarget(i, lat, lon, alt);
+
+      // One ground track point per packet
+      if(links[i]->data.getLastUpdateTime() != lastPacket[i]){
+        lastPacket[i] = links[i]->data.getLastUpdateTime();
+        navigation.trackTarget(i, lat, lon, links[i]->data.inFlight());
+      }
+    }
   }
 
   delay(100);
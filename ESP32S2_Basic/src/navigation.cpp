@@ -1,5 +1,6 @@
 #include "navigation.h"
 #include "console.h"
+#include "logging/crashlog.h"
 
 #define NAVIGATION_TASK_FREQUENCY 50
 
@@ -14,7 +15,7 @@ bool Navigation::begin(){
     calibration = false;
     compass.setCalibration(-851, 2160, -1223, 1563, -1036, 1832);
 
-    xTaskCreate(navigationTask, "task_recorder", 1024, this, 1, NULL);
+    xTaskCreate(navigationTask, "task_navigation", 2048, this, 1, NULL);
     return true;
 }
 
@@ -41,9 +42,17 @@ void Navigation::navigationTask(void* pvParameter){
     uint32_t n = 0;
     int32_t currentAngle;
 
+    uint32_t imuErrors = 0;
+    uint32_t compassErrors = 0;
+    uint32_t updates = 0;
+    uint32_t rate = 0;
+    TickType_t rateStart = task_last_tick;
+    float field = 0;
+    float fieldSquare = 0;
 
     while(ref->initialized){
-        ref->compass.read();
+        ref->cpuLock.acquire();
+        if(!ref->compass.read()) compassErrors++;
         
         if(ref->calibration){
             ref->compass.readRaw(ref->m);
@@ -51,13 +60,30 @@ void Navigation::navigationTask(void* pvParameter){
             ref->compass.readCalibrated(ref->m);
         }
         
-        
-        ref->imu.readAcceleration(ref->ax, ref->ay, ref->az);
-        ref->imu.readGyroscope(ref->gx, ref->gy, ref->gz);
+        // A failed read returns NAN, which would stick in the filter state
+        float ax, ay, az, gx, gy, gz;
+        bool imuValid = ref->imu.readAcceleration(ax, ay, az) && ref->imu.readGyroscope(gx, gy, gz);
+        if(imuValid){
+            ref->ax = ax; ref->ay = ay; ref->az = az;
+            ref->gx = gx; ref->gy = gy; ref->gz = gz;
+
+            ref->filter.update(ref->gy, ref->gx, -ref->gz, ref->ay, ref->ax, -ref->az, -ref->m[0], ref->m[1], -ref->m[2]);
+            ref->filter.getQuaternion(&ref->q0, &ref->q1, &ref->q2, &ref->q3);
+            updates++;
+        } else {
+            imuErrors++;
+        }
 
-        ref->filter.update(ref->gy, ref->gx, -ref->gz, ref->ay, ref->ax, -ref->az, -ref->m[0], ref->m[1], -ref->m[2]);
+        float magnitude = sqrtf(ref->m[0] * ref->m[0] + ref->m[1] * ref->m[1] + ref->m[2] * ref->m[2]);
+        field += (magnitude - field) / NAVIGATION_FIELD_WEIGHT;
+        fieldSquare += (magnitude * magnitude - fieldSquare) / NAVIGATION_FIELD_WEIGHT;
 
-        ref->filter.getQuaternion(&ref->q0, &ref->q1, &ref->q2, &ref->q3);
+        if(xTaskGetTickCount() - rateStart >= pdMS_TO_TICKS(1000)){
+            rate = updates;
+            updates = 0;
+            rateStart += pdMS_TO_TICKS(1000);
+        }
+        ref->publish(field, fieldSquare, rate, imuErrors, compassErrors);
 
         if(ref->calibration){
             for (int i = 0; i < 3; i++) {
@@ -111,28 +137,137 @@ void Navigation::navigationTask(void* pvParameter){
         console.log.print(" q3 "); console.log.println(ref->q3);
         */
         if(count >= 10){
-            if(ref->pointA.lat != 0 && ref->pointA.lon != 0 && ref->pointB.lat != 0 && ref->pointB.lon != 0) {
-                ref->calculateDistanceDirection();
+            if(ref->calculateDistanceDirection()){
                 ref->updated = true;
             }
             count = 0;
         }
         count++;
         
+        crashLog.heartbeat(HEARTBEAT_NAVIGATION);
+        ref->cpuLock.release();
         vTaskDelayUntil(&task_last_tick, (const TickType_t) 1000 / NAVIGATION_TASK_FREQUENCY);
     }
     vTaskDelete(NULL);
 }
 
-void Navigation::calculateDistanceDirection(){
-    float dy_dphi = (2*R*PI)/(2*PI);
-    float dx_dtheta = cos(pointA.lat*(PI/180))  * (2*R*PI)/(2*PI);
+/* Called by the navigation task once per cycle, readers copy the snapshot under the same lock */
+void Navigation::publish(float field, float fieldSquare, uint32_t rate, uint32_t imuErrors, uint32_t compassErrors){
+    navigation_snapshot_t next;
+    next.ax = ax; next.ay = ay; next.az = az;
+    next.gx = gx; next.gy = gy; next.gz = gz;
+    next.mx = m[0]; next.my = m[1]; next.mz = m[2];
+    next.roll = filter.getRollRadians();
+    next.pitch = filter.getPitchRadians();
+    next.yaw = filter.getYawRadians();
+    next.field = field;
+    next.fieldSpread = (field > 0) ? sqrtf(max(fieldSquare - field * field, 0.0f)) / field * 100 : 0;
+    next.rate = rate;
+    next.imuErrors = imuErrors;
+    next.compassErrors = compassErrors;
+    next.calibrating = calibration;
+
+    portENTER_CRITICAL(&lock);
+    snapshot = next;
+    portEXIT_CRITICAL(&lock);
+}
+
+void Navigation::setPointA(float lat, float lon, float height){
+    float perLon = cosf(lat * (PI / 180)) * R * (PI / 180);
+
+    portENTER_CRITICAL(&lock);
+    pointA = EarthPoint3D(lat, lon, height);
+    metersPerLat = R * (PI / 180);
+    metersPerLon = perLon;
+    portEXIT_CRITICAL(&lock);
+}
+
+void Navigation::setTarget(uint32_t index, float lat, float lon, float alt){
+    if(index >= NAVIGATION_MAX_TARGETS) return;
+
+    portENTER_CRITICAL(&lock);
+    targets[index].lat = lat;
+    targets[index].lon = lon;
+    targets[index].alt = alt;
+    targets[index].valid = true;
+    portEXIT_CRITICAL(&lock);
+}
+
+void Navigation::clearTarget(uint32_t index){
+    if(index >= NAVIGATION_MAX_TARGETS) return;
+
+    portENTER_CRITICAL(&lock);
+    targets[index] = navigation_target_t();
+    portEXIT_CRITICAL(&lock);
+}
 
-    float dy = (pointB.lat - pointA.lat)*(PI/180) * dy_dphi;
-    float dx = (pointB.lon - pointA.lon)*(PI/180) * dx_dtheta;
-    float dz = pointB.alt-pointA.alt;
+void Navigation::trackTarget(uint32_t index, float lat, float lon, bool flight){
+    if(index >= NAVIGATION_MAX_TARGETS) return;
 
-    dist = sqrt(dx*dx + dy*dy + dz*dz);
-    azimuth = atan2(dx, dy);
-    elevation = atan2(dz, sqrt(dx*dx+dy*dy));
+    if(flight && !flying[index]){
+        tracks[index].clear();
+    }
+    flying[index] = flight;
+    if(flight){
+        tracks[index].add(lat, lon);
+    }
+}
+
+void Navigation::setTargetCount(uint32_t count){
+    count = constrain(count, (uint32_t) 1, (uint32_t) NAVIGATION_MAX_TARGETS);
+
+    portENTER_CRITICAL(&lock);
+    targetCount = count;
+    for(uint32_t i = count; i < NAVIGATION_MAX_TARGETS; i++){
+        targets[i] = navigation_target_t();
+    }
+    portEXIT_CRITICAL(&lock);
+}
+
+/*
+ * Local flat earth approximation around the station, good for the few km of a
+ * recovery. All targets are solved from one copy of the station and its
+ * meters per degree, so only the atan2 and sqrt terms remain per target.
+ * Returns true if at least one target was solved.
+ */
+bool Navigation::calculateDistanceDirection(){
+    navigation_target_t next[NAVIGATION_MAX_TARGETS];
+
+    portENTER_CRITICAL(&lock);
+    EarthPoint3D station = pointA;
+    float perLat = metersPerLat;
+    float perLon = metersPerLon;
+    uint32_t count = targetCount;
+    memcpy(next, targets, sizeof(next));
+    portEXIT_CRITICAL(&lock);
+
+    bool located = station.lat != 0 && station.lon != 0;
+    bool solved = false;
+    for(uint32_t i = 0; i < count; i++){
+        navigation_target_t* target = &next[i];
+        target->solved = located && target->valid;
+        if(!target->solved) continue;
+
+        float dy = (target->lat - station.lat) * perLat;
+        float dx = (target->lon - station.lon) * perLon;
+        float dz = target->alt - station.alt;
+        float horizontal = dx * dx + dy * dy;
+
+        target->distance = sqrtf(horizontal + dz * dz);
+        target->azimuth = atan2f(dx, dy);
+        target->elevation = atan2f(dz, sqrtf(horizontal));
+        solved = true;
+    }
+
+    // Only the results are written back, the positions may have changed in the meantime
+    portENTER_CRITICAL(&lock);
+    for(uint32_t i = 0; i < count; i++){
+        if(!targets[i].valid) continue;
+        targets[i].distance = next[i].distance;
+        targets[i].azimuth = next[i].azimuth;
+        targets[i].elevation = next[i].elevation;
+        targets[i].solved = next[i].solved;
+    }
+    portEXIT_CRITICAL(&lock);
+    return solved;
 }
@@ -7,6 +7,8 @@
 #include <LSM6DS3.h>
 #include <Wire.h>
 #include <MadgwickAHRS.h>
+#include "power.h"
+#include "groundtrack.h"
 
 const float R = 6378100.0f; // Earth radius in m (zero tide radius IAU)
 const float C = 40075017.0f; // Earth circumference in m
@@ -17,15 +19,6 @@ class EarthPoint3D{
         //Point3D(float x, float y) : x(x), y(y), z(0) { }
         EarthPoint3D(float lat = 0, float lon = 0, float alt = 0) : lat(lat), lon(lon), alt(alt) { }
 
-        EarthPoint3D operator= (EarthPoint3D const &other){
-            // Guard self assignment
-            if(this == &other) return *this;
-            lat = other.lat;
-            lon = other.lon;
-            alt = other.alt;
-            return *this;
-        }
-
         EarthPoint3D deg(){
             return *this;
         }
@@ -52,31 +45,81 @@ class EarthPoint3D{
         
 };
 
+#define NAVIGATION_FIELD_WEIGHT 64      // [#]    Samples of the moving average of the field magnitude
+#define NAVIGATION_MAX_TARGETS  2       // [#]    One rocket per receiver in DUAL mode
+
+/* Position of a rocket and its direction seen from the station, the results are 0 until both are located */
+typedef struct {
+    float lat, lon;                     // [deg]
+    float alt;                          // [m]    Above the station
+    float distance;                     // [m]
+    float azimuth;                      // [rad]  From north, clockwise
+    float elevation;                    // [rad]
+    bool valid;                         // Target located
+    bool solved;                        // Target and station located, results are current
+} navigation_target_t;
+
+/* Consistent copy of the sensor readings and filter output of one navigation cycle */
+typedef struct {
+    float ax, ay, az;                   // [g]
+    float gx, gy, gz;                   // [dps]
+    float mx, my, mz;                   // [LSB]  Calibrated, raw while calibrating
+    float roll, pitch, yaw;             // [rad]
+    float field;                        // [LSB]  Mean magnitude of the magnetic field
+    float fieldSpread;                  // [%]    Standard deviation of the magnitude, small if the calibration fits
+    uint32_t rate;                      // [Hz]   Filter updates in the last second
+    uint32_t imuErrors;                 // [#]    Failed I2C reads since boot
+    uint32_t compassErrors;             // [#]
+    bool calibrating;
+} navigation_snapshot_t;
+
+/* Consistent copy of what the recovery page shows, taken by the HMI task for the render task */
+typedef struct {
+    EarthPoint3D station;
+    float north;                        // [rad]  Heading of the filter
+    navigation_target_t targets[NAVIGATION_MAX_TARGETS];
+    uint32_t count;                     // [#]
+    uint32_t selected;                  // Target of the track, below count
+    track_snapshot_t track;
+} recovery_snapshot_t;
+
 class Navigation {
     public:
 
     bool begin();
 
+    /* Station position, the terms shared by all targets are only recomputed here */
     void setPointA(EarthPoint3D point){
-        pointA = point;
-    }
-    void setPointA(float lat, float lon, float height = 0){
-        pointA = EarthPoint3D(lat, lon, height);
+        setPointA(point.lat, point.lon, point.alt);
     }
+    void setPointA(float lat, float lon, float height = 0);
 
-    void setPointB(EarthPoint3D point){
-        pointB = point;
+    inline EarthPoint3D getPointA() const {
+        return pointA;
     }
-    void setPointB(float lat, float lon, float height = 0){
-        pointB = EarthPoint3D(lat, lon, height);
+
+    void setTarget(uint32_t index, float lat, float lon, float alt = 0);
+    void clearTarget(uint32_t index);
+
+    /* Targets beyond the count are cleared, 1 in SINGLE and 2 in DUAL mode */
+    void setTargetCount(uint32_t count);
+
+    inline uint32_t getTargetCount() const {
+        return targetCount;
     }
 
-    inline EarthPoint3D getPointA() const {
-        return pointA;
+    /* New packet of the target, its ground track starts over at launch and grows while in flight */
+    void trackTarget(uint32_t index, float lat, float lon, bool flight);
+
+    void getTrack(uint32_t index, track_snapshot_t* snapshot){
+        tracks[index].getSnapshot(snapshot);
     }
 
-    inline EarthPoint3D getPointB() const{
-        return pointB;
+    /* Copy of the target with the results of the last navigation cycle */
+    void getTarget(uint32_t index, navigation_target_t* target){
+        portENTER_CRITICAL(&lock);
+        *target = targets[index];
+        portEXIT_CRITICAL(&lock);
     }
 
     inline float getNorth(){
@@ -130,31 +173,35 @@ class Navigation {
         return m[2];
     }
 
-    inline bool isUpdated() const {
-        return updated;
+    /* All values of the same cycle, unlike the single getters */
+    void getSnapshot(navigation_snapshot_t* snapshot){
+        portENTER_CRITICAL(&lock);
+        *snapshot = this->snapshot;
+        portEXIT_CRITICAL(&lock);
     }
 
-    inline float getDistance() {
-        updated = false;
-        return dist;
+    /* Station, heading and targets of the same cycle, and the track of the selected target */
+    void getRecoverySnapshot(uint32_t selected, recovery_snapshot_t* recovery){
+        portENTER_CRITICAL(&lock);
+        recovery->station = pointA;
+        recovery->north = snapshot.yaw;
+        recovery->count = targetCount;
+        memcpy(recovery->targets, targets, sizeof(recovery->targets));
+        portEXIT_CRITICAL(&lock);
+        recovery->selected = min(selected, recovery->count - 1);
+        tracks[recovery->selected].getSnapshot(&recovery->track);
     }
 
-    inline float getAzimuth() {
-        updated = false;
-        return azimuth;
-    }
-
-    inline float getElevation() {
-        updated = false;
-        return elevation;
+    inline bool isUpdated() const {
+        return updated;
     }
 
-    
     void print() {
         console.log.println("Point A:");
         pointA.print();
-        console.log.println("Point B:");
-        pointB.print();
+        for(uint32_t i = 0; i < targetCount; i++){
+            console.log.printf("Target %u: %.4f %.4f %.0fm\n", i + 1, targets[i].lat, targets[i].lon, targets[i].distance);
+        }
     }
 
     private:
@@ -163,7 +210,14 @@ class Navigation {
         bool calibration = false;
 
         EarthPoint3D pointA;
-        EarthPoint3D pointB;
+        float metersPerLat = 0;         // [m/deg]
+        float metersPerLon = 0;         // [m/deg] Shrinks with the cosine of the station latitude
+
+        navigation_target_t targets[NAVIGATION_MAX_TARGETS] = {};
+        uint32_t targetCount = 1;
+
+        GroundTrack tracks[NAVIGATION_MAX_TARGETS];
+        bool flying[NAVIGATION_MAX_TARGETS] = {};
 
         QMC5883LCompass compass;
         LSM6DS3Class imu;
@@ -175,9 +229,13 @@ class Navigation {
 
         float q0, q1, q2, q3;
 
-        float dist, azimuth, elevation;
+        portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+        navigation_snapshot_t snapshot = {};
+
+        PowerLock cpuLock = PowerLock("navigation");
 
         static void navigationTask (void* pvParameter);
-        void calculateDistanceDirection();
+        bool calculateDistanceDirection();
+        void publish(float field, float fieldSquare, uint32_t rate, uint32_t imuErrors, uint32_t compassErrors);
 
 };
\ No newline at end of file
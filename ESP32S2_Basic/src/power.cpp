@@ -0,0 +1,138 @@
+#include "power.h"
+#include "console.h"
+
+static portMUX_TYPE heldLock = portMUX_INITIALIZER_UNLOCKED;
+
+/* The ESP-IDF lock is created on first use, after the power manager has been configured */
+void PowerLock::acquire(){
+    if(!registered){
+        registered = true;
+#ifdef CONFIG_PM_ENABLE
+        if(esp_pm_lock_create(type, 0, name, &handle) != ESP_OK){
+            handle = NULL;
+            console.error.printf("[POWER] Could not create lock %s\n", name);
+        }
+#endif
+        power.add(this);
+    }
+
+#ifdef CONFIG_PM_ENABLE
+    if(handle) esp_pm_lock_acquire(handle);
+#endif
+    portENTER_CRITICAL(&heldLock);
+    start = micros();
+    held = true;
+    portEXIT_CRITICAL(&heldLock);
+}
+
+void PowerLock::release(){
+    if(!held) return;
+
+    portENTER_CRITICAL(&heldLock);
+    heldTime += micros() - start;
+    held = false;
+    portEXIT_CRITICAL(&heldLock);
+#ifdef CONFIG_PM_ENABLE
+    if(handle) esp_pm_lock_release(handle);
+#endif
+}
+
+uint64_t PowerLock::getHeldTime() const {
+    portENTER_CRITICAL(&heldLock);
+    uint64_t time = heldTime + (held ? (uint32_t)(micros() - start) : 0);
+    portEXIT_CRITICAL(&heldLock);
+    return time;
+}
+
+bool Power::begin(power_mode_e mode){
+    lastSample = millis();
+    return setMode(mode);
+}
+
+bool Power::hasFrequencyScaling() const {
+#ifdef CONFIG_PM_ENABLE
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool Power::hasLightSleep() const {
+#if defined(CONFIG_PM_ENABLE) && defined(CONFIG_FREERTOS_USE_TICKLESS_IDLE)
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool Power::setMode(power_mode_e mode){
+    if(mode >= POWER_MODE_COUNT) mode = POWER_PERFORMANCE;
+    bool economy = (mode == POWER_ECONOMY);
+
+#ifdef CONFIG_PM_ENABLE
+    esp_pm_config_esp32s2_t config = {};
+    config.max_freq_mhz = POWER_MAX_FREQ;
+    config.min_freq_mhz = economy ? POWER_MIN_FREQ : POWER_MAX_FREQ;
+    config.light_sleep_enable = economy && hasLightSleep();
+    esp_err_t err = esp_pm_configure(&config);
+    if(err != ESP_OK){
+        console.error.printf("[POWER] Could not configure power management: %d\n", err);
+        return false;
+    }
+#else
+    if(!setCpuFrequencyMhz(economy ? POWER_MIN_FREQ : POWER_MAX_FREQ)){
+        console.error.println("[POWER] Could not set CPU frequency");
+        return false;
+    }
+#endif
+
+    this->mode = mode;
+    console.ok.printf("[POWER] %s mode, %s, light sleep %s\n", economy ? "Economy" : "Performance",
+                      hasFrequencyScaling() ? "frequency scaling" : "fixed frequency",
+                      (economy && hasLightSleep()) ? "on" : "off");
+    return true;
+}
+
+float Power::sampleBattery(bool usb){
+    float sample = analogRead(POWER_BATTERY_PIN) * POWER_BATTERY_SCALE;
+    uint32_t now = millis();
+    uint32_t seconds = (now - lastSample) / 1000;
+
+    if(usb && !usbLock.isHeld()){
+        usbLock.acquire();
+    } else if(!usb && usbLock.isHeld()){
+        usbLock.release();
+    }
+
+    // The first sample after a USB disconnect only restarts the average, the charger lifts the voltage
+    float previous = voltage;
+    if(!onBattery || voltage == 0){
+        voltage = sample;
+    } else {
+        voltage += (sample - voltage) / POWER_BATTERY_WEIGHT;
+    }
+
+    if(seconds > 0){
+        if(onBattery && !usb){
+            stats[mode].time += seconds;
+            stats[mode].drop += previous - voltage;
+        }
+        lastSample += seconds * 1000;
+    }
+    onBattery = !usb;
+    return sample;
+}
+
+void Power::resetStats(){
+    memset(stats, 0, sizeof(stats));
+}
+
+void Power::add(PowerLock* powerLock){
+    portENTER_CRITICAL(&lock);
+    if(lockCount < POWER_MAX_LOCKS){
+        locks[lockCount++] = powerLock;
+    }
+    portEXIT_CRITICAL(&lock);
+}
+
+Power power;
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <Arduino.h>
+#include "esp_pm.h"
+
+#define POWER_MAX_FREQ          240             // [MHz]
+#define POWER_MIN_FREQ          80              // [MHz]  Lowest frequency that keeps the APB, USB, UART and SPI at 80 MHz
+#define POWER_MAX_LOCKS         8               // [#]    Locks listed by the statistics
+#define POWER_BATTERY_PIN       18
+#define POWER_BATTERY_SCALE     0.00059154929f  // [V]    Per ADC count, including the divider
+#define POWER_BATTERY_WEIGHT    16              // [#]    Samples of the moving average of the battery voltage
+
+typedef enum : uint8_t {
+    POWER_PERFORMANCE = 0,                      // Fixed at the maximum frequency
+    POWER_ECONOMY = 1,                          // Frequency scaling, light sleep in idle if the SDK has tickless idle
+    POWER_MODE_COUNT,
+} power_mode_e;
+
+typedef struct {
+    uint32_t time;                              // [s]    On battery in this mode
+    float drop;                                 // [V]    Battery voltage drop while on battery
+} power_mode_stats_t;
+
+/*
+ * Keeps the CPU at the maximum frequency (ESP_PM_CPU_FREQ_MAX) or the chip
+ * out of light sleep (ESP_PM_NO_LIGHT_SLEEP) while held. Tasks take their
+ * frequency lock only around actual work, not around their delays, so the
+ * power manager can clock down between the periodic wake ups. The held time
+ * is accumulated for the statistics.
+ */
+class PowerLock {
+    public:
+        PowerLock(const char* name, esp_pm_lock_type_t type = ESP_PM_CPU_FREQ_MAX) : name(name), type(type) {}
+
+        void acquire();
+        void release();
+
+        bool isHeld() const {
+            return held;
+        }
+
+        const char* getName() const {
+            return name;
+        }
+
+        /* [us] Total time held, including the current hold */
+        uint64_t getHeldTime() const;
+
+    private:
+        const char* name;
+        const esp_pm_lock_type_t type;
+        esp_pm_lock_handle_t handle = NULL;
+        bool registered = false;
+        volatile bool held = false;
+        uint32_t start = 0;
+        uint64_t heldTime = 0;
+};
+
+/*
+ * Power mode of the station. With CONFIG_PM_ENABLE in the SDK the ESP-IDF
+ * power manager scales the CPU between POWER_MIN_FREQ and POWER_MAX_FREQ
+ * according to the PowerLocks, and enters light sleep in the FreeRTOS
+ * idle hook if CONFIG_FREERTOS_USE_TICKLESS_IDLE is set as well. Without
+ * it the economy mode runs at a fixed POWER_MIN_FREQ and the locks only
+ * count their held time.
+ *
+ * The battery voltage drop is accumulated per mode while not on USB, as
+ * the board has no current sensor this is the measure to compare modes.
+ */
+class Power {
+    public:
+        bool begin(power_mode_e mode);
+        bool setMode(power_mode_e mode);
+
+        power_mode_e getMode() const {
+            return mode;
+        }
+
+        bool hasFrequencyScaling() const;
+        bool hasLightSleep() const;
+
+        /* Called about once per second, returns the battery voltage */
+        float sampleBattery(bool usb);
+
+        const power_mode_stats_t& getStats(power_mode_e mode) const {
+            return stats[mode];
+        }
+
+        uint32_t getLockCount() const {
+            return lockCount;
+        }
+
+        const PowerLock* getLock(uint32_t index) const {
+            return locks[index];
+        }
+
+        void resetStats();
+        void add(PowerLock* lock);
+
+    private:
+        power_mode_e mode = POWER_PERFORMANCE;
+
+        // Light sleep would stop the USB connection
+        PowerLock usbLock = PowerLock("usb", ESP_PM_NO_LIGHT_SLEEP);
+
+        power_mode_stats_t stats[POWER_MODE_COUNT] = {};
+        float voltage = 0;
+        bool onBattery = false;
+        uint32_t lastSample = 0;
+
+        portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+        PowerLock* locks[POWER_MAX_LOCKS] = {};
+        uint32_t lockCount = 0;
+};
+
+extern Power power;
@@ -0,0 +1,508 @@
+#include "shell.h"
+#include "esp_timer.h"
+#include "console.h"
+#include "utils.h"
+#include "config.h"
+#include "hmi/settings.h"
+#include "hmi/hmi.h"
+#include "telemetry/telemetry.h"
+#include "telemetry/stream.h"
+#include "telemetry/crc.h"
+#include "logging/crashlog.h"
+#include "power.h"
+
+#define SHELL_MAX_TASKS         24            // [#]    Maximum number of tasks listed by 'tasks'
+#define SHELL_LOG_DIRECTORY     "/logs"
+
+extern Telemetry link1;
+extern Telemetry link2;
+extern Hmi hmi;
+
+bool Shell::begin(){
+    initialized = true;
+    xTaskCreate(shellTask, "task_shell", 4096, this, 1, NULL);
+    return true;
+}
+
+void Shell::shellTask(void* pvParameter){
+    Shell* ref = (Shell*)pvParameter;
+
+    while(ref->initialized){
+        TickType_t task_last_tick = xTaskGetTickCount();
+
+        while(console.available() > 0){
+            ref->process((char)console.read());
+        }
+
+        vTaskDelayUntil(&task_last_tick, (const TickType_t) 1000 / SHELL_TASK_FREQ);
+    }
+    vTaskDelete(NULL);
+}
+
+void Shell::process(char ch){
+    bool echo = !console.isBinaryMode();
+
+    if(ch == '\r' || ch == '\n'){
+        if(lineIndex == 0) return;
+        if(echo) console.println();
+        line[lineIndex] = 0;
+        execute();
+        lineIndex = 0;
+        printPrompt();
+    } else if(ch == '\b' || ch == 0x7F){
+        if(lineIndex > 0){
+            lineIndex--;
+            if(echo) console.print("\b \b");
+        }
+    } else if(ch >= ' ' && ch <= '~' && lineIndex < SHELL_LINE_LENGTH){
+        line[lineIndex++] = ch;
+        if(echo) console.write((uint8_t)ch);
+    }
+}
+
+void Shell::printPrompt(){
+    if(!console.isBinaryMode()) console.print("> ");
+}
+
+void Shell::execute(){
+    char* argv[SHELL_MAX_ARGS + 1];
+    uint32_t argc = 0;
+    char* save = NULL;
+
+    char* command = strtok_r(line, " ", &save);
+    if(command == NULL) return;
+
+    char* token;
+    while(argc < SHELL_MAX_ARGS && (token = strtok_r(NULL, " ", &save)) != NULL){
+        argv[argc++] = token;
+    }
+    argv[argc] = NULL;
+
+    for(uint32_t i = 0; i < ARRAYLEN(commandTable); i++){
+        if(strcmp(command, commandTable[i].name) == 0){
+            (this->*commandTable[i].function)(argc, argv);
+            return;
+        }
+    }
+    console.printf("Unknown command '%s', type 'help'\n", command);
+}
+
+void Shell::cmdHelp(uint32_t argc, char** argv){
+    for(uint32_t i = 0; i < ARRAYLEN(commandTable); i++){
+        console.printf("%-7s %-26s %s\n", commandTable[i].name, commandTable[i].usage, commandTable[i].description);
+    }
+}
+
+void Shell::cmdStats(uint32_t argc, char** argv){
+    console.printf("Uptime       %lu s\n", millis() / 1000);
+    console.printf("Heap         %u B free, %u B minimum\n", ESP.getFreeHeap(), ESP.getMinFreeHeap());
+    console.printf("PSRAM        %u B free\n", ESP.getFreePsram());
+    console.printf("Link 1       %u frames, %u CRC errors\n", link1.getFrameCount(), link1.getCrcErrorCount());
+    console.printf("Link 2       %u frames, %u CRC errors\n", link2.getFrameCount(), link2.getCrcErrorCount());
+    console.printf("Console      %u B sent, %u B overwritten, %u FIFO stalls\n", console.getTxBytes(), console.getOverwrittenBytes(), console.getTxStalls());
+    console.printf("Crash log    %u B written this boot, %u B dropped\n", crashLog.getWrittenBytes(), crashLog.getDroppedBytes());
+    console.printf("Display      %u fps, %u us SPI/s, %u B/s\n", hmi.getWindow().getFrameRate(), hmi.getWindow().getSpiTimePerSecond(), hmi.getWindow().getSpiBytesPerSecond());
+    console.printf("Live page    %u us render time of the last packet\n", hmi.getWindow().getLiveRenderTime());
+    console.printf("Stream       %u records sent, %u dropped\n", telemetryStream.getSentCount(), telemetryStream.getDroppedCount());
+}
+
+void Shell::cmdTasks(uint32_t argc, char** argv){
+#if configUSE_TRACE_FACILITY
+    static TaskStatus_t tasks[SHELL_MAX_TASKS];
+    const char stateName[] = {'X', 'R', 'B', 'S', 'D', '?'};     // Running, Ready, Blocked, Suspended, Deleted
+
+    UBaseType_t count = uxTaskGetSystemState(tasks, SHELL_MAX_TASKS, NULL);
+    console.printf("%-20s %s %4s %10s\n", "Name", "S", "Prio", "Stack free");
+    for(UBaseType_t i = 0; i < count; i++){
+        console.printf("%-20s %c %4u %10u\n", tasks[i].pcTaskName, stateName[min((uint32_t) tasks[i].eCurrentState, (uint32_t) 5)],
+                       tasks[i].uxCurrentPriority, tasks[i].usStackHighWaterMark);
+    }
+#else
+    console.println("Task list not available, configUSE_TRACE_FACILITY is disabled");
+#endif
+}
+
+void Shell::cmdLinks(uint32_t argc, char** argv){
+    Telemetry* links[2] = {&link1, &link2};
+    for(uint32_t i = 0; i < 2; i++){
+        TelemetryInfoData info = links[i]->info.peek();
+        uint32_t age = millis() - links[i]->info.getLastUpdateTime();
+        console.printf("Link %u  age %5.1f s  LQ %3u  RSSI %4d  SNR %3d  state %u\n", i + 1, age / 1000.0f,
+                       info.lq, info.rssi, info.snr, links[i]->data.rxData.state);
+    }
+}
+
+/* Setting names match ignoring case, spaces and underscores ("link_phrase_1" == "Link Phrase 1") */
+static bool matchSettingName(const char* setting, const char* name){
+    while(true){
+        while(*setting == ' ' || *setting == '_') setting++;
+        while(*name == ' ' || *name == '_') name++;
+        if(tolower(*setting) != tolower(*name)) return false;
+        if(*setting == 0) return true;
+        setting++;
+        name++;
+    }
+}
+
+static const device_settings_t* findSetting(const char* name){
+    for(uint32_t page = 0; page < ARRAYLEN(settingsTableValueCount); page++){
+        for(uint32_t i = 0; i < settingsTableValueCount[page]; i++){
+            if(matchSettingName(settingsTable[page][i].name, name)){
+                return &settingsTable[page][i];
+            }
+        }
+    }
+    return NULL;
+}
+
+static void printSetting(const device_settings_t* setting){
+    console.printf("%-16s ", setting->name);
+    if(setting->type == STRING){
+        console.printf("\"%s\"\n", (const char*)setting->dataPtr);
+    } else if(setting->type == TOGGLE){
+        console.println(lookup_tables[setting->config.lookup].values[*(bool*)setting->dataPtr]);
+    } else if(setting->type == NUMBER){
+        console.printf("%d\n", *(int16_t*)setting->dataPtr);
+    }
+}
+
+void Shell::cmdConfig(uint32_t argc, char** argv){
+    if(argc >= 1 && strcmp(argv[0], "get") == 0){
+        configGet(argc >= 2 ? argv[1] : NULL);
+    } else if(argc >= 3 && strcmp(argv[0], "set") == 0){
+        configSet(argv[1], argv[2]);
+    } else {
+        console.println("Usage: config get [name] | config set <name> <value>");
+    }
+}
+
+void Shell::configGet(const char* name){
+    if(name == NULL){
+        for(uint32_t page = 0; page < ARRAYLEN(settingsTableValueCount); page++){
+            for(uint32_t i = 0; i < settingsTableValueCount[page]; i++){
+                printSetting(&settingsTable[page][i]);
+            }
+        }
+        return;
+    }
+
+    const device_settings_t* setting = findSetting(name);
+    if(setting == NULL){
+        console.printf("Unknown setting '%s'\n", name);
+        return;
+    }
+    printSetting(setting);
+}
+
+/* The value is checked here, written and applied by the HMI task */
+void Shell::configSet(const char* name, const char* value){
+    const device_settings_t* setting = findSetting(name);
+    if(setting == NULL){
+        console.printf("Unknown setting '%s'\n", name);
+        return;
+    }
+
+    settings_value_u next = {};
+    if(setting->type == STRING){
+        uint32_t length = strlen(value);
+        if(length > setting->config.stringLength){
+            console.printf("Value too long, maximum %u characters\n", setting->config.stringLength);
+            return;
+        }
+        memcpy(next.text, value, length);
+    } else if(setting->type == TOGGLE){
+        const lookup_table_entry_t* table = &lookup_tables[setting->config.lookup];
+        int32_t index = -1;
+        for(uint32_t i = 0; i < table->value_count; i++){
+            if(strcasecmp(table->values[i], value) == 0) index = i;
+        }
+        if(index < 0){
+            console.printf("Invalid value, use %s or %s\n", table->values[0], table->values[1]);
+            return;
+        }
+        next.toggle = index;
+    } else if(setting->type == NUMBER){
+        char* end;
+        long number = strtol(value, &end, 10);
+        if(*end != 0 || number < setting->config.minmax.min || number > setting->config.minmax.max){
+            console.printf("Invalid value, range is %d to %d\n", setting->config.minmax.min, setting->config.minmax.max);
+            return;
+        }
+        next.number = number;
+    }
+
+    if(!hmi.changeSetting(setting, next)){
+        console.println("Setting not applied, the HMI task did not respond");
+        return;
+    }
+    printSetting(setting);
+}
+
+void Shell::cmdLog(uint32_t argc, char** argv){
+    if(argc >= 1 && strcmp(argv[0], "ls") == 0){
+        logList();
+    } else if(argc >= 2 && strcmp(argv[0], "dump") == 0){
+        logDump(atoi(argv[1]));
+    } else {
+        console.println("Usage: log ls | log dump <n>");
+    }
+}
+
+void Shell::logList(){
+    char name[32];
+    uint32_t count = 0;
+
+    fsLock();
+    File dir = fatfs.open(SHELL_LOG_DIRECTORY);
+    if(!dir || !dir.isDir()){
+        fsUnlock();
+        console.println("No log directory");
+        return;
+    }
+    File entry;
+    while(entry.openNext(&dir, O_RDONLY)){
+        if(!entry.isDir()){
+            entry.getName(name, sizeof(name));
+            console.printf("%-16s %8u B\n", name, entry.fileSize());
+            count++;
+        }
+        entry.close();
+    }
+    dir.close();
+    fsUnlock();
+    console.printf("%u files\n", count);
+}
+
+/*
+ * Streams the raw file through the console as
+ *
+ *   DUMP <size> <path>\n <size bytes> END <sent> <crc32>\n
+ *
+ * with the CRC32 of crc.cpp in hex. The shell owns the console for the whole
+ * dump, the text of the other tasks is dropped until the trailer is sent. If
+ * the file cannot be read to the end, the rest is padded with zeros, so the
+ * trailer always follows after <size> bytes and <sent> tells the host. The
+ * file system stays mounted and visible over MSC.
+ */
+void Shell::logDump(int32_t number){
+    char path[40];
+    uint8_t buffer[SHELL_DUMP_CHUNK_SIZE];
+
+    snprintf(path, sizeof(path), SHELL_LOG_DIRECTORY "/log_%03d.csv", number);
+
+    fsLock();
+    File file = fatfs.open(path, FILE_READ);
+    uint32_t size = file ? file.fileSize() : 0;
+    fsUnlock();
+    if(!file){
+        console.printf("Could not open %s\n", path);
+        return;
+    }
+    if(!console.claim()){
+        console.println("Console busy, switch the stream off first");
+        fsLock();
+        file.close();
+        fsUnlock();
+        return;
+    }
+
+    console.printf("DUMP %u %s\n", size, path);
+    uint32_t sent = 0, written = 0, crc = 0;
+    while(written < size && console && !console.isBinaryMode()){
+        if(console.availableForWrite() < SHELL_DUMP_CHUNK_SIZE){
+            vTaskDelay(1);                      // Wait until the console task made room in the ring buffer
+            continue;
+        }
+        uint32_t length = min(size - written, (uint32_t) sizeof(buffer));
+        int count = 0;
+        if(sent == written){
+            fsLock();
+            count = file.read(buffer, length);
+            fsUnlock();
+        }
+        if(count > 0){
+            length = count;
+            crc = crc32(buffer, length, crc);
+            sent += length;
+        } else {
+            memset(buffer, 0, length);
+        }
+        console.write(buffer, length);
+        written += length;
+    }
+
+    fsLock();
+    file.close();
+    fsUnlock();
+    console.printf("END %u %08x\n", sent, crc);
+    console.release();
+}
+
+void Shell::cmdStream(uint32_t argc, char** argv){
+    if(argc >= 1 && strcmp(argv[0], "on") == 0){
+        telemetryStream.enable(true);
+    } else if(argc >= 1 && strcmp(argv[0], "off") == 0){
+        telemetryStream.enable(false);
+    } else {
+        console.printf("Stream is %s\n", telemetryStream.isEnabled() ? "on" : "off");
+    }
+}
+
+void Shell::cmdDisplay(uint32_t argc, char** argv){
+    if(argc >= 1 && strcmp(argv[0], "stats") == 0){
+        displayStats();
+    } else if(argc >= 1 && strcmp(argv[0], "reset") == 0){
+        hmi.getWindow().resetDisplayStats();
+    } else if(argc >= 1 && strcmp(argv[0], "shot") == 0){
+        displayScreenshot();
+    } else {
+        console.println("Usage: display stats | display reset | display shot");
+    }
+}
+
+void Shell::displayStats(){
+    const sharpmem_stats_t stats = hmi.getWindow().getDisplay().getStats();
+    uint32_t frames = max(stats.frames, (uint32_t) 1);
+    console.printf("Frames       %u\n", stats.frames);
+    console.printf("Pixels       %u drawn, %u per frame\n", stats.pixels, stats.pixels / frames);
+    console.printf("Lines        %u sent, %u per frame\n", stats.lines, stats.lines / frames);
+    console.printf("Shadow frame %u lines skipped, %u %% hit rate\n", stats.skipped,
+                   stats.skipped * 100 / max(stats.lines + stats.skipped, (uint32_t) 1));
+    console.printf("SPI          %u B sent, %u B per frame\n", stats.spi_bytes, stats.spi_bytes / frames);
+}
+
+/*
+ * Streams the frame buffer as a binary PBM, the output after the header line can be
+ * saved directly as a .pbm file. Like logDump, the shell owns the console meanwhile.
+ * The HMI task keeps drawing, so a frame that changes during the transfer may be torn.
+ */
+void Shell::displayScreenshot(){
+    const SharpDisplay& display = hmi.getWindow().getDisplay();
+    const uint32_t rowBytes = display.getRawWidth() / 8;
+    uint8_t row[SHELL_DUMP_CHUNK_SIZE];
+
+    if(!console.claim()){
+        console.println("Console busy, switch the stream off first");
+        return;
+    }
+    console.printf("P4\n%d %d\n", display.getRawWidth(), display.getRawHeight());
+    for(int16_t y = 0; y < display.getRawHeight() && console && !console.isBinaryMode(); y++){
+        while(console.availableForWrite() < (int) rowBytes){
+            vTaskDelay(1);
+        }
+        display.getPbmRow(y, row);
+        console.write(row, rowBytes);
+    }
+    console.println();
+    console.release();
+}
+
+void Shell::cmdHmi(uint32_t argc, char** argv){
+    if(argc >= 1 && strcmp(argv[0], "latency") == 0){
+        hmiLatency();
+    } else if(argc >= 1 && strcmp(argv[0], "reset") == 0){
+        hmi.getCommandLatency().reset();
+        hmi.getRenderer().getFrameLatency().reset();
+    } else {
+        console.println("Usage: hmi latency | hmi reset");
+    }
+}
+
+/* Button event to FSM done (commands sent) and to the start of the frame transfer */
+void Shell::hmiLatency(){
+    const LatencyHistogram& command = hmi.getCommandLatency();
+    const LatencyHistogram& frame = hmi.getRenderer().getFrameLatency();
+
+    console.printf("%-12s %10s %10s\n", "Latency", "Command", "Frame");
+    for(uint32_t i = 0; i < LATENCY_BUCKETS; i++){
+        console.printf(">= %6u us  %10u %10u\n", LatencyHistogram::lowerLimit(i), command.getCount(i), frame.getCount(i));
+    }
+    console.printf("%-12s %10u %10u\n", "Total", command.getTotal(), frame.getTotal());
+    console.printf("%-12s %10u %10u\n", "Max [us]", command.getMaximum(), frame.getMaximum());
+    console.printf("Dropped      %u input events, %u render requests\n", hmi.getDroppedInputEvents(), hmi.getRenderer().getDroppedRequests());
+}
+
+void Shell::cmdPower(uint32_t argc, char** argv){
+    if(argc >= 1 && strcmp(argv[0], "stats") == 0){
+        powerStats();
+    } else if(argc >= 1 && strcmp(argv[0], "reset") == 0){
+        power.resetStats();
+    } else {
+        console.println("Usage: power stats | power reset");
+    }
+}
+
+/* Without a current sensor the battery voltage drop per hour on battery compares the modes */
+void Shell::powerStats(){
+    console.printf("Mode %s, CPU %u MHz, frequency scaling %s, light sleep %s\n", lookup_tables[TABLE_POWER].values[power.getMode()],
+                   getCpuFrequencyMhz(), power.hasFrequencyScaling() ? "yes" : "no", power.hasLightSleep() ? "yes" : "no");
+
+    console.printf("%-12s %12s %10s %10s\n", "Mode", "Battery [s]", "Drop [mV]", "[mV/h]");
+    for(uint32_t i = 0; i < POWER_MODE_COUNT; i++){
+        const power_mode_stats_t& stats = power.getStats((power_mode_e)i);
+        float rate = stats.time ? stats.drop * 1000 * 3600 / stats.time : 0;
+        console.printf("%-12s %12u %10.0f %10.1f\n", lookup_tables[TABLE_POWER].values[i], stats.time, stats.drop * 1000, rate);
+    }
+
+    // Share of the uptime a lock was held, for the frequency locks the time at full clock
+    uint64_t uptime = esp_timer_get_time();
+    console.printf("%-12s %12s %10s\n", "Lock", "Held [ms]", "[%]");
+    for(uint32_t i = 0; i < power.getLockCount(); i++){
+        const PowerLock* lock = power.getLock(i);
+        uint64_t held = lock->getHeldTime();
+        console.printf("%-12s %12u %10.1f\n", lock->getName(), (uint32_t)(held / 1000), uptime ? held * 100.0f / uptime : 0);
+    }
+}
+
+/*
+ * Sustained console throughput: the shell owns the console and writes
+ * <bytes> of text lines as fast as the ring buffer takes them, through the
+ * direct TinyUSB FIFO path (usb) or the USBCDC::write path (stream). The
+ * time runs until the ring buffer is empty, so it includes everything but
+ * the last FIFO. The host discards the lines and reads the BENCH line.
+ */
+void Shell::cmdBench(uint32_t argc, char** argv){
+    uint32_t size = (argc >= 1) ? strtoul(argv[0], NULL, 10) : SHELL_BENCH_SIZE;
+    bool direct = !(argc >= 2 && strcmp(argv[1], "stream") == 0);
+    char line[SHELL_BENCH_LINE];
+
+    for(uint32_t i = 0; i < SHELL_BENCH_LINE - 1; i++){
+        line[i] = 'A' + i % 26;
+    }
+    line[SHELL_BENCH_LINE - 1] = '\n';
+
+    if(!console.claim()){
+        console.println("Console busy, switch the stream off first");
+        return;
+    }
+    while(!console.isIdle() && console){
+        vTaskDelay(1);                          // Start with an empty ring buffer
+    }
+
+    bool previous = console.isDirectUsb();
+    console.setDirectUsb(direct);
+    uint32_t stalls = console.getTxStalls();
+    uint32_t overwritten = console.getOverwrittenBytes();
+    uint64_t start = esp_timer_get_time();
+
+    uint32_t queued = 0;
+    while(queued < size && console && !console.isBinaryMode()){
+        uint32_t length = min(size - queued, (uint32_t) SHELL_BENCH_LINE);
+        if(console.availableForWrite() < (int) length){
+            vTaskDelay(1);
+            continue;
+        }
+        console.write((const uint8_t*) line, length);
+        queued += length;
+    }
+    while(!console.isIdle() && console){
+        vTaskDelay(1);
+    }
+
+    uint64_t time = max(esp_timer_get_time() - start, (uint64_t) 1);
+    console.setDirectUsb(previous);
+    console.printf("\nBENCH %s %u B in %u us, %u B/s, %u FIFO stalls, %u B overwritten\n", direct ? "usb" : "stream",
+                   queued, (uint32_t) time, (uint32_t) (queued * 1000000ULL / time),
+                   console.getTxStalls() - stalls, console.getOverwrittenBytes() - overwritten);
+    console.release();
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <Arduino.h>
+
+#define SHELL_TASK_FREQ         20            // [Hz]
+#define SHELL_LINE_LENGTH       64            // [#]    Maximum length of a command line
+#define SHELL_MAX_ARGS          4             // [#]    Maximum number of arguments after the command
+#define SHELL_DUMP_CHUNK_SIZE   512           // [#]    Read size when streaming files
+#define SHELL_BENCH_SIZE        (1 << 20)     // [B]    Default amount of data sent by 'bench'
+#define SHELL_BENCH_LINE        64            // [B]    Line length of the bench pattern, including the newline
+
+/*
+ * Line based command interpreter on the console. Input is collected in a
+ * fixed line buffer, split in place and dispatched through commandTable.
+ * No heap memory is used.
+ */
+class Shell {
+    public:
+        bool begin();
+
+        void cmdHelp(uint32_t argc, char** argv);
+        void cmdStats(uint32_t argc, char** argv);
+        void cmdTasks(uint32_t argc, char** argv);
+        void cmdLinks(uint32_t argc, char** argv);
+        void cmdConfig(uint32_t argc, char** argv);
+        void cmdLog(uint32_t argc, char** argv);
+        void cmdStream(uint32_t argc, char** argv);
+        void cmdDisplay(uint32_t argc, char** argv);
+        void cmdHmi(uint32_t argc, char** argv);
+        void cmdPower(uint32_t argc, char** argv);
+        void cmdBench(uint32_t argc, char** argv);
+
+    private:
+        void process(char ch);
+        void execute();
+        void printPrompt();
+
+        void configGet(const char* name);
+        void configSet(const char* name, const char* value);
+        void logList();
+        void logDump(int32_t number);
+        void displayStats();
+        void displayScreenshot();
+        void hmiLatency();
+        void powerStats();
+
+        static void shellTask(void* pvParameter);
+
+        bool initialized = false;
+
+        char line[SHELL_LINE_LENGTH + 1];
+        uint32_t lineIndex = 0;
+};
+
+typedef void (Shell::*shell_fn) (uint32_t argc, char** argv);
+
+typedef struct {
+    const char* name;
+    const char* usage;
+    const char* description;
+    shell_fn function;
+} shell_command_t;
+
+const shell_command_t commandTable[] = {
+    {"help",   "",                          "List all commands",                          &Shell::cmdHelp},
+    {"stats",  "",                          "System and link statistics",                 &Shell::cmdStats},
+    {"tasks",  "",                          "FreeRTOS task list with stack usage",        &Shell::cmdTasks},
+    {"links",  "",                          "Link quality of both receivers",             &Shell::cmdLinks},
+    {"config", "get [name] | set name val", "Read or change a setting",                   &Shell::cmdConfig},
+    {"log",    "ls | dump <n>",             "List logs or stream log_<n>.csv raw",        &Shell::cmdLog},
+    {"stream", "on | off",                  "Switch to the binary telemetry stream",      &Shell::cmdStream},
+    {"display","stats | reset | shot",      "Draw counters or a PBM (P4) screenshot",     &Shell::cmdDisplay},
+    {"hmi",    "latency | reset",           "Button to command and to frame latency",     &Shell::cmdHmi},
+    {"power",  "stats | reset",             "Battery drop per power mode and lock times", &Shell::cmdPower},
+    {"bench",  "[bytes] [usb | stream]",    "Console throughput of a USB transmit path",  &Shell::cmdBench},
+};
@@ -81,6 +81,11 @@ bool SystemParser::setTelemetryMode(bool mode){
   return true;
 }
 
+bool SystemParser::setPowerMode(uint8_t mode){
+  doc["power_mode"] = mode;
+  return true;
+}
+
 bool SystemParser::setLinkPhrase1(const char* phrase){
   if (phrase == NULL) {
     return false;
@@ -195,3 +200,12 @@ bool SystemParser::saveFile(const char* path) {
   file.close();
   return true;
 }
+
+bool SystemParser::getPowerMode(uint8_t& mode){
+  if(doc.containsKey("power_mode"))
+  {
+    mode = doc["power_mode"].as<uint8_t>();
+    return true;
+  }
+  return false;
+}
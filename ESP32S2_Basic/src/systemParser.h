@@ -49,6 +49,7 @@ class SystemParser {
   bool setNeverStopLoggingFlag(bool flag);
   bool setTimeZone(int16_t timezone);
   bool setTelemetryMode(bool mode);
+  bool setPowerMode(uint8_t mode);
 
   bool getLinkPhrase1(char* phrase);
   bool getLinkPhrase2(char* phrase);
@@ -56,6 +57,7 @@ class SystemParser {
   bool getNeverStopLoggingFlag(bool& flag);
   bool getTimeZone(int16_t& timezone);
   bool getTelemetryMode(bool& mode);
+  bool getPowerMode(uint8_t& mode);
 
   bool saveFile(const char* path = NULL);
 
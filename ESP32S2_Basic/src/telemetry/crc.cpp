@@ -69,11 +69,10 @@ static const uint8_t crc8_tab[] = {
     0x82, 0xb3, 0xe0, 0xd1, 0x46, 0x77, 0x24, 0x15, 0x3b, 0x0a, 0x59, 0x68,
     0xff, 0xce, 0x9d, 0xac};
 
-uint32_t crc32(const uint8_t *buf, size_t size) {
+uint32_t crc32(const uint8_t *buf, size_t size, uint32_t crc) {
   const uint8_t *p = buf;
-  uint32_t crc;
 
-  crc = ~0U;
+  crc = ~crc;
   while (size--)
     crc = crc32_tab[(crc ^ *p++) & 0xFF] ^ (crc >> 8);
   return crc ^ ~0U;
@@ -2,5 +2,5 @@
 
 #include <Arduino.h>
 
-uint32_t crc32(const uint8_t *buf, size_t size);
+uint32_t crc32(const uint8_t *buf, size_t size, uint32_t crc = 0);   // Pass the previous result to continue
 uint8_t crc8(const uint8_t *buf, size_t size);
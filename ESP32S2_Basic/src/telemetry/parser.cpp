@@ -2,9 +2,12 @@
 #include "parser.h"
 #include "crc.h"
 #include "console.h"
+#include "stream.h"
 
 void Parser::parse() {
 
+  telemetryStream.push(linkId, buffer[INDEX_OP], &buffer[2], dataIndex);
+
   (this->*commandFunction[opCodeIndex])(&buffer[2], dataIndex);
 
   /* Reset the parser buffer */
@@ -50,9 +53,11 @@ void Parser::process(uint8_t ch) {
   case STATE_CRC: {
     uint8_t crc = crc8(buffer, dataIndex + 2);
     if (crc == ch) {
+      frameCount++;
       parse();
     } else {
-      console.error.println("[PARSER] CRC Failed");  
+      crcErrorCount++;
+      CONSOLE_LIMITED(console.error, "[PARSER] CRC Failed");
       reset();
     }
   } break;
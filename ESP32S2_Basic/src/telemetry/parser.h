@@ -43,11 +43,12 @@ public:
 
     void parse();
 
-    void init(TelemetryData* d, TelemetryInfo* i, TelemetryLocation* l = NULL, TelemetryTime* t = NULL){
+    void init(TelemetryData* d, TelemetryInfo* i, TelemetryLocation* l = NULL, TelemetryTime* t = NULL, uint8_t id = 0){
         data = d;
         info = i;
         location = l;
         time = t;
+        linkId = id;
     }
 
     void reset() {
@@ -56,6 +57,14 @@ public:
         state = STATE_OP;
     }
 
+    uint32_t getFrameCount() const {
+        return frameCount;
+    }
+
+    uint32_t getCrcErrorCount() const {
+        return crcErrorCount;
+    }
+
     void cmdRX(uint8_t *args, uint32_t length);
     void cmdInfo(uint8_t *args, uint32_t length);
 
@@ -70,6 +79,10 @@ private:
     TelemetryInfo* info;
     TelemetryLocation* location;
     TelemetryTime* time;
+    uint8_t linkId = 0;
+
+    uint32_t frameCount = 0;
+    uint32_t crcErrorCount = 0;
 
     uint8_t buffer[MAX_CMD_BUFFER];
     uint32_t dataIndex = 0;
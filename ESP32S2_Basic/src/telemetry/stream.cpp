@@ -0,0 +1,163 @@
+/*
+ * CATS Flight Software
+ * Copyright (C) 2022 Control and Telemetry Systems
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "stream.h"
+#include "crc.h"
+#include "console.h"
+
+bool TelemetryStream::begin(){
+    queue = xQueueCreate(TELEMETRY_STREAM_QUEUE_LENGTH, sizeof(telemetry_stream_record_t));
+    if(queue == NULL){
+        console.error.println("[STREAM] Could not create queue");
+        return false;
+    }
+    initialized = true;
+    xTaskCreate(streamTask, "task_stream", 2048, this, 1, &task);
+    return true;
+}
+
+void TelemetryStream::enable(bool state){
+    if(state == enabled) return;
+    if(state){
+        console.warning.println("[STREAM] Switching console to binary telemetry stream");
+        vTaskDelay(50);                 // Give the console a chance to send the last text line
+    }
+    if(initialized){
+        xQueueReset(queue);
+    }
+    droppedSinceSent = 0;
+    enabled = state;
+    console.setBinaryMode(state);
+    if(!state){
+        console.ok.println("[STREAM] Binary telemetry stream stopped");
+    }
+}
+
+void TelemetryStream::requestEnable(bool state){
+    requested = state;
+    switchPending = true;
+    if(task != NULL){
+        xTaskNotifyGive(task);
+    }
+}
+
+/* Called from the telemetry tasks, must never block */
+void TelemetryStream::push(uint8_t link, uint8_t opcode, const uint8_t* payload, uint32_t length){
+    if(!enabled || !initialized) return;
+
+    telemetry_stream_record_t record;
+    record.header.version = TELEMETRY_STREAM_VERSION;
+    record.header.link = link;
+    record.header.opcode = opcode;
+    record.header.length = min(length, (uint32_t) TELEMETRY_STREAM_MAX_PAYLOAD);
+    record.header.timestamp = (uint32_t) esp_timer_get_time();
+    record.header.dropped = 0;
+    memcpy(record.payload, payload, record.header.length);
+
+    portENTER_CRITICAL(&lock);
+    record.header.sequence = sequence++;
+    portEXIT_CRITICAL(&lock);
+
+    if(xQueueSend(queue, &record, 0) != pdPASS){
+        portENTER_CRITICAL(&lock);
+        droppedSinceSent++;
+        droppedCount++;
+        portEXIT_CRITICAL(&lock);
+        return;
+    }
+    if(task != NULL){
+        xTaskNotifyGive(task);
+    }
+}
+
+/* Consistent overhead byte stuffing, dst must hold length + length/254 + 1 bytes */
+size_t TelemetryStream::encode(const uint8_t* src, size_t length, uint8_t* dst){
+    size_t readIndex = 0;
+    size_t writeIndex = 1;
+    size_t codeIndex = 0;
+    uint8_t code = 1;
+
+    while(readIndex < length){
+        if(src[readIndex] == 0){
+            dst[codeIndex] = code;
+            code = 1;
+            codeIndex = writeIndex++;
+            readIndex++;
+        } else {
+            dst[writeIndex++] = src[readIndex++];
+            code++;
+            if(code == 0xFF){
+                dst[codeIndex] = code;
+                code = 1;
+                codeIndex = writeIndex++;
+            }
+        }
+    }
+    dst[codeIndex] = code;
+    return writeIndex;
+}
+
+void TelemetryStream::streamTask(void* pvParameter){
+    TelemetryStream* ref = (TelemetryStream*)pvParameter;
+
+    telemetry_stream_record_t record;
+    uint8_t raw[TELEMETRY_STREAM_MAX_RAW];
+    uint8_t frame[TELEMETRY_STREAM_MAX_ENCODED];
+
+    while(ref->initialized){
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if(ref->switchPending){
+            ref->switchPending = false;
+            ref->enable(ref->requested);
+        }
+
+        while(xQueueReceive(ref->queue, &record, 0) == pdPASS){
+            if(!ref->enabled) continue;
+
+            portENTER_CRITICAL(&ref->lock);
+            record.header.dropped = ref->droppedSinceSent;
+            portEXIT_CRITICAL(&ref->lock);
+
+            size_t length = sizeof(telemetry_stream_header_t) + record.header.length;
+            memcpy(raw, &record, length);
+            uint32_t crc = crc32(raw, length);
+            memcpy(raw + length, &crc, TELEMETRY_STREAM_CRC_SIZE);     // Little endian on the ESP32
+            length += TELEMETRY_STREAM_CRC_SIZE;
+
+            size_t frameLength = encode(raw, length, frame);
+            frame[frameLength++] = TELEMETRY_STREAM_DELIMITER;
+
+            // Drop whole records instead of letting the console ring buffer overwrite a partially sent frame
+            if(console.availableForWrite() < (int) frameLength || console.writeBinary(frame, frameLength) != frameLength){
+                portENTER_CRITICAL(&ref->lock);
+                ref->droppedSinceSent++;
+                ref->droppedCount++;
+                portEXIT_CRITICAL(&ref->lock);
+                continue;
+            }
+
+            portENTER_CRITICAL(&ref->lock);
+            ref->droppedSinceSent -= record.header.dropped;
+            portEXIT_CRITICAL(&ref->lock);
+            ref->sentCount++;
+        }
+    }
+    vTaskDelete(NULL);
+}
+
+TelemetryStream telemetryStream;
@@ -0,0 +1,75 @@
+/*
+ * CATS Flight Software
+ * Copyright (C) 2022 Control and Telemetry Systems
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include "stream_format.h"
+
+#define TELEMETRY_STREAM_QUEUE_LENGTH 32
+
+/*
+ * Forwards every frame received by the parsers of both links as a framed
+ * binary record to the console. Records are queued without blocking, so the
+ * telemetry tasks never wait on USB. While the stream is enabled the console
+ * is switched to binary mode and text logging is suppressed. The stream task
+ * is notified for every record and for mode switches requested by USB events.
+ */
+class TelemetryStream {
+    public:
+        bool begin();
+
+        void enable(bool state);
+
+        /* Non-blocking enable for the USB event callback, the stream task switches the mode */
+        void requestEnable(bool state);
+
+        bool isEnabled() const {
+            return enabled;
+        }
+
+        void push(uint8_t link, uint8_t opcode, const uint8_t* payload, uint32_t length);
+
+        uint32_t getSentCount() const {
+            return sentCount;
+        }
+
+        uint32_t getDroppedCount() const {
+            return droppedCount;
+        }
+
+    private:
+        bool initialized = false;
+        volatile bool enabled = false;
+
+        QueueHandle_t queue;
+        TaskHandle_t task = NULL;
+        volatile bool requested = false;
+        volatile bool switchPending = false;
+
+        uint16_t sequence = 0;
+        volatile uint16_t droppedSinceSent = 0;
+        volatile uint32_t sentCount = 0;
+        volatile uint32_t droppedCount = 0;
+        portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+
+        static size_t encode(const uint8_t* src, size_t length, uint8_t* dst);
+        static void streamTask(void* pvParameter);
+};
+
+extern TelemetryStream telemetryStream;
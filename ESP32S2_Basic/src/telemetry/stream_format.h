@@ -0,0 +1,60 @@
+/*
+ * CATS Flight Software
+ * Copyright (C) 2022 Control and Telemetry Systems
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/*
+ * Wire format of the binary live-telemetry stream on the USB CDC interface.
+ * This header is shared with the host reader (host/stream_reader.h) and must
+ * therefore only depend on the standard C headers.
+ *
+ * Every record is sent as:
+ *
+ *   COBS( header | payload[header.length] | crc32 ) | 0x00
+ *
+ * The CRC32 (same polynomial as crc32() in crc.cpp) covers header and payload
+ * and is transmitted little endian. The 0x00 delimiter allows a reader to
+ * resynchronize at any point of the stream.
+ */
+
+#include <stdint.h>
+
+#define TELEMETRY_STREAM_VERSION      1
+#define TELEMETRY_STREAM_MAX_PAYLOAD  16
+#define TELEMETRY_STREAM_DELIMITER    0x00
+
+typedef struct {
+    uint8_t version;      // TELEMETRY_STREAM_VERSION
+    uint8_t link;         // 0: link1, 1: link2
+    uint8_t opcode;       // CMD_RX, CMD_INFO, CMD_GNSS_LOC, CMD_GNSS_TIME, CMD_GNSS_INFO
+    uint8_t length;       // Number of valid payload bytes
+    uint16_t sequence;    // Incremented for every record, also for dropped ones
+    uint16_t dropped;     // Records dropped since the last transmitted record
+    uint32_t timestamp;   // [us] Receive time (wraps after ~71 min)
+} __attribute__((packed)) telemetry_stream_header_t;
+
+typedef struct {
+    telemetry_stream_header_t header;
+    uint8_t payload[TELEMETRY_STREAM_MAX_PAYLOAD];
+} __attribute__((packed)) telemetry_stream_record_t;
+
+enum {
+    TELEMETRY_STREAM_CRC_SIZE = 4,
+    TELEMETRY_STREAM_MAX_RAW = sizeof(telemetry_stream_record_t) + TELEMETRY_STREAM_CRC_SIZE,
+    TELEMETRY_STREAM_MAX_ENCODED = TELEMETRY_STREAM_MAX_RAW + TELEMETRY_STREAM_MAX_RAW / 254 + 2,   // COBS overhead + delimiter
+};
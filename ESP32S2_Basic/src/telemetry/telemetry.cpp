@@ -1,12 +1,13 @@
 #include "telemetry/telemetry.h"
 #include "crc.h"
 #include "console.h"
+#include "logging/crashlog.h"
 
 #define TASK_TELE_FREQ 100
 
 void Telemetry::begin(){
     serial.begin(115200, SERIAL_8N1, rxPin, txPin);
-    parser.init(&data, &info, &location, &time);
+    parser.init(&data, &info, &location, &time, linkId);
     initialized = true;
 
     xTaskCreate(update, "task_telemetry", 2048, this, 1, NULL);
@@ -73,6 +74,9 @@ void Telemetry::initLink(){
         vTaskDelay(100);
         sendEnable();
         console.warning.println("[TELE] Link Enabled");
+        if(!awakeLock.isHeld()) awakeLock.acquire();
+    } else {
+        awakeLock.release();
     }
 
     if(testingPhrase[0] != 0) {
@@ -116,6 +120,7 @@ void Telemetry::update(void *pvParameter){
 
     while(ref->initialized){
         TickType_t task_last_tick = xTaskGetTickCount();
+        crashLog.heartbeat((heartbeat_slot_e)(HEARTBEAT_LINK1 + ref->linkId));
 
         if(ref->newSetting){
             ref->newSetting = false;
@@ -137,8 +142,12 @@ void Telemetry::update(void *pvParameter){
             ref->sendTXPayload((uint8_t*)&ref->testingMsg, 15);
         }
 
-        while(ref->serial.available()){
-            ref->parser.process(ref->serial.read()); 
+        if(ref->serial.available()){
+            ref->cpuLock.acquire();
+            while(ref->serial.available()){
+                ref->parser.process(ref->serial.read()); 
+            }
+            ref->cpuLock.release();
         }
 
         vTaskDelayUntil(&task_last_tick, (const TickType_t) 1000 / TASK_TELE_FREQ);
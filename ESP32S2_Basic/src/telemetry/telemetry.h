@@ -3,10 +3,11 @@
 #include "telemetry_reg.h"
 #include "parser.h"
 #include "telemetryData.h"
+#include "power.h"
 
 class Telemetry {
     public:
-        Telemetry(HardwareSerial& serial, int rxPin, int txPin) : serial(serial), rxPin(rxPin), txPin(txPin){}
+        Telemetry(HardwareSerial& serial, int rxPin, int txPin, uint8_t linkId) : serial(serial), rxPin(rxPin), txPin(txPin), linkId(linkId){}
         void begin();
 
         void setLinkPhrase(char* phrase, uint32_t length);
@@ -38,6 +39,14 @@ class Telemetry {
             }
         }
 
+        uint32_t getFrameCount() const {
+            return parser.getFrameCount();
+        }
+
+        uint32_t getCrcErrorCount() const {
+            return parser.getCrcErrorCount();
+        }
+
         TelemetryData data;
         TelemetryInfo info;
         TelemetryLocation location;
@@ -62,6 +71,11 @@ class Telemetry {
         Parser parser;
         int txPin;
         int rxPin;
+        uint8_t linkId;
+
+        // The UART loses data in light sleep, the link keeps the chip awake while enabled
+        PowerLock cpuLock = PowerLock(linkId ? "link2" : "link1");
+        PowerLock awakeLock = PowerLock(linkId ? "link2 rx" : "link1 rx", ESP_PM_NO_LIGHT_SLEEP);
 
         uint8_t linkPhrase[8] = {};
         uint8_t testingPhrase[8] = {};
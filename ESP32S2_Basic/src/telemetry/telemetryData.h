@@ -93,6 +93,20 @@ class TelemetryData {
             return lastCommitTime;
         }
 
+        /* Last position without clearing the update flag the Live page waits for, false without a fix */
+        bool getPosition(float* lat, float* lon, int32_t* alt) const {
+            if(rxData.lat == 0 || rxData.lon == 0) return false;
+            *lat = (float) rxData.lat / 10000.0f;
+            *lon = (float) rxData.lon / 10000.0f;
+            *alt = rxData.altitude;
+            return true;
+        }
+
+        /* Past READY, the states the recorder logs, without clearing the update flag */
+        bool inFlight() const {
+            return rxData.state > 2;
+        }
+
         packedRXMessage rxData;
 
     private:
@@ -110,7 +124,7 @@ typedef struct {
 class TelemetryInfo {
     public:
         void commit(uint8_t* data, uint32_t length){
-            memcpy(&infoData, data, sizeof(infoData));
+            memcpy(&infoData, data, min(length, (uint32_t) sizeof(infoData)));
             lastCommitTime = millis();
             updated = true;
         }
@@ -134,6 +148,15 @@ class TelemetryInfo {
             return (uint16_t)infoData.lq;
         }
 
+        /* Read without clearing the updated flag */
+        TelemetryInfoData peek() const {
+            return infoData;
+        }
+
+        uint32_t getLastUpdateTime() const {
+            return lastCommitTime;
+        }
+
 
     private:
         TelemetryInfoData infoData;
@@ -150,7 +173,7 @@ typedef struct {
 class TelemetryTime {
     public:
         void commit(uint8_t* data, uint32_t length){
-            memcpy(&timeData, data, sizeof(TelemetryTimeData));
+            memcpy(&timeData, data, min(length, (uint32_t) sizeof(TelemetryTimeData)));
             lastCommitTime = millis();
             updated = true;
             wasUpdated = true;
@@ -192,7 +215,7 @@ typedef struct {
 class TelemetryLocation {
     public:
         void commit(uint8_t* data, uint32_t length){
-            memcpy(&locationData, data, sizeof(TelemetryLocationData));
+            memcpy(&locationData, data, min(length, (uint32_t) sizeof(TelemetryLocationData)));
             lastCommitTime = millis();
             updated = true;
             wasUpdated = true;
@@ -50,6 +50,7 @@ static int32_t msc_write_cb(uint32_t lba, uint8_t* buffer, uint32_t bufsize);
 static void usbEventCallback(void* arg, esp_event_base_t event_base, int32_t event_id, void* event_data);
 static volatile bool updated = false;
 static volatile bool connected = false;
+static SemaphoreHandle_t fsMutex = nullptr;
 
 Adafruit_USBD_MSC usb_msc;
 Adafruit_FlashTransport_ESP32 flashTransport;
@@ -62,6 +63,8 @@ bool Utils::begin(uint32_t watchdogTimeout, const char* labelName, bool forceFor
 {
   bool status = true;
 
+  fsMutex = xSemaphoreCreateRecursiveMutex();
+
   pinMode(BOOT_BUTTON, INPUT_PULLUP);
   if(watchdogTimeout > 0)
   {
@@ -156,6 +159,18 @@ void Utils::update(void* pvParameter)
   vTaskDelete(NULL);
 }
 
+bool fsLock(TickType_t timeout)
+{
+  if(fsMutex == nullptr) return true;
+  return xSemaphoreTakeRecursive(fsMutex, timeout) == pdTRUE;
+}
+
+void fsUnlock(void)
+{
+  if(fsMutex == nullptr) return;
+  xSemaphoreGiveRecursive(fsMutex);
+}
+
 bool Utils::isUpdated(bool clearFlag)
 {
   bool status = updated;
@@ -42,6 +42,9 @@
 
 extern FatFileSystem fatfs;
 
+bool fsLock(TickType_t timeout = portMAX_DELAY);     // Serializes fatfs access between tasks, recursive
+void fsUnlock(void);
+
 class Utils
 {
   public: